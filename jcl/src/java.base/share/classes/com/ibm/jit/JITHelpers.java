@@ -711,6 +711,64 @@ public final class JITHelpers {
 		return -1;
 	}
 
+	/**
+	 * Compares two ranges of Latin1 characters.
+	 *
+	 * <p>This API implicitly assumes the following:
+	 * <blockquote><pre>
+	 *     - s1Value != null
+	 *     - s2Value != null
+	 *     - 0 <= s1Start, s1Start + length <= s1Value.length
+	 *     - 0 <= s2Start, s2Start + length <= s2Value.length
+	 * <blockquote><pre>
+	 *
+	 * @param s1Value the first character array.
+	 * @param s1Start the starting offset (in number of characters) in the first array.
+	 * @param s2Value the second character array.
+	 * @param s2Start the starting offset (in number of characters) in the second array.
+	 * @param length  the number of characters to compare.
+	 * @return        the difference between the first pair of characters that are not equal, or 0 if the ranges are
+	 *                equal.
+	 */
+	public int intrinsicCompareLatin1(Object s1Value, int s1Start, Object s2Value, int s2Start, int length) {
+		for (int i = 0; i < length; i++) {
+			int result = byteToCharUnsigned(getByteFromArrayByIndex(s1Value, s1Start + i)) - byteToCharUnsigned(getByteFromArrayByIndex(s2Value, s2Start + i));
+			if (result != 0) {
+				return result;
+			}
+		}
+		return 0;
+	}
+
+	/**
+	 * Compares two ranges of UTF16 characters.
+	 *
+	 * <p>This API implicitly assumes the following:
+	 * <blockquote><pre>
+	 *     - s1Value != null
+	 *     - s2Value != null
+	 *     - 0 <= s1Start, s1Start + length <= s1Value.length / 2 (if s1Value instanceof byte[])
+	 *     - 0 <= s2Start, s2Start + length <= s2Value.length / 2 (if s2Value instanceof byte[])
+	 * <blockquote><pre>
+	 *
+	 * @param s1Value the first character array.
+	 * @param s1Start the starting offset (in number of characters) in the first array.
+	 * @param s2Value the second character array.
+	 * @param s2Start the starting offset (in number of characters) in the second array.
+	 * @param length  the number of characters to compare.
+	 * @return        the difference between the first pair of characters that are not equal, or 0 if the ranges are
+	 *                equal.
+	 */
+	public int intrinsicCompareUTF16(Object s1Value, int s1Start, Object s2Value, int s2Start, int length) {
+		for (int i = 0; i < length; i++) {
+			int result = getCharFromArrayByIndex(s1Value, s1Start + i) - getCharFromArrayByIndex(s2Value, s2Start + i);
+			if (result != 0) {
+				return result;
+			}
+		}
+		return 0;
+	}
+
 	/*
 	 * Constants for optimizedClone
 	 */
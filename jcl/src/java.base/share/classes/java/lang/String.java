@@ -1405,14 +1405,16 @@ public final class String implements Serializable, Comparable<String>, CharSeque
 		byte[] s2Value = s2.value;
 
 		if (enableCompression && (null == compressionFlag || (s1.coder | s2.coder) == LATIN1)) {
-			while (o1 < end) {
-				int result =
-					helpers.byteToCharUnsigned(helpers.getByteFromArrayByIndex(s1Value, o1++)) -
-					helpers.byteToCharUnsigned(helpers.getByteFromArrayByIndex(s2Value, o2++));
+			int result = helpers.intrinsicCompareLatin1(s1Value, 0, s2Value, 0, end);
 
-				if (result != 0) {
-					return result;
-				}
+			if (result != 0) {
+				return result;
+			}
+		} else if (!enableCompression || s1.coder == s2.coder) {
+			int result = helpers.intrinsicCompareUTF16(s1Value, 0, s2Value, 0, end);
+
+			if (result != 0) {
+				return result;
 			}
 		} else {
 			while (o1 < end) {
@@ -2367,11 +2369,13 @@ public final class String implements Serializable, Comparable<String>, CharSeque
 			if (helpers.getByteFromArrayByIndex(s1Value, s1Start + end) != helpers.getByteFromArrayByIndex(s2Value, s2Start + end)) {
 				return false;
 			} else {
-				for (int i = 0; i < end; ++i) {
-					if (helpers.getByteFromArrayByIndex(s1Value, s1Start + i) != helpers.getByteFromArrayByIndex(s2Value, s2Start + i)) {
-						return false;
-					}
-				}
+				return helpers.intrinsicCompareLatin1(s1Value, s1Start, s2Value, s2Start, end) == 0;
+			}
+		} else if (!enableCompression || s1.coder == s2.coder) {
+			if (helpers.getCharFromArrayByIndex(s1Value, s1Start + end) != helpers.getCharFromArrayByIndex(s2Value, s2Start + end)) {
+				return false;
+			} else {
+				return helpers.intrinsicCompareUTF16(s1Value, s1Start, s2Value, s2Start, end) == 0;
 			}
 		} else {
 			if (s1.charAtInternal(s1Start + end, s1Value) != s2.charAtInternal(s2Start + end, s2Value)) {
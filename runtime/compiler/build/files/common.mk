@@ -66,6 +66,7 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     compiler/optimizer/StringPeepholes.cpp \
     compiler/optimizer/UnsafeFastPath.cpp \
     compiler/optimizer/VarHandleTransformer.cpp \
+    compiler/optimizer/VectorAPIExpansion.cpp \
     compiler/optimizer/VPBCDConstraint.cpp \
     omr/compiler/codegen/Analyser.cpp \
     omr/compiler/codegen/CodeGenGC.cpp \
@@ -281,6 +282,7 @@ JIT_PRODUCT_SOURCE_FILES+=\
     compiler/control/JitDump.cpp \
     compiler/control/MethodToBeCompiled.cpp \
     compiler/control/rossa.cpp \
+    compiler/control/StartupCompilePlan.cpp \
     compiler/env/ClassLoaderTable.cpp \
     compiler/env/CpuUtilization.cpp \
     compiler/env/FilePointer.cpp \
@@ -403,7 +405,10 @@ JIT_PRODUCT_SOURCE_FILES+=\
     compiler/net/ServerStream.cpp \
     compiler/runtime/CompileService.cpp \
     compiler/runtime/JITClientSession.cpp \
+    compiler/runtime/JITServerAOTCache.cpp \
+    compiler/runtime/JITServerROMClassCache.cpp \
     compiler/runtime/JITServerIProfiler.cpp \
+    compiler/runtime/JITServerMetrics.cpp \
     compiler/runtime/JITServerStatisticsThread.cpp \
     compiler/runtime/Listener.cpp
 endif
@@ -20,4 +20,6 @@
 
 JIT_PRODUCT_SOURCE_FILES+=\
     compiler/x/amd64/runtime/AMD64CompressString.nasm \
+    compiler/x/amd64/runtime/AMD64CryptoIntrinsics.nasm \
+    compiler/x/amd64/runtime/AMD64StringIntrinsics.nasm \
     compiler/x/amd64/runtime/AMD64Recompilation.nasm
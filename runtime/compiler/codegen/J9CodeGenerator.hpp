@@ -516,6 +516,80 @@ public:
    */
    void setSupportsInlineConcurrentLinkedQueue() { _j9Flags.set(SupportsInlineConcurrentLinkedQueue); }
 
+   /** \brief
+   *    Determines whether the code generator can evaluate the vector IL that
+   *    jdk/internal/vm/vector/VectorSupport intrinsics are expanded into
+   */
+   bool getSupportsInlineVectorAPI() { return _j9Flags.testAny(SupportsInlineVectorAPI); }
+
+   /** \brief
+   *    The code generator can evaluate expanded jdk/internal/vm/vector/VectorSupport intrinsics
+   */
+   void setSupportsInlineVectorAPI() { _j9Flags.set(SupportsInlineVectorAPI); }
+
+   /** \brief
+   *    Determines whether the code generator supports inlining of java/util/zip/CRC32C.updateBytes
+   *    and java/util/zip/CRC32C.updateDirectByteBuffer
+   */
+   bool getSupportsInlineCRC32C() { return _j9Flags.testAny(SupportsInlineCRC32C); }
+
+   /** \brief
+   *    The code generator supports inlining of java/util/zip/CRC32C update methods
+   */
+   void setSupportsInlineCRC32C() { _j9Flags.set(SupportsInlineCRC32C); }
+
+   /** \brief
+   *    Determines whether the code generator supports inlining of java/util/Base64$Encoder.encodeBlock
+   */
+   bool getSupportsInlineBase64Encode() { return _j9Flags.testAny(SupportsInlineBase64Encode); }
+
+   /** \brief
+   *    The code generator supports inlining of java/util/Base64$Encoder.encodeBlock
+   */
+   void setSupportsInlineBase64Encode() { _j9Flags.set(SupportsInlineBase64Encode); }
+
+   /** \brief
+   *    Determines whether the code generator supports inlining of the single block
+   *    encrypt and decrypt methods of com/sun/crypto/provider/AESCrypt
+   */
+   bool getSupportsInlineAESBlock() { return _j9Flags.testAny(SupportsInlineAESBlock); }
+
+   /** \brief
+   *    The code generator supports inlining of com/sun/crypto/provider/AESCrypt block methods
+   */
+   void setSupportsInlineAESBlock() { _j9Flags.set(SupportsInlineAESBlock); }
+
+   /** \brief
+   *    Determines whether the code generator supports inlining of com/sun/crypto/provider/GHASH.processBlocks
+   */
+   bool getSupportsInlineGHASH() { return _j9Flags.testAny(SupportsInlineGHASH); }
+
+   /** \brief
+   *    The code generator supports inlining of com/sun/crypto/provider/GHASH.processBlocks
+   */
+   void setSupportsInlineGHASH() { _j9Flags.set(SupportsInlineGHASH); }
+
+   /** \brief
+   *    Determines whether the code generator supports inlining of com/ibm/jit/JITHelpers.intrinsicCompareLatin1
+   *    and com/ibm/jit/JITHelpers.intrinsicCompareUTF16
+   */
+   bool getSupportsInlineStringCompare() { return _j9Flags.testAny(SupportsInlineStringCompare); }
+
+   /** \brief
+   *    The code generator supports inlining of com/ibm/jit/JITHelpers string compare intrinsics
+   */
+   void setSupportsInlineStringCompare() { _j9Flags.set(SupportsInlineStringCompare); }
+
+   /** \brief
+   *    Determines whether the code generator supports inlining of java/lang/StringCoding.hasNegatives
+   */
+   bool getSupportsInlineHasNegatives() { return _j9Flags.testAny(SupportsInlineHasNegatives); }
+
+   /** \brief
+   *    The code generator supports inlining of java/lang/StringCoding.hasNegatives
+   */
+   void setSupportsInlineHasNegatives() { _j9Flags.set(SupportsInlineHasNegatives); }
+
    /**
     * \brief
     *    The number of nodes between a monext and the next monent before
@@ -602,6 +676,13 @@ private:
       SupportsInlineStringHashCode                        = 0x00000010, /*! codegen inlining of Java string hash code */
       SupportsInlineConcurrentLinkedQueue                 = 0x00000020,
       SupportsBigDecimalLongLookasideVersioning           = 0x00000040,
+      SupportsInlineVectorAPI                             = 0x00000080, /*! codegen evaluation of expanded Vector API intrinsics */
+      SupportsInlineCRC32C                                = 0x00000100, /*! codegen inlining of Java CRC32C update */
+      SupportsInlineBase64Encode                          = 0x00000200, /*! codegen inlining of Java Base64 block encoding */
+      SupportsInlineAESBlock                              = 0x00000400, /*! codegen inlining of Java AES single block encryption and decryption */
+      SupportsInlineGHASH                                 = 0x00000800, /*! codegen inlining of Java GHASH block processing */
+      SupportsInlineStringCompare                         = 0x00001000, /*! codegen inlining of Java string compare */
+      SupportsInlineHasNegatives                          = 0x00002000, /*! codegen inlining of Java StringCoding.hasNegatives */
       };
 
    flags32_t _j9Flags;
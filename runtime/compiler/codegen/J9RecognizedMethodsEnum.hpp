@@ -326,6 +326,12 @@
    java_util_zip_CRC32_update,
    java_util_zip_CRC32_updateBytes,
    java_util_zip_CRC32_updateByteBuffer,
+   java_util_zip_CRC32C_updateBytes,
+   java_util_zip_CRC32C_updateDirectByteBuffer,
+   java_util_Base64_Encoder_encodeBlock,
+   com_sun_crypto_provider_AESCrypt_implEncryptBlock,
+   com_sun_crypto_provider_AESCrypt_implDecryptBlock,
+   com_sun_crypto_provider_GHASH_processBlocks,
    sun_misc_Unsafe_compareAndSwapInt_jlObjectJII_Z,
    sun_misc_Unsafe_compareAndSwapLong_jlObjectJJJ_Z,
    sun_misc_Unsafe_compareAndSwapObject_jlObjectJjlObjectjlObject_Z,
@@ -428,6 +434,10 @@
 
    jdk_internal_loader_NativeLibraries_load,
 
+   jdk_internal_vm_vector_VectorSupport_load,
+   jdk_internal_vm_vector_VectorSupport_store,
+   jdk_internal_vm_vector_VectorSupport_binaryOp,
+
    java_lang_reflect_Array_getLength,
    java_util_Arrays_fill,
    java_util_Arrays_equals,
@@ -693,6 +703,8 @@
    com_ibm_jit_JITHelpers_isArray,
    com_ibm_jit_JITHelpers_intrinsicIndexOfStringLatin1,
    com_ibm_jit_JITHelpers_intrinsicIndexOfStringUTF16,
+   com_ibm_jit_JITHelpers_intrinsicCompareLatin1,
+   com_ibm_jit_JITHelpers_intrinsicCompareUTF16,
    com_ibm_jit_JITHelpers_intrinsicIndexOfLatin1,
    com_ibm_jit_JITHelpers_intrinsicIndexOfUTF16,
    com_ibm_jit_JITHelpers_getJ9ClassFromObject32,
@@ -1126,6 +1138,7 @@
    java_lang_StringCoding_encode8859_1,
    java_lang_StringCoding_encodeASCII,
    java_lang_StringCoding_encodeUTF8,
+   java_lang_StringCoding_hasNegatives,
 
    java_util_Arrays_copyOf_byte,
    java_util_Arrays_copyOf_short,
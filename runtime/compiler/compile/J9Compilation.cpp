@@ -164,6 +164,7 @@ J9::Compilation::Compilation(int32_t id,
    _aotMethodDataStart(NULL),
    _curMethodMetadata(NULL),
    _getImplInlineable(false),
+   _vectorAPICallsInlineable(false),
    _vpInfoManager(NULL),
    _bpInfoManager(NULL),
    _methodBranchInfoList(getTypedAllocator<TR_MethodBranchProfileInfo*>(self()->allocator())),
@@ -160,6 +160,10 @@ class OMR_EXTENSIBLE Compilation : public OMR::CompilationConnector
    void setGetImplInlineable(bool b) { _getImplInlineable = b; }
    bool getGetImplInlineable() { return _getImplInlineable; }
 
+   // Set once VectorAPIExpansion has run, so that the VectorSupport calls it did not expand can be inlined
+   void setVectorAPICallsInlineable(bool b) { _vectorAPICallsInlineable = b; }
+   bool getVectorAPICallsInlineable() { return _vectorAPICallsInlineable; }
+
    //for converters
    bool canTransformConverterMethod(TR::RecognizedMethod method);
    bool isConverterMethod(TR::RecognizedMethod method);
@@ -388,6 +392,8 @@ private:
 
    bool _getImplInlineable;
 
+   bool _vectorAPICallsInlineable;
+
    TR_ValueProfileInfoManager *_vpInfoManager;
 
    TR_BranchProfileInfoManager *_bpInfoManager;
@@ -40,9 +40,9 @@
 #include "infra/Statistics.hpp"
 #include "control/rossa.h"
 #include "runtime/RelocationRuntime.hpp"
+#include "env/PersistentCollections.hpp"
 #if defined(J9VM_OPT_JITSERVER)
 #include "control/JITServerHelpers.hpp"
-#include "env/PersistentCollections.hpp"
 #include "net/ServerStream.hpp"
 #endif /* defined(J9VM_OPT_JITSERVER) */
 
@@ -67,6 +67,7 @@ class TR_OptimizationPlan;
 class TR_PersistentMethodInfo;
 class TR_RelocationRuntime;
 class TR_ResolvedMethod;
+class TR_StartupCompilePlan;
 namespace TR { class MonitorTable; }
 namespace TR { class IlGeneratorMethodDetails; }
 namespace TR { class Options; }
@@ -77,6 +78,9 @@ template <typename T> class TR_PersistentArray;
 typedef J9JITExceptionTable TR_MethodMetaData;
 #if defined(J9VM_OPT_JITSERVER)
 class ClientSessionHT;
+class JITServerAOTCache;
+class JITServerROMClassCache;
+class JITServerMetrics;
 #endif /* defined(J9VM_OPT_JITSERVER) */
 
 struct TR_SignatureCountPair
@@ -118,8 +122,10 @@ class TR_LowPriorityCompQueue
       TR_MethodToBeCompiled *findAndDequeueFromLPQ(TR::IlGeneratorMethodDetails &details,
          uint8_t reason, TR_J9VMBase *fe, bool & dequeued);
       void enqueueCompReqToLPQ(TR_MethodToBeCompiled *compReq);
-      bool createLowPriorityCompReqAndQueueIt(TR::IlGeneratorMethodDetails &details, void *startPC, uint8_t reason);
-      bool addFirstTimeCompReqToLPQ(J9Method *j9method, uint8_t reason);
+      bool createLowPriorityCompReqAndQueueIt(TR::IlGeneratorMethodDetails &details, void *startPC, uint8_t reason,
+                                              TR_Hotness optLevel = warm, TR_YesNoMaybe methodIsInSharedCache = TR_maybe);
+      bool addFirstTimeCompReqToLPQ(J9Method *j9method, uint8_t reason,
+                                    TR_Hotness optLevel = warm, TR_YesNoMaybe methodIsInSharedCache = TR_maybe);
       bool addUpgradeReqToLPQ(TR_MethodToBeCompiled*);
       int32_t getLowPriorityQueueSize() const { return _sizeLPQ; }
       int32_t getLPQWeight() const { return _LPQWeight; }
@@ -173,8 +179,10 @@ class TR_LowPriorityCompQueue
       uint32_t _STAT_LPQcompFromIprofiler; // first time compilations coming from LPQ
       uint32_t _STAT_LPQcompFromInterpreter;
       uint32_t _STAT_LPQcompUpgrade;
+      uint32_t _STAT_LPQcompFromCompilePlan;
       // stats written by application threads
       uint32_t _STAT_compReqQueuedByInterpreter;
+      uint32_t _STAT_compReqQueuedByCompilePlan;
       uint32_t _STAT_numFailedToEnqueueInLPQ;
    }; // TR_LowPriorityCompQueue
 
@@ -698,6 +706,9 @@ public:
    void changeCompReqFromAsyncToSync(J9Method * method);
    int32_t                promoteMethodInAsyncQueue(J9Method * method, void *pc);
    TR_MethodToBeCompiled *getNextMethodToBeCompiled(TR::CompilationInfoPerThread *compInfoPT, bool compThreadCameOutOfSleep, TR_CompThreadActions*);
+#if defined(J9VM_OPT_JITSERVER)
+   TR_MethodToBeCompiled *getNextOutOfProcessEntry(TR_CompThreadActions *compThreadAction);
+#endif /* defined(J9VM_OPT_JITSERVER) */
    TR_MethodToBeCompiled *peekNextMethodToBeCompiled();
    TR_MethodToBeCompiled *getMethodQueue() { return _methodQueue; }
    int32_t getOverallCompCpuUtilization() const { return _overallCompCpuUtilization; } // -1 in case of error. 0 if feature is not enabled
@@ -784,6 +795,9 @@ public:
    int32_t getNumGCRRequestsQueued() const { return _numGCRQueued; }
    void decNumInvReqestsQueued(TR_MethodToBeCompiled *entry);
    void incNumInvRequestsQueued(TR_MethodToBeCompiled *entry);
+   void decNumAotLoadsQueued(TR_MethodToBeCompiled *entry);
+   void incNumAotLoadsQueued(TR_MethodToBeCompiled *entry);
+   int32_t getNumAotLoadsQueued() const { return _numAotLoadsQueued; }
    void updateCompQueueAccountingOnDequeue(TR_MethodToBeCompiled *entry);
    int32_t getNumCompThreadsActive() const { return _numCompThreadsActive; }
    void    incNumCompThreadsActive() { _numCompThreadsActive++; }
@@ -1002,6 +1016,8 @@ public:
 
    TR_JitSampleInfo &getJitSampleInfoRef() { return _jitSampleInfo; }
    TR_InterpreterSamplingTracking *getInterpSamplTrackingInfo() const { return _interpSamplTrackingInfo; }
+   TR_StartupCompilePlan *getStartupCompilePlan() const { return _startupCompilePlan; }
+   void setStartupCompilePlan(TR_StartupCompilePlan *plan) { _startupCompilePlan = plan; }
 
    int32_t getAppSleepNano() const { return _appSleepNano; }
    void setAppSleepNano(int32_t t) { _appSleepNano = t; }
@@ -1018,6 +1034,12 @@ public:
 #if defined(J9VM_OPT_JITSERVER)
    ClientSessionHT *getClientSessionHT() const { return _clientSessionHT; }
    void setClientSessionHT(ClientSessionHT *ht) { _clientSessionHT = ht; }
+   JITServerAOTCache *getJITServerAOTCache() const { return _JITServerAOTCache; }
+   void setJITServerAOTCache(JITServerAOTCache *cache) { _JITServerAOTCache = cache; }
+   JITServerROMClassCache *getJITServerROMClassCache() const { return _JITServerROMClassCache; }
+   void setJITServerROMClassCache(JITServerROMClassCache *cache) { _JITServerROMClassCache = cache; }
+   JITServerMetrics *getJITServerMetrics() const { return _JITServerMetrics; }
+   void setJITServerMetrics(JITServerMetrics *metrics) { _JITServerMetrics = metrics; }
 
    PersistentVector<TR_OpaqueClassBlock*> *getUnloadedClassesTempList() const { return _unloadedClassesTempList; }
    void setUnloadedClassesTempList(PersistentVector<TR_OpaqueClassBlock*> *it) { _unloadedClassesTempList = it; }
@@ -1115,6 +1137,8 @@ private:
    TR::CompilationInfoPerThread *_compInfoForDiagnosticCompilationThread; // compinfo for dump compilation thread
    TR::CompilationInfoPerThreadBase *_compInfoForCompOnAppThread; // This is NULL for separate compilation thread
    TR_MethodToBeCompiled *_methodQueue;
+   TR_MethodToBeCompiled *_lastQueuedEntry; // entry most recently inserted by queueEntry(); NULL once dequeued
+   PersistentUnorderedMap<J9Method *, int32_t> _numQueuedEntriesForMethod; // methods with requests in _methodQueue
    TR_MethodToBeCompiled *_methodPool;
    int32_t                _methodPoolSize; // shouldn't this and _methodPool be static?
 
@@ -1223,6 +1247,7 @@ private:
                                          // We should disable GCR counting if too many
                                          // GCR requests because GCR counting has a large
                                          // negative effect on performance
+   int32_t                _numAotLoadsQueued; // how many first time compilations of methods found in the SCC are in the queue
    //----------------
    int32_t                _appSleepNano; // make app threads sleep when sampling
 
@@ -1250,9 +1275,13 @@ private:
    // freeing scratch segments it holds to
    bool _suspendThreadDueToLowPhysicalMemory;
    TR_InterpreterSamplingTracking *_interpSamplTrackingInfo;
+   TR_StartupCompilePlan *_startupCompilePlan; // NULL if -Xjit:startupCompilePlanSize is not used or there is no SCC
 
 #if defined(J9VM_OPT_JITSERVER)
    ClientSessionHT               *_clientSessionHT; // JITServer hashtable that holds session information about JITClients
+   JITServerAOTCache             *_JITServerAOTCache; // JITServer cache of AOT bodies shared by all JITClients; NULL if disabled
+   JITServerROMClassCache        *_JITServerROMClassCache; // JITServer store of ROM classes shared by all JITClients; NULL if disabled
+   JITServerMetrics              *_JITServerMetrics; // JITServer latency and throughput metrics; NULL if disabled
    PersistentUnorderedSet<J9Class*> _classesCachedAtServer;
    TR::Monitor *_classesCachedAtServerMonitor;
    PersistentVector<TR_OpaqueClassBlock*> *_unloadedClassesTempList; // JITServer list of classes unloaded
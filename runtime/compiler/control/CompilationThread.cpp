@@ -55,6 +55,7 @@
 #include "control/RecompilationInfo.hpp"
 #include "control/MethodToBeCompiled.hpp"
 #include "control/OptimizationPlan.hpp"
+#include "control/StartupCompilePlan.hpp"
 #include "env/CompilerEnv.hpp"
 #include "env/IO.hpp"
 #include "env/PersistentInfo.hpp"
@@ -68,6 +69,7 @@
 #include "exceptions/JITShutDown.hpp"
 #include "exceptions/PersistenceFailure.hpp"
 #include "exceptions/LowPhysicalMemory.hpp"
+#include "exceptions/CompilationMemoryBudgetExceeded.hpp"
 #include "exceptions/RuntimeFailure.hpp"
 #include "exceptions/AOTFailure.hpp"
 #include "exceptions/FSDFailure.hpp"
@@ -101,6 +103,10 @@
 #include "control/JITServerCompilationThread.hpp"
 #include "control/JITServerHelpers.hpp"
 #include "runtime/JITClientSession.hpp"
+#include "runtime/JITServerAOTCache.hpp"
+#include "runtime/JITServerROMClassCache.hpp"
+#include "runtime/JITServerMetrics.hpp"
+#include "runtime/Listener.hpp"
 #include "net/ClientStream.hpp"
 #include "net/ServerStream.hpp"
 #include "omrformatconsts.h"
@@ -521,6 +527,15 @@ TR_YesNoMaybe TR::CompilationInfo::shouldActivateNewCompThread()
    if (freePhysicalMemorySizeB != OMRPORT_MEMINFO_NOT_AVAILABLE &&
        freePhysicalMemorySizeB <= (uint64_t)TR::Options::getSafeReservePhysicalMemoryValue() + TR::Options::getScratchSpaceLowerBound())
       return TR_no;
+   // AOT loads are cheap, and relocations of different methods do not contend on any
+   // global lock, so a large backlog of loads at startup can be spread over several
+   // threads. This is allowed during the grace period below, which is meant to limit
+   // the number of expensive compilations
+   if (TR::Options::_numQueuedAOTLoadsPerCompThread > 0 &&
+       getNumCompThreadsActive() < getNumTargetCPUs() - 1 &&
+       _numAotLoadsQueued > getNumCompThreadsActive() * TR::Options::_numQueuedAOTLoadsPerCompThread)
+      return TR_yes;
+
    // Do not activate a new thread during graceperiod if AOT is used and first run because
    // we may have too many warm compilations at warm. However, there is no such risk for quickstart
    // Another exception: activate if second run in AOT mode
@@ -951,6 +966,7 @@ TR::CompilationInfoPerThreadBase::CompilationInfoPerThreadBase(TR::CompilationIn
    _methodBeingCompiled(NULL),
    _compiler(NULL),
    _metadata(NULL),
+   _scratchSegmentProvider(NULL),
    _reservedDataCache(NULL),
    _timeWhenCompStarted(),
    _numJITCompilations(),
@@ -970,6 +986,35 @@ TR::CompilationInfoPerThreadBase::CompilationInfoPerThreadBase(TR::CompilationIn
              "Cannot have a compId %d greater than %u", _compThreadId, (TR::Options::_numUsableCompilationThreads + TR::CompilationInfo::MAX_DIAGNOSTIC_COMP_THREADS));
    }
 
+void
+TR::CompilationInfoPerThreadBase::checkCompilationMemoryBudget(TR::Compilation *comp)
+   {
+   // Only compilations that can be retried at a lower opt level are abandoned early;
+   // the others keep the full scratch space limit
+   if (!_scratchSegmentProvider ||
+       TR::Options::getCompilationMemoryBudgetPercentage() >= 100 ||
+       comp->getMethodHotness() <= warm ||
+       !comp->allowRecompilation())
+      return;
+
+   uint64_t budget = (uint64_t)_scratchSegmentProvider->allocationLimit() * TR::Options::getCompilationMemoryBudgetPercentage() / 100;
+   uint64_t used = _scratchSegmentProvider->regionBytesAllocated();
+   if (used <= budget)
+      return;
+
+   if (TR::Options::isAnyVerboseOptionSet(TR_VerboseCompFailure, TR_VerbosePerformance))
+      {
+      TR_VerboseLog::writeLineLocked(TR_Vlog_PERF,
+         "t=%6u Compilation of %s at %s exceeded its memory budget: %llu KB used, budget %llu KB",
+         (uint32_t)_compInfo.getPersistentInfo()->getElapsedTime(),
+         comp->signature(),
+         comp->getHotnessName(comp->getMethodHotness()),
+         static_cast<unsigned long long>(used >> 10),
+         static_cast<unsigned long long>(budget >> 10));
+      }
+   throw J9::CompilationMemoryBudgetExceeded();
+   }
+
 TR::CompilationInfoPerThread::CompilationInfoPerThread(TR::CompilationInfo &compInfo, J9JITConfig *jitConfig, int32_t id, bool isDiagnosticThread)
                                    : TR::CompilationInfoPerThreadBase(compInfo, jitConfig, id, true),
                                      _compThreadCPU(_compInfo.persistentMemory()->getPersistentInfo(), jitConfig, 490000000, id)
@@ -1066,7 +1111,8 @@ TR::CompilationInfo::CompilationInfo(J9JITConfig *jitConfig) :
    _samplingThreadWaitTimeInDeepIdleToNotifyVM(-1),
    _numDiagnosticThreads(0),
    _numCompThreads(0),
-   _arrayOfCompilationInfoPerThread(NULL)
+   _arrayOfCompilationInfoPerThread(NULL),
+   _numQueuedEntriesForMethod(decltype(_numQueuedEntriesForMethod)::allocator_type(TR::Compiler->persistentAllocator()))
    {
    // The object is zero-initialized before this method is called
    //
@@ -1154,8 +1200,12 @@ TR::CompilationInfo::CompilationInfo(J9JITConfig *jitConfig) :
    _lowPriorityCompilationScheduler.setCompInfo(this);
    _JProfilingQueue.setCompInfo(this);
    _interpSamplTrackingInfo = new (PERSISTENT_NEW) TR_InterpreterSamplingTracking(this);
+   _startupCompilePlan = NULL; // This will be set later when the SCC is validated
 #if defined(J9VM_OPT_JITSERVER)
    _clientSessionHT = NULL; // This will be set later when options are processed
+   _JITServerAOTCache = NULL; // This will be set later when options are processed
+   _JITServerROMClassCache = NULL; // This will be set later when options are processed
+   _JITServerMetrics = NULL; // This will be set later when options are processed
    _unloadedClassesTempList = NULL;
    _illegalFinalFieldModificationList = NULL;
    _newlyExtendedClasses = NULL;
@@ -1668,9 +1718,10 @@ void TR_LowPriorityCompQueue::enqueueCompReqToLPQ(TR_MethodToBeCompiled *compReq
    }
 
 //---------------------------- createLowPriorityCompReqAndQueueIt ---------------------
-bool TR_LowPriorityCompQueue::createLowPriorityCompReqAndQueueIt(TR::IlGeneratorMethodDetails &details, void *startPC, uint8_t reason)
+bool TR_LowPriorityCompQueue::createLowPriorityCompReqAndQueueIt(TR::IlGeneratorMethodDetails &details, void *startPC, uint8_t reason,
+                                                                 TR_Hotness optLevel, TR_YesNoMaybe methodIsInSharedCache)
    {
-   TR_OptimizationPlan *plan = TR_OptimizationPlan::alloc(warm); // TODO: pick first opt level
+   TR_OptimizationPlan *plan = TR_OptimizationPlan::alloc(optLevel);
    if (!plan)
       return false; // OOM
 
@@ -1685,13 +1736,15 @@ bool TR_LowPriorityCompQueue::createLowPriorityCompReqAndQueueIt(TR::IlGenerator
    compReq->_jitStateWhenQueued = _compInfo->getPersistentInfo()->getJitState();
    compReq->_oldStartPC = startPC;
    compReq->_async = true; // app threads are not waiting for it
-
-
+   compReq->_methodIsInSharedCache = methodIsInSharedCache;
 
    // Determine entry weight
    J9Method *j9method = details.getMethod();
    J9ROMMethod * romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(j9method);
-   compReq->_weight = (J9ROMMETHOD_HAS_BACKWARDS_BRANCHES(romMethod)) ? TR::CompilationInfo::WARM_LOOPY_WEIGHT : TR::CompilationInfo::WARM_LOOPLESS_WEIGHT;
+   if (methodIsInSharedCache == TR_yes && !startPC) // first time compilations that are AOT loads
+      compReq->_weight = TR::Options::_weightOfAOTLoad;
+   else
+      compReq->_weight = (J9ROMMETHOD_HAS_BACKWARDS_BRANCHES(romMethod)) ? TR::CompilationInfo::WARM_LOOPY_WEIGHT : TR::CompilationInfo::WARM_LOOPLESS_WEIGHT;
    // add at the end of queue
    enqueueCompReqToLPQ(compReq);
    incStatsReqQueuedToLPQ(reason);
@@ -1699,12 +1752,13 @@ bool TR_LowPriorityCompQueue::createLowPriorityCompReqAndQueueIt(TR::IlGenerator
    }
 
 //------------------------ addFirstTimeReqToLPQ ---------------------
-bool TR_LowPriorityCompQueue::addFirstTimeCompReqToLPQ(J9Method *j9method, uint8_t reason)
+bool TR_LowPriorityCompQueue::addFirstTimeCompReqToLPQ(J9Method *j9method, uint8_t reason,
+                                                       TR_Hotness optLevel, TR_YesNoMaybe methodIsInSharedCache)
    {
    if (TR::CompilationInfo::isCompiled(j9method))
       return false;
    TR::IlGeneratorMethodDetails details(j9method);
-   return createLowPriorityCompReqAndQueueIt(details, NULL, reason);
+   return createLowPriorityCompReqAndQueueIt(details, NULL, reason, optLevel, methodIsInSharedCache);
    }
 
 
@@ -1850,12 +1904,40 @@ TR::CompilationInfo::incNumInvRequestsQueued(TR_MethodToBeCompiled *entry)
    entry->_entryIsCountedAsInvRequest = true; _numInvRequestsInCompQueue++;
    }
 
+void
+TR::CompilationInfo::decNumAotLoadsQueued(TR_MethodToBeCompiled *entry)
+   {
+   if (entry->_entryIsCountedAsAotLoad)
+      {
+      _numAotLoadsQueued--;
+      TR_ASSERT(_numAotLoadsQueued >= 0, "_numAotLoadsQueued is negative : %d", _numAotLoadsQueued);
+      }
+   }
+
+void
+TR::CompilationInfo::incNumAotLoadsQueued(TR_MethodToBeCompiled *entry)
+   {
+   entry->_entryIsCountedAsAotLoad = true; _numAotLoadsQueued++;
+   }
+
 void
 TR::CompilationInfo::updateCompQueueAccountingOnDequeue(TR_MethodToBeCompiled *entry)
    {
    _numQueuedMethods--; // one less method in the queue
+   entry->_freeTag &= ~ENTRY_QUEUED;
+   if (entry == _lastQueuedEntry)
+      _lastQueuedEntry = NULL;
+   J9Method *method = entry->getMethodDetails().getMethod();
+   if (method)
+      {
+      auto it = _numQueuedEntriesForMethod.find(method);
+      TR_ASSERT(it != _numQueuedEntriesForMethod.end(), "Dequeued request for method %p that is not accounted for", method);
+      if (it != _numQueuedEntriesForMethod.end() && --it->second <= 0)
+         _numQueuedEntriesForMethod.erase(it);
+      }
    decNumGCRReqestsQueued(entry);
    decNumInvReqestsQueued(entry);
+   decNumAotLoadsQueued(entry);
    if (entry->getMethodDetails().isOrdinaryMethod() && entry->_oldStartPC==0)
       {
       _numQueuedFirstTimeCompilations--;
@@ -2270,6 +2352,16 @@ bool TR::CompilationInfo::shouldRetryCompilation(TR_MethodToBeCompiled *entry, T
                   entry->_optimizationPlan->setUseSampling(false); // disable recompilation of this method
                   }
                break;
+            case compilationMemoryBudgetExceeded:
+               // Only recompilable compilations above warm are held to the budget. The method
+               // may still compile within the scratch space limit, so no failure hint is added
+               // to the shared class cache. Unlike a heap limit failure, retry at warm even when
+               // the existing body has no profiling information
+               tryCompilingAgain = true;
+               entry->_optimizationPlan->setOptLevel(warm);
+               entry->_optimizationPlan->setInsertInstrumentation(false); // prevent profiling
+               entry->_optimizationPlan->setUseSampling(false); // disable recompilation of this method
+               break;
             case compilationCHTableCommitFailure:
                tryCompilingAgain = true;
                // if we have only one more trial left, disable optimizations based on CHTable
@@ -3250,6 +3342,7 @@ void TR::CompilationInfo::stopCompilationThreads()
       {
       if (trPersistentMemory)
          trPersistentMemory->printMemStats();
+      TR::Compiler->persistentAllocator().printStatistics(stderr);
       }
 
    TR_DataCacheManager::getManager()->printStatistics();
@@ -3406,6 +3499,12 @@ void TR::CompilationInfo::stopCompilationThreads()
          iProfiler->printStats();
          }
       }
+   static char *printJITServerAOTCacheStats = feGetEnv("TR_PrintJITServerAOTCacheStats");
+   if (printJITServerAOTCacheStats && getJITServerAOTCache())
+      getJITServerAOTCache()->printStats();
+   static char *printJITServerROMClassCacheStats = feGetEnv("TR_PrintJITServerROMClassCacheStats");
+   if (printJITServerROMClassCacheStats && getJITServerROMClassCache())
+      getJITServerROMClassCache()->printStats();
    static char *printJITServerConnStats = feGetEnv("TR_PrintJITServerConnStats");
    if (printJITServerConnStats)
       {
@@ -3805,6 +3904,9 @@ TR::CompilationInfoPerThread::run()
 #if defined(J9VM_OPT_JITSERVER)
    TR::compInfoPT = this; // set the thread_local pointer to this object on first run
 #endif
+   // Compilation threads are the heaviest users of persistent memory;
+   // let them allocate small blocks without contending on the shared free lists
+   TR::Compiler->persistentAllocator().enableThreadCache();
    for (
       CompilationThreadState threadState = getCompilationThreadState();
       threadState != COMPTHREAD_SIGNAL_TERMINATE;
@@ -3835,6 +3937,7 @@ TR::CompilationInfoPerThread::run()
             }
          }
       }
+   TR::Compiler->persistentAllocator().releaseThreadCache();
    }
 
 void
@@ -3884,7 +3987,7 @@ TR::CompilationInfoPerThread::initializeSegmentCache(J9::J9SegmentProvider &segm
       {
       try
          {
-         J9::J9SegmentCache segmentCache(1 << 24, segmentProvider);
+         J9::J9SegmentCache segmentCache(1 << 24, segmentProvider, TR::Options::getScratchSegmentPoolSize());
          return segmentCache;
          }
       catch (const std::bad_alloc &allocationFailure)
@@ -3897,7 +4000,7 @@ TR::CompilationInfoPerThread::initializeSegmentCache(J9::J9SegmentProvider &segm
       }
    try
       {
-      J9::J9SegmentCache segmentCache(1 << 21, segmentProvider);
+      J9::J9SegmentCache segmentCache(1 << 21, segmentProvider, TR::Options::getScratchSegmentPoolSize());
       return segmentCache;
       }
    catch (const std::bad_alloc &allocationFailure)
@@ -4324,6 +4427,7 @@ TR::CompilationInfoPerThread::processEntry(TR_MethodToBeCompiled &entry, J9::J9S
       --entry._compilationAttemptsLeft;
       entry._hasIncrementedNumCompThreadsCompilingHotterMethods = false; // re-initialize
       entry._GCRrequest = false; // pretend it's not GCR
+      entry._entryIsCountedAsAotLoad = false; // the retrial may no longer be an AOT load
       entry._reqFromSecondaryQueue = TR_MethodToBeCompiled::REASON_NONE; // we are going to put this into the main queue, so entry is not coming from LPQ anymore
       // TODO: the following is needed or otherwise we will wrongly increase the Q weight when extracting it again
       // However, we lose our _reqFromJProfilingQueue flag so we will not insert profiling trees
@@ -4615,12 +4719,19 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
          }
       }
 
-   for (prev = NULL, cur = _methodQueue; cur; prev = cur, cur = cur->_next)
+   // Only walk the queue if it can contain a request for this method. With thousands of
+   // queued requests at startup the walk dominates the time the compilation monitor is held
+   J9Method *requestedMethod = details.getMethod();
+   bool queueWasScanned = !requestedMethod || _numQueuedEntriesForMethod.find(requestedMethod) != _numQueuedEntriesForMethod.end();
+   if (queueWasScanned)
       {
-      numEntries++;
-      queueWeight += cur->_weight;
-      if (cur->getMethodDetails().sameAs(details, fe))
-         break;
+      for (prev = NULL, cur = _methodQueue; cur; prev = cur, cur = cur->_next)
+         {
+         numEntries++;
+         queueWeight += cur->_weight;
+         if (cur->getMethodDetails().sameAs(details, fe))
+            break;
+         }
       }
 
    // NOTE: we do not need to search the methodPool since we cannot reach here if an entry
@@ -4672,14 +4783,14 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
    //
    else
       {
-      if (queueWeight != _queueWeight) //QW
+      if (queueWasScanned && queueWeight != _queueWeight) //QW
          {
          if (TR::Options::isAnyVerboseOptionSet())
             TR_VerboseLog::writeLineLocked(TR_Vlog_INFO, "Discrepancy for queue weight while adding to queue: computed=%u recorded=%u\n", queueWeight, _queueWeight);
          // correction
          _queueWeight = queueWeight;
          }
-      if (numEntries != _numQueuedMethods)
+      if (queueWasScanned && numEntries != _numQueuedMethods)
          {
          if (TR::Options::isAnyVerboseOptionSet())
             TR_VerboseLog::writeLineLocked(TR_Vlog_INFO, "Discrepancy for queue size while adding to queue: Before adding numEntries=%d  _numQueuedMethods=%d\n", numEntries, _numQueuedMethods);
@@ -4749,7 +4860,10 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
       if (!details.isOrdinaryMethod() || details.isNewInstanceThunk() || isJNINativeMethodRequest)
          entryWeight = THUNKS_WEIGHT; // 1
       else if (methodIsInSharedCache == TR_yes && !pc) // first time compilations that are AOT loads
+         {
          entryWeight = TR::Options::_weightOfAOTLoad;
+         incNumAotLoadsQueued(cur);
+         }
       else if (optimizationPlan->getOptLevel() == warm) // most common case first
          {
          // Compilation may be downgraded to cold during classLoadPhase
@@ -4875,9 +4989,28 @@ void TR::CompilationInfo::queueEntry(TR_MethodToBeCompiled *entry)
    {
    TR_ASSERT_FATAL(entry->_freeTag & ENTRY_INITIALIZED, "queuing an entry which is not initialized\n");
 
+   // Entries that are only re-positioned in the queue are already accounted for
+   if (!(entry->_freeTag & ENTRY_QUEUED))
+      {
+      J9Method *method = entry->getMethodDetails().getMethod();
+      if (method)
+         _numQueuedEntriesForMethod[method]++;
+      }
    entry->_freeTag |= ENTRY_QUEUED;
 
-   if (!_methodQueue || _methodQueue->_priority < entry->_priority)
+   // Requests tend to arrive in bursts of the same priority. If the previously queued
+   // entry is still the last one with a priority at least as high as the new entry,
+   // insert right after it instead of walking the queue from the start.
+   TR_MethodToBeCompiled *hint = _lastQueuedEntry;
+   _lastQueuedEntry = entry;
+   if (hint && hint != entry &&
+       hint->_priority >= entry->_priority &&
+       (!hint->_next || hint->_next->_priority < entry->_priority))
+      {
+      entry->_next = hint->_next;
+      hint->_next = entry;
+      }
+   else if (!_methodQueue || _methodQueue->_priority < entry->_priority)
       {
       entry->_next = _methodQueue;
       _methodQueue = entry;
@@ -4896,6 +5029,63 @@ void TR::CompilationInfo::queueEntry(TR_MethodToBeCompiled *entry)
       }
    }
 
+#if defined(J9VM_OPT_JITSERVER)
+//------------------------- getNextOutOfProcessEntry -------------------------
+// Dequeue the request of the client that currently occupies the fewest
+// compilation threads, so that a client flooding the server cannot starve
+// the others. Requests of equally loaded clients are taken in queue order,
+// which makes this a round-robin between clients. Streams that have not sent
+// a request yet belong to an unknown client and are treated as idle.
+// When physical memory is low, a client that already has a compilation in
+// progress is not given another thread; the request stays queued until a
+// compilation completes. Must have compilationQueueMonitor in hand
+//----------------------------------------------------------------------------
+TR_MethodToBeCompiled *
+TR::CompilationInfo::getNextOutOfProcessEntry(TR_CompThreadActions *compThreadAction)
+   {
+   TR_MethodToBeCompiled *best = NULL;
+   TR_MethodToBeCompiled *bestPrev = NULL;
+   int32_t bestLoad = INT_MAX;
+   TR_MethodToBeCompiled *prev = NULL;
+   for (TR_MethodToBeCompiled *cur = _methodQueue; cur && cur->_priority == _methodQueue->_priority; prev = cur, cur = cur->_next)
+      {
+      int32_t load = 0;
+      if (cur->_stream && cur->_stream->getClientId())
+         {
+         ClientSessionData *clientSession = getClientSessionHT()->peekClientSession(cur->_stream->getClientId());
+         if (clientSession)
+            load = clientSession->getInUse();
+         }
+      if (load < bestLoad)
+         {
+         best = cur;
+         bestPrev = prev;
+         bestLoad = load;
+         if (load == 0)
+            break;
+         }
+      }
+
+   if (bestLoad > 0)
+      {
+      bool incompleteInfo;
+      uint64_t freePhysicalMemorySizeB = computeAndCacheFreePhysicalMemory(incompleteInfo);
+      if (freePhysicalMemorySizeB != OMRPORT_MEMINFO_NOT_AVAILABLE &&
+          freePhysicalMemorySizeB <= (uint64_t)TR::Options::getSafeReservePhysicalMemoryValue() + TR::Options::getScratchSpaceLowerBound())
+         {
+         *compThreadAction = GO_TO_SLEEP_CONCURRENT_EXPENSIVE_REQUESTS;
+         return NULL;
+         }
+      }
+
+   if (bestPrev)
+      bestPrev->_next = best->_next;
+   else
+      _methodQueue = best->_next;
+   return best;
+   }
+#endif /* defined(J9VM_OPT_JITSERVER) */
+
 //--------------------------------- requeue ----------------------------------
 // Put the request that is currently being compiled, back into the queue
 // and increment the number of queued methods
@@ -4908,6 +5098,8 @@ void TR::CompilationInfoPerThread::requeue()
        _compInfo._numQueuedFirstTimeCompilations++;
    if (_methodBeingCompiled->_entryIsCountedAsInvRequest)
       _compInfo.incNumInvRequestsQueued(_methodBeingCompiled);
+   if (_methodBeingCompiled->_entryIsCountedAsAotLoad)
+      _compInfo.incNumAotLoadsQueued(_methodBeingCompiled);
    _methodBeingCompiled->_compErrCode = compilationOK; // reset the error code
    _compInfo.queueEntry(_methodBeingCompiled);
    _methodBeingCompiled = NULL;
@@ -5150,6 +5342,16 @@ TR::CompilationInfo::getNextMethodToBeCompiled(TR::CompilationInfoPerThread *com
    *compThreadAction = PROCESS_ENTRY;
    if (_methodQueue)
       {
+#if defined(J9VM_OPT_JITSERVER)
+      // Share the compilation threads fairly between the clients of this server
+      if (getPersistentInfo()->getRemoteCompilationMode() == JITServer::SERVER &&
+          getPersistentInfo()->getJITServerUseFairScheduling() &&
+          !compInfoPT->isDiagnosticThread())
+         {
+         m = getNextOutOfProcessEntry(compThreadAction);
+         }
+      else
+#endif /* defined(J9VM_OPT_JITSERVER) */
       // If the request is sync or AOT load or InstantReplay, take it now
       if (compInfoPT->isDiagnosticThread() // InstantReplay compilations must be processed immediately
           || _methodQueue->_priority >= CP_SYNC_MIN // sync comp
@@ -7760,6 +7962,7 @@ TR::CompilationInfoPerThreadBase::compile(J9VMThread * vmThread,
             static_cast<TR::SegmentAllocator &>(defaultSegmentProvider);
       TR::Region dispatchRegion(regionSegmentProvider, rawAllocator);
       TR_Memory trMemory(*_compInfo.persistentMemory(), dispatchRegion);
+      _scratchSegmentProvider = &regionSegmentProvider;
 
       preCompilationTasks(vmThread, entry,
                           method, &aotCachedMethod, trMemory,
@@ -7851,9 +8054,11 @@ TR::CompilationInfoPerThreadBase::compile(J9VMThread * vmThread,
                                      aotCachedMethod, metaData,
                                      canDoRelocatableCompile, eligibleForRelocatableCompile,
                                      reloRuntime);
+      _scratchSegmentProvider = NULL;
       }
    catch (const std::exception &e)
       {
+      _scratchSegmentProvider = NULL;
       entry->_compErrCode = compilationFailure;
 
       if (TR::Options::isAnyVerboseOptionSet(TR_VerboseCompileEnd, TR_VerboseCompFailure, TR_VerbosePerformance))
@@ -8815,6 +9020,16 @@ TR::CompilationInfoPerThreadBase::wrappedCompile(J9PortLibrary *portLib, void *
          }
       }
 
+   // Record first time compilations and AOT loads performed during startup
+   // so that they can be replayed through the LPQ in subsequent runs
+   TR_StartupCompilePlan *startupCompilePlan = that->getCompilationInfo()->getStartupCompilePlan();
+   if (metaData && sc && startupCompilePlan && startupCompilePlan->isRecording() &&
+       !that->_methodBeingCompiled->_oldStartPC && !that->_methodBeingCompiled->isDLTCompile() &&
+       jitConfig->javaVM->phase != J9VM_PHASE_NOT_STARTUP)
+      {
+      startupCompilePlan->recordCompilation(sc, that->_methodBeingCompiled);
+      }
+
    return metaData;
    }
 
@@ -10947,6 +11162,10 @@ TR::CompilationInfoPerThreadBase::processException(
       {
       _methodBeingCompiled->_compErrCode = compilationLowPhysicalMemory;
       }
+   catch (const J9::CompilationMemoryBudgetExceeded &e)
+      {
+      _methodBeingCompiled->_compErrCode = compilationMemoryBudgetExceeded;
+      }
    catch (const std::bad_alloc &e)
       {
       _methodBeingCompiled->_compErrCode = compilationHeapLimitExceeded;
@@ -11886,8 +12105,8 @@ TR_LowPriorityCompQueue::TR_LowPriorityCompQueue()
    : _firstLPQentry(NULL), _lastLPQentry(NULL), _sizeLPQ(0), _LPQWeight(0),
      _trackingEnabled(false), _spine(NULL), _STAT_compReqQueuedByIProfiler(0), _STAT_conflict(0),
      _STAT_staleScrubbed(0), _STAT_bypass(0), _STAT_compReqQueuedByJIT(0), _STAT_LPQcompFromIprofiler(0),
-     _STAT_LPQcompFromInterpreter(0), _STAT_LPQcompUpgrade(0), _STAT_compReqQueuedByInterpreter(0),
-     _STAT_numFailedToEnqueueInLPQ(0)
+     _STAT_LPQcompFromInterpreter(0), _STAT_LPQcompUpgrade(0), _STAT_LPQcompFromCompilePlan(0),
+     _STAT_compReqQueuedByInterpreter(0), _STAT_compReqQueuedByCompilePlan(0), _STAT_numFailedToEnqueueInLPQ(0)
    {
    }
 
@@ -12144,6 +12363,8 @@ void TR_LowPriorityCompQueue::incStatsCompFromLPQ(uint8_t reason)
          _STAT_LPQcompFromInterpreter++; break;
       case TR_MethodToBeCompiled::REASON_UPGRADE:
          _STAT_LPQcompUpgrade++; break;
+      case TR_MethodToBeCompiled::REASON_COMPILE_PLAN:
+         _STAT_LPQcompFromCompilePlan++; break;
       default:
          TR_ASSERT(false, "No other known reason for LPQ compilations\n");
       }
@@ -12158,6 +12379,8 @@ void TR_LowPriorityCompQueue::incStatsReqQueuedToLPQ(uint8_t reason)
          _STAT_compReqQueuedByInterpreter++; break;
       case TR_MethodToBeCompiled::REASON_UPGRADE:
          _STAT_compReqQueuedByJIT++; break;
+      case TR_MethodToBeCompiled::REASON_COMPILE_PLAN:
+         _STAT_compReqQueuedByCompilePlan++; break;
       default:
          TR_ASSERT(false, "No other known reason for LPQ compilations\n");
       }
@@ -12167,12 +12390,12 @@ void TR_LowPriorityCompQueue::printStats() const
    {
    fprintf(stderr, "Stats for LPQ:\n");
 
-   fprintf(stderr, "   Requests for LPQ = %4u (Sources: IProfiler=%3u Interpreter=%3u JIT=%3u)\n",
-      _STAT_compReqQueuedByIProfiler + _STAT_compReqQueuedByInterpreter + _STAT_compReqQueuedByJIT,
-      _STAT_compReqQueuedByIProfiler, _STAT_compReqQueuedByInterpreter, _STAT_compReqQueuedByJIT);
-   fprintf(stderr, "   Comps.  from LPQ = %4u (Sources: IProfiler=%3u Interpreter=%3u JIT=%3u)\n",
-      _STAT_LPQcompFromIprofiler + _STAT_LPQcompFromInterpreter + _STAT_LPQcompUpgrade,
-      _STAT_LPQcompFromIprofiler, _STAT_LPQcompFromInterpreter, _STAT_LPQcompUpgrade);
+   fprintf(stderr, "   Requests for LPQ = %4u (Sources: IProfiler=%3u Interpreter=%3u JIT=%3u CompilePlan=%3u)\n",
+      _STAT_compReqQueuedByIProfiler + _STAT_compReqQueuedByInterpreter + _STAT_compReqQueuedByJIT + _STAT_compReqQueuedByCompilePlan,
+      _STAT_compReqQueuedByIProfiler, _STAT_compReqQueuedByInterpreter, _STAT_compReqQueuedByJIT, _STAT_compReqQueuedByCompilePlan);
+   fprintf(stderr, "   Comps.  from LPQ = %4u (Sources: IProfiler=%3u Interpreter=%3u JIT=%3u CompilePlan=%3u)\n",
+      _STAT_LPQcompFromIprofiler + _STAT_LPQcompFromInterpreter + _STAT_LPQcompUpgrade + _STAT_LPQcompFromCompilePlan,
+      _STAT_LPQcompFromIprofiler, _STAT_LPQcompFromInterpreter, _STAT_LPQcompUpgrade, _STAT_LPQcompFromCompilePlan);
 
    fprintf(stderr, "   Conflicts        = %4u (tried to cache j9method that didn't have space)\n", _STAT_conflict);
    fprintf(stderr, "   Stale entries    = %4u\n", _STAT_staleScrubbed); // we want very few of these, hopefully 0
@@ -12934,6 +13157,12 @@ TR::CompilationInfo::requeueOutOfProcessEntry(TR_MethodToBeCompiled *entry)
    if (feGetEnv("TR_EnableJITServerPerCompConn"))
       return;
 
+   // With event-driven I/O, the listener thread watches the idle connection and queues
+   // the stream only when the client sends its next request
+   TR_Listener *listener = ((TR_JitPrivateConfig*)(_jitConfig->privateConfig))->listener;
+   if (entry->_stream && listener && listener->waitForNextRequest(entry->_stream))
+      return;
+
    if (entry->_stream && addOutOfProcessMethodToBeCompiled(entry->_stream))
       {
       // successfully queued the new entry, so notify a thread
@@ -236,6 +236,13 @@ class CompilationInfoPerThreadBase
       };
 
    uint8_t                compilationShouldBeInterrupted() const { return _compilationShouldBeInterrupted; }
+   /**
+      @brief Abandon the compilation in progress by throwing J9::CompilationMemoryBudgetExceeded
+             if its scratch memory use has crossed the compilation memory budget, so that
+             it is retried at warm before the scratch space limit or the physical memory
+             of the machine is exhausted
+    */
+   void                   checkCompilationMemoryBudget(TR::Compilation *comp);
    void                   setCompilationShouldBeInterrupted(uint8_t reason) { _compilationShouldBeInterrupted = reason; }
    TR_DataCache*          reservedDataCache() { return _reservedDataCache; }
    void                   setReservedDataCache(TR_DataCache *dataCache) { _reservedDataCache = dataCache; }
@@ -286,6 +293,7 @@ class CompilationInfoPerThreadBase
    TR_MethodToBeCompiled *      _methodBeingCompiled;
    TR::Compilation *            _compiler;
    TR_MethodMetaData *          _metadata;
+   TR::SegmentAllocator *       _scratchSegmentProvider; // of the compilation in progress, if any
    TR_DataCache *               _reservedDataCache;
    uintptr_t                    _timeWhenCompStarted;
    int32_t                      _numJITCompilations; // num JIT compilations this thread has performed; AOT loads not counted
@@ -70,6 +70,7 @@
 #include "control/MethodToBeCompiled.hpp"
 #include "control/CompilationRuntime.hpp"
 #include "control/CompilationThread.hpp"
+#include "control/StartupCompilePlan.hpp"
 #include "env/VMJ9.h"
 #include "env/j9method.h"
 #include "env/ut_j9jit.h"
@@ -2281,6 +2282,7 @@ void jitClassesRedefined(J9VMThread * currentThread, UDATA classCount, J9JITRede
    // need to get the compilation lock before updating the queue
    fe->acquireCompilationLock();
    compInfo->setAllCompilationsShouldBeInterrupted();
+   compInfo->getPersistentInfo()->incGlobalClassRedefinitionID();
    J9JITRedefinedClass *classPair = classList;
    if (!TR::Options::getCmdLineOptions()->getOption(TR_FullSpeedDebug))
       {
@@ -3696,6 +3698,13 @@ static void jitHookClassInitialize(J9HookInterface * * hookInterface, UDATA even
       return; // if a hook gets called after freeJitConfig then not much else we can do
 
    loadingClasses = false;
+
+   // Queue the methods of this class that were compiled during startup in a previous run
+   TR::CompilationInfo * compInfo = TR::CompilationInfo::get(jitConfig);
+   TR_StartupCompilePlan *startupCompilePlan = compInfo->getStartupCompilePlan();
+   if (startupCompilePlan && startupCompilePlan->isReplaying() &&
+       vmThread->javaVM->phase != J9VM_PHASE_NOT_STARTUP)
+      startupCompilePlan->replayClass(vmThread, cl, compInfo);
    }
 
 int32_t returnIprofilerState()
@@ -4673,6 +4682,11 @@ static void jitStateLogic(J9JITConfig * jitConfig, TR::CompilationInfo * compInf
          // Release AOT data caches to normal compilations
          TR_DataCacheManager::getManager()->startupOver();
 
+         // Persist the compilations recorded during startup so that the next run can replay them
+         TR_StartupCompilePlan *startupCompilePlan = compInfo->getStartupCompilePlan();
+         if (startupCompilePlan && startupCompilePlan->isRecording())
+            startupCompilePlan->store(javaVM->internalVMFunctions->currentVMThread(javaVM));
+
          // Logic related to IdleCPU exploitation
          // If we are in idle mode immediately after JVM exited startup mode, set specific flag
          if (newState == IDLE_STATE)
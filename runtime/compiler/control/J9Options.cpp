@@ -90,6 +90,7 @@ int32_t J9::Options::_relaxedCompilationLimitsSampleThreshold = 120; // normally
 int32_t J9::Options::_sampleThresholdVariationAllowance = 30;
 
 int32_t J9::Options::_maxCheckcastProfiledClassTests = 3;
+int32_t J9::Options::_maxPolymorphicInlinedTargets = 3;
 int32_t J9::Options::_maxOnsiteCacheSlotForInstanceOf = 0; // Setting this value to zero will disable onsite cache in instanceof.
 int32_t J9::Options::_cpuEntitlementForConservativeScorching = 801; // 801 means more than 800%, i.e. 8 cpus
                                                                     // A very large number disables the feature
@@ -165,6 +166,7 @@ int32_t J9::Options::_compYieldStatsHeartbeatPeriod = 0; // ms
 int32_t J9::Options::_numberOfUserClassesLoaded = 0;
 int32_t J9::Options::_compPriorityQSZThreshold = 200;
 int32_t J9::Options::_numQueuedInvReqToDowngradeOptLevel = 20; // If more than 20 inv req are queued we compiled them at cold
+int32_t J9::Options::_numQueuedAOTLoadsPerCompThread = 0; // 0 disables activation of comp threads based on queued AOT loads
 int32_t J9::Options::_qszThresholdToDowngradeOptLevel = -1; // not yet set
 int32_t J9::Options::_qsziThresholdToDowngradeDuringCLP = 0; // -1 or 0 disables the feature and reverts to old behavior
 int32_t J9::Options::_qszThresholdToDowngradeOptLevelDuringStartup = 100000; // a large number disables the feature
@@ -192,6 +194,7 @@ int32_t J9::Options::_waitTimeToStartIProfiler = 1000; // ms
 int32_t J9::Options::_compilationDelayTime = 0; // sec; 0 means disabled
 
 int32_t J9::Options::_invocationThresholdToTriggerLowPriComp = 250;
+int32_t J9::Options::_startupCompilePlanSize = 0; // 0 disables recording and replay of the startup compile plan
 
 int32_t J9::Options::_aotMethodThreshold = 200;
 int32_t J9::Options::_aotMethodCompilesThreshold = 200;
@@ -252,6 +255,8 @@ int32_t J9::Options::_updateFreeMemoryMinPeriod = 500;  // 500 ms
 size_t J9::Options::_scratchSpaceLimitKBWhenLowVirtualMemory = 64*1024; // 64MB; currently, only used on 32 bit Windows
 
 int32_t J9::Options::_scratchSpaceFactorWhenJSR292Workload = JSR292_SCRATCH_SPACE_FACTOR;
+int32_t J9::Options::_compilationMemoryBudgetPercentage = 90;
+int32_t J9::Options::_scratchSegmentPoolSize = 4;
 int32_t J9::Options::_lowVirtualMemoryMBThreshold = 300; // Used on 32 bit Windows, Linux, 31 bit z/OS, Linux
 int32_t J9::Options::_safeReservePhysicalMemoryValue = 32 << 20;  // 32 MB
 
@@ -713,6 +718,9 @@ TR::OptionTable OMR::Options::_feOptions[] = {
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_compilationDelayTime, 0, " %d", NOT_IN_SUBSET },
    {"compilationExpirationTime=", "R<nnn>\tnumber of seconds after which point we will stop compiling",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_compilationExpirationTime, 0, " %d", NOT_IN_SUBSET},
+   {"compilationMemoryBudgetPercentage=", "M<nnn>\tpercentage of the scratch space limit that a compilation above warm may use "
+                                          "before it is abandoned and retried at a lower opt level; 100 or more disables",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_compilationMemoryBudgetPercentage, 0, "F%d", NOT_IN_SUBSET},
    {"compilationPriorityQSZThreshold=", "M<nnn>\tCompilation queue size threshold when priority of post-profiling"
                                "compilation requests is increased",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_compPriorityQSZThreshold , 0, "F%d", NOT_IN_SUBSET},
@@ -892,6 +900,9 @@ TR::OptionTable OMR::Options::_feOptions[] = {
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_maxCheckcastProfiledClassTests, 0, "%d", NOT_IN_SUBSET},
    {"maxOnsiteCacheSlotForInstanceOf=", "R<nnn>\tnumber of onsite cache slots for instanceOf",
       TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_maxOnsiteCacheSlotForInstanceOf, 0, "%d", NOT_IN_SUBSET},
+   {"maxPolymorphicInlinedTargets=", "R<nnn>\tmaximum number of profiled receiver types inlined, each behind its own guard, "
+                                     "at a virtual or interface call site in hot compilations; 1 or less inlines a single profiled target",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_maxPolymorphicInlinedTargets, 0, "%d", NOT_IN_SUBSET},
    {"minSamplingPeriod=", "R<nnn>\tminimum number of milliseconds between samples for hotness",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_minSamplingPeriod, 0, "P%d", NOT_IN_SUBSET},
    {"minSuperclassArraySize=", "I<nnn>\t set the size of the minimum superclass array size",
@@ -905,6 +916,8 @@ TR::OptionTable OMR::Options::_feOptions[] = {
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_numFirstTimeCompilationsToExitIdleMode, 0, "F%d", NOT_IN_SUBSET },
    {"profileAllTheTime=",    "R<nnn>\tInterpreter profiling will be on all the time",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_profileAllTheTime, 0, " %d", NOT_IN_SUBSET},
+   {"queuedAOTLoadsPerCompThread=", "M<nnn>\tActivate another compilation thread when more than this many AOT loads are queued for each active thread; 0 disables",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_numQueuedAOTLoadsPerCompThread, 0, "F%d", NOT_IN_SUBSET},
    {"queuedInvReqThresholdToDowngradeOptLevel=", "M<nnn>\tDowngrade opt level if too many inv req",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_numQueuedInvReqToDowngradeOptLevel , 0, "F%d", NOT_IN_SUBSET},
    {"queueSizeThresholdToDowngradeDuringCLP=", "M<nnn>\tCompilation queue size threshold (interpreted methods) when opt level is downgraded during class load phase",
@@ -939,6 +952,8 @@ TR::OptionTable OMR::Options::_feOptions[] = {
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_samplingThreadExpirationTime, 0, " %d", NOT_IN_SUBSET},
    {"scorchingSampleThreshold=", "R<nnn>\tThe maximum number of global samples taken during a sample interval for which the method will be recompiled as scorching",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_scorchingSampleThreshold, 0, " %d", NOT_IN_SUBSET},
+   {"scratchSegmentPoolSize=", "M<nnn>\tnumber of idle scratch segments each compilation thread keeps for reuse by later compilations",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_scratchSegmentPoolSize, 0, "F%d", NOT_IN_SUBSET},
    {"scratchSpaceFactorWhenJSR292Workload=","M<nnn>\tMultiplier for scratch space limit when MethodHandles are in use",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_scratchSpaceFactorWhenJSR292Workload, 0, "F%d", NOT_IN_SUBSET},
    {"scratchSpaceLimitKBWhenLowVirtualMemory=","M<nnn>\tLimit for memory used by JIT when running on low virtual memory",
@@ -957,6 +972,9 @@ TR::OptionTable OMR::Options::_feOptions[] = {
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_smallMethodBytecodeSizeThresholdForCold, 0, "F%d", NOT_IN_SUBSET},
    {"stack=",             "C<nnn>\tcompilation thread stack size in KB",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_stackSize, 0, " %d", NOT_IN_SUBSET},
+   {"startupCompilePlanSize=", "M<nnn>\tmaximum number of startup compilations recorded in the shared class cache "
+                               "and replayed through the low priority queue in subsequent runs; 0 disables the feature",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_startupCompilePlanSize, 0, "F%d", NOT_IN_SUBSET},
 #if defined(J9VM_OPT_JITSERVER)
    {"statisticsFrequency=", "R<nnn>\tnumber of milliseconds between statistics print",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_statisticsFrequency, 0, "F%d", NOT_IN_SUBSET},
@@ -1075,12 +1093,18 @@ static void JITServerParseCommonOptions(J9JavaVM *vm, TR::CompilationInfo *compI
    const char *xxJITServerSSLKeyOption = "-XX:JITServerSSLKey=";
    const char *xxJITServerSSLCertOption = "-XX:JITServerSSLCert=";
    const char *xxJITServerSSLRootCertsOption = "-XX:JITServerSSLRootCerts=";
+   const char *xxJITServerUseCompressionOption = "-XX:+JITServerUseCompression";
+   const char *xxDisableJITServerUseCompressionOption = "-XX:-JITServerUseCompression";
+   const char *xxJITServerCompressionThresholdOption = "-XX:JITServerCompressionThreshold=";
 
    int32_t xxJITServerPortArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerPortOption, 0);
    int32_t xxJITServerTimeoutArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerTimeoutOption, 0);
    int32_t xxJITServerSSLKeyArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerSSLKeyOption, 0);
    int32_t xxJITServerSSLCertArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerSSLCertOption, 0);
    int32_t xxJITServerSSLRootCertsArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerSSLRootCertsOption, 0);
+   int32_t xxJITServerUseCompressionArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerUseCompressionOption, 0);
+   int32_t xxDisableJITServerUseCompressionArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxDisableJITServerUseCompressionOption, 0);
+   int32_t xxJITServerCompressionThresholdArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerCompressionThresholdOption, 0);
 
    if (xxJITServerPortArgIndex >= 0)
       {
@@ -1123,6 +1147,18 @@ static void JITServerParseCommonOptions(J9JavaVM *vm, TR::CompilationInfo *compI
       if (!cert.empty())
          compInfo->setJITServerSslRootCerts(cert);
       }
+
+   // Compression is used only when both the client and the server enable it
+   if (xxJITServerUseCompressionArgIndex > xxDisableJITServerUseCompressionArgIndex)
+      compInfo->getPersistentInfo()->setJITServerUseCompression(true);
+
+   if (xxJITServerCompressionThresholdArgIndex >= 0)
+      {
+      uint32_t threshold = 0;
+      IDATA ret = GET_INTEGER_VALUE(xxJITServerCompressionThresholdArgIndex, xxJITServerCompressionThresholdOption, threshold);
+      if (ret == OPTION_OK)
+         compInfo->getPersistentInfo()->setJITServerCompressionThreshold(threshold);
+      }
    }
 #endif /* defined(J9VM_OPT_JITSERVER) */
 
@@ -1984,6 +2020,82 @@ J9::Options::fePreProcess(void * base)
          // Increase the default timeout value for JITServer.
          // It can be overridden with -XX:JITServerTimeout= option in JITServerParseCommonOptions().
          compInfo->getPersistentInfo()->setSocketTimeout(30000);
+
+         // Check option -XX:+JITServerUseAOTCache
+         // -XX:-JITServerUseAOTCache disables sharing of AOT bodies between clients
+         const char *xxJITServerUseAOTCacheOption = "-XX:+JITServerUseAOTCache";
+         const char *xxDisableJITServerUseAOTCacheOption = "-XX:-JITServerUseAOTCache";
+         const char *xxJITServerAOTCacheMaxKBOption = "-XX:JITServerAOTCacheMaxKB=";
+
+         int32_t xxJITServerUseAOTCacheArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerUseAOTCacheOption, 0);
+         int32_t xxDisableJITServerUseAOTCacheArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxDisableJITServerUseAOTCacheOption, 0);
+         int32_t xxJITServerAOTCacheMaxKBArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerAOTCacheMaxKBOption, 0);
+
+         if (xxJITServerUseAOTCacheArgIndex > xxDisableJITServerUseAOTCacheArgIndex)
+            compInfo->getPersistentInfo()->setJITServerUseAOTCache(true);
+
+         if (xxJITServerAOTCacheMaxKBArgIndex >= 0)
+            {
+            uint32_t maxKB = 0;
+            IDATA ret = GET_INTEGER_VALUE(xxJITServerAOTCacheMaxKBArgIndex, xxJITServerAOTCacheMaxKBOption, maxKB);
+            if (ret == OPTION_OK)
+               compInfo->getPersistentInfo()->setJITServerAOTCacheMaxBytes((size_t)maxKB * 1024);
+            }
+
+         // Check option -XX:+JITServerUseEventDrivenIO
+         // Idle client connections are then watched by the listener thread instead of a compilation thread
+         const char *xxJITServerUseEventDrivenIOOption = "-XX:+JITServerUseEventDrivenIO";
+         const char *xxDisableJITServerUseEventDrivenIOOption = "-XX:-JITServerUseEventDrivenIO";
+
+         int32_t xxJITServerUseEventDrivenIOArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerUseEventDrivenIOOption, 0);
+         int32_t xxDisableJITServerUseEventDrivenIOArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxDisableJITServerUseEventDrivenIOOption, 0);
+
+         if (xxJITServerUseEventDrivenIOArgIndex > xxDisableJITServerUseEventDrivenIOArgIndex)
+            compInfo->getPersistentInfo()->setJITServerUseEventDrivenIO(true);
+
+         // Check option -XX:+JITServerShareROMClasses
+         // -XX:JITServerROMClassCacheFile=<path> also persists the shared ROM classes across server restarts
+         const char *xxJITServerShareROMClassesOption = "-XX:+JITServerShareROMClasses";
+         const char *xxDisableJITServerShareROMClassesOption = "-XX:-JITServerShareROMClasses";
+         const char *xxJITServerROMClassCacheFileOption = "-XX:JITServerROMClassCacheFile=";
+
+         int32_t xxJITServerShareROMClassesArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerShareROMClassesOption, 0);
+         int32_t xxDisableJITServerShareROMClassesArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxDisableJITServerShareROMClassesOption, 0);
+         int32_t xxJITServerROMClassCacheFileArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerROMClassCacheFileOption, 0);
+
+         if (xxJITServerROMClassCacheFileArgIndex >= 0)
+            {
+            char *fileName = NULL;
+            GET_OPTION_VALUE(xxJITServerROMClassCacheFileArgIndex, '=', &fileName);
+            compInfo->getPersistentInfo()->setJITServerROMClassCacheFile(fileName);
+            }
+
+         if ((xxJITServerShareROMClassesArgIndex > xxDisableJITServerShareROMClassesArgIndex) ||
+             ((xxJITServerROMClassCacheFileArgIndex >= 0) && (xxDisableJITServerShareROMClassesArgIndex < 0)))
+            compInfo->getPersistentInfo()->setJITServerUseROMClassCache(true);
+
+         // Check option -XX:JITServerMetricsFile=<path>
+         // Metrics are only collected if this option is specified
+         const char *xxJITServerMetricsFileOption = "-XX:JITServerMetricsFile=";
+         int32_t xxJITServerMetricsFileArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerMetricsFileOption, 0);
+
+         if (xxJITServerMetricsFileArgIndex >= 0)
+            {
+            char *fileName = NULL;
+            GET_OPTION_VALUE(xxJITServerMetricsFileArgIndex, '=', &fileName);
+            compInfo->getPersistentInfo()->setJITServerMetricsFile(fileName);
+            }
+
+         // Check option -XX:+JITServerUseFairScheduling
+         // Compilation threads are then shared fairly between clients instead of in arrival order
+         const char *xxJITServerUseFairSchedulingOption = "-XX:+JITServerUseFairScheduling";
+         const char *xxDisableJITServerUseFairSchedulingOption = "-XX:-JITServerUseFairScheduling";
+
+         int32_t xxJITServerUseFairSchedulingArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerUseFairSchedulingOption, 0);
+         int32_t xxDisableJITServerUseFairSchedulingArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxDisableJITServerUseFairSchedulingOption, 0);
+
+         if (xxJITServerUseFairSchedulingArgIndex > xxDisableJITServerUseFairSchedulingArgIndex)
+            compInfo->getPersistentInfo()->setJITServerUseFairScheduling(true);
          }
       else
          {
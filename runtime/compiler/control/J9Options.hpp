@@ -97,6 +97,8 @@ class OMR_EXTENSIBLE Options : public OMR::OptionsConnector
    
    static int32_t _maxCheckcastProfiledClassTests;
    static int32_t getCheckcastMaxProfiledClassTests() {return _maxCheckcastProfiledClassTests;}
+   static int32_t _maxPolymorphicInlinedTargets;
+   static int32_t getMaxPolymorphicInlinedTargets() {return _maxPolymorphicInlinedTargets;}
 
    static int32_t _maxOnsiteCacheSlotForInstanceOf;
    /** \brief
@@ -212,6 +214,12 @@ class OMR_EXTENSIBLE Options : public OMR::OptionsConnector
    static size_t getScratchSpaceLimitKBWhenLowVirtualMemory() { return _scratchSpaceLimitKBWhenLowVirtualMemory; }
 
    static int32_t _scratchSpaceFactorWhenJSR292Workload;
+
+   static int32_t _compilationMemoryBudgetPercentage; // percentage of the scratch space limit a hot compilation may use before it is retried at a lower opt level
+   static int32_t getCompilationMemoryBudgetPercentage() { return _compilationMemoryBudgetPercentage; }
+
+   static int32_t _scratchSegmentPoolSize; // idle scratch segments kept by each compilation thread for later compilations
+   static int32_t getScratchSegmentPoolSize() { return _scratchSegmentPoolSize; }
    static int32_t getScratchSpaceFactorWhenJSR292Workload() { return _scratchSpaceFactorWhenJSR292Workload; }
 
 #if defined(J9VM_OPT_JITSERVER)
@@ -242,6 +250,7 @@ class OMR_EXTENSIBLE Options : public OMR::OptionsConnector
    static int32_t _compYieldStatsHeartbeatPeriod;
    static int32_t _numberOfUserClassesLoaded;
    static int32_t _numQueuedInvReqToDowngradeOptLevel;
+   static int32_t _numQueuedAOTLoadsPerCompThread;
    static int32_t _qszThresholdToDowngradeOptLevel;
    static int32_t _qsziThresholdToDowngradeDuringCLP;
    static int32_t _qszThresholdToDowngradeOptLevelDuringStartup;
@@ -267,6 +276,7 @@ class OMR_EXTENSIBLE Options : public OMR::OptionsConnector
 
    static int32_t _invocationThresholdToTriggerLowPriComp; // we trigger an LPQ comp req only if the method
                                                            // was invoked at least this many times
+   static int32_t _startupCompilePlanSize; // max number of startup compilations recorded in the SCC and replayed
    static int32_t _aotMethodThreshold;         // when number of methods found in shared cache exceeds this threshold
                                                // we stop AOTing new methods to be put in shared cache UNLESS
    static int32_t _aotMethodCompilesThreshold; // we have already AOT compiled at least this many methods
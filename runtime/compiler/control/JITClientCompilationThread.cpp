@@ -512,6 +512,10 @@ handleServerMessage(JITServer::ClientStream *client, TR_J9VM *fe, JITServer::Mes
             vmInfo._helperAddresses[i] = runtimeHelperValue((TR_RuntimeHelper) i);
 #endif
          vmInfo._isHotReferenceFieldRequired = TR::Compiler->om.isHotReferenceFieldRequired();
+         vmInfo._sharedCacheUniqueId = 0;
+         if (vmInfo._hasSharedClassCache &&
+             static_cast<TR_JitPrivateConfig *>(compInfo->getJITConfig()->privateConfig)->aotValidHeader == TR_yes)
+            vmInfo._sharedCacheUniqueId = compInfo->reloRuntime()->getSharedCacheUniqueIdFromSCC(fe, vmThread);
 
          client->write(response, vmInfo, listOfCacheDescriptors);
          }
@@ -1166,8 +1170,12 @@ handleServerMessage(JITServer::ClientStream *client, TR_J9VM *fe, JITServer::Mes
          break;
       case MessageType::ResolvedMethod_getRemoteROMClassAndMethods:
          {
-         J9Class *clazz = std::get<0>(client->getRecvData<J9Class *>());
-         client->write(response, JITServerHelpers::packRemoteROMClassInfo(clazz, fe->vmThread(), trMemory, true));
+         auto recv = client->getRecvData<J9Class *, bool>();
+         J9Class *clazz = std::get<0>(recv);
+         bool sendROMClassReference = std::get<1>(recv);
+         if (sendROMClassReference)
+            JITServerHelpers::setServerUsesROMClassStore();
+         client->write(response, JITServerHelpers::packRemoteROMClassInfo(clazz, fe->vmThread(), trMemory, true, sendROMClassReference));
          }
          break;
       case MessageType::ResolvedMethod_isJNINative:
@@ -1253,6 +1261,38 @@ handleServerMessage(JITServer::ClientStream *client, TR_J9VM *fe, JITServer::Mes
          client->write(response, attrs);
          }
          break;
+      case MessageType::ResolvedMethod_getMultipleFieldAttributes:
+         {
+         auto recv = client->getRecvData<TR_ResolvedJ9Method *, std::vector<int32_t>, std::vector<uint8_t>, std::vector<uint8_t>>();
+         TR_ResolvedJ9Method *method = std::get<0>(recv);
+         auto &cpIndices = std::get<1>(recv);
+         auto &isStaticField = std::get<2>(recv);
+         auto &isStoreField = std::get<3>(recv);
+         int32_t numFields = cpIndices.size();
+         std::vector<TR_J9MethodFieldAttributes> attributes(numFields);
+         for (int32_t i = 0; i < numFields; ++i)
+            {
+            TR::DataType type = TR::NoType;
+            bool volatileP = true;
+            bool isFinal = false;
+            bool isPrivate = false;
+            bool unresolvedInCP;
+            if (isStaticField[i])
+               {
+               void *address;
+               bool result = method->staticAttributes(comp, cpIndices[i], &address, &type, &volatileP, &isFinal, &isPrivate, isStoreField[i], &unresolvedInCP, false);
+               attributes[i] = TR_J9MethodFieldAttributes(reinterpret_cast<uintptr_t>(address), type.getDataType(), volatileP, isFinal, isPrivate, unresolvedInCP, result);
+               }
+            else
+               {
+               U_32 fieldOffset;
+               bool result = method->fieldAttributes(comp, cpIndices[i], &fieldOffset, &type, &volatileP, &isFinal, &isPrivate, isStoreField[i], &unresolvedInCP, false);
+               attributes[i] = TR_J9MethodFieldAttributes(static_cast<uintptr_t>(fieldOffset), type.getDataType(), volatileP, isFinal, isPrivate, unresolvedInCP, result);
+               }
+            }
+         client->write(response, attributes);
+         }
+         break;
       case MessageType::ResolvedMethod_getResolvedStaticMethodAndMirror:
          {
          auto recv = client->getRecvData<TR_ResolvedJ9Method *, I_32>();
@@ -3224,7 +3264,9 @@ remoteCompile(
          }
       }
 
-   auto classInfoTuple = JITServerHelpers::packRemoteROMClassInfo(clazz, compiler->fej9vm()->vmThread(), compiler->trMemory(), serializeClass);
+   // If the server keeps a store of ROM classes, it probably has this one already; send only a reference
+   auto classInfoTuple = JITServerHelpers::packRemoteROMClassInfo(clazz, compiler->fej9vm()->vmThread(), compiler->trMemory(), serializeClass,
+                                                                  JITServerHelpers::serverUsesROMClassStore());
    std::string optionsStr = TR::Options::packOptions(compiler->getOptions());
    std::string recompMethodInfoStr = compiler->isRecompilationEnabled() ? std::string((char *) compiler->getRecompilationInfo()->getMethodInfo(), sizeof(TR_PersistentMethodInfo)) : std::string();
 
@@ -34,6 +34,7 @@
 #include "runtime/CodeCache.hpp"
 #include "runtime/CodeCacheExceptions.hpp"
 #include "runtime/J9VMAccess.hpp"
+#include "runtime/JITServerMetrics.hpp"
 #include "runtime/RelocationTarget.hpp"
 #include "net/ClientStream.hpp"
 #include "net/ServerStream.hpp"
@@ -102,6 +103,17 @@ outOfProcessCompilationEnd(
          }
       }
 
+   // Share this AOT body with other clients. Bodies that depend on runtime assumptions
+   // are left out because the assumptions are expressed with client-side pointers.
+   JITServerAOTCache *aotCache = compInfoPT->getCompilationInfo()->getJITServerAOTCache();
+   if (aotCache && entry->_useAotCompilation && compInfoPT->getAOTCacheKey() && serializedRuntimeAssumptions.empty())
+      {
+      if (aotCache->store(*compInfoPT->getAOTCacheKey(), codeCacheStr, dataCacheStr) &&
+          TR::Options::getVerboseOption(TR_VerboseJITServer))
+         TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "compThreadID=%d stored AOT body of %s in the AOT cache",
+            compInfoPT->getCompThreadId(), comp->signature());
+      }
+
    auto resolvedMirrorMethodsPersistIPInfo = compInfoPT->getCachedResolvedMirrorMethodsPersistIPInfo();
    entry->_stream->finishCompilation(codeCacheStr, dataCacheStr, chTableData,
                                      std::vector<TR_OpaqueClassBlock*>(classesThatShouldNotBeNewlyExtended->begin(), classesThatShouldNotBeNewlyExtended->end()),
@@ -134,7 +146,8 @@ TR::CompilationInfoPerThreadRemote::CompilationInfoPerThreadRemote(TR::Compilati
    _classOfStaticMap(NULL),
    _fieldAttributesCache(NULL),
    _staticAttributesCache(NULL),
-   _isUnresolvedStrCache(NULL)
+   _isUnresolvedStrCache(NULL),
+   _aotCacheKeyIsValid(false)
    {}
 
 /**
@@ -308,6 +321,23 @@ TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &entry, J
    clearPerCompilationCaches();
 
    _recompilationMethodInfo = NULL;
+   _aotCacheKeyIsValid = false;
+   JITServerMetrics *metrics = compInfo->getJITServerMetrics();
+   uint64_t queueWaitUs = 0;
+   uint64_t requestStartUs = 0;
+   // The queue wait is only known if the listener saw the request arrive before queuing the stream;
+   // otherwise this thread may now block until the client sends its next request
+   bool queueWaitKnown = false;
+   if (metrics)
+      {
+      requestStartUs = JITServerMetrics::getTimeUs();
+      if (stream->getRequestReceivedTimeUs())
+         {
+         queueWaitUs = requestStartUs - stream->getRequestReceivedTimeUs();
+         queueWaitKnown = true;
+         stream->setRequestReceivedTimeUs(0);
+         }
+      }
    // Release compMonitor before doing the blocking read
    compInfo->releaseCompMonitor(compThread);
 
@@ -333,6 +363,10 @@ TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &entry, J
          std::vector<TR_OpaqueClassBlock*>, std::vector<TR_OpaqueClassBlock*>,
          JITServerHelpers::ClassInfoTuple, std::string, std::string, std::string, std::string, bool>();
 
+      // Time spent blocked on the read above is idle time, not compilation time
+      if (metrics)
+         requestStartUs = JITServerMetrics::getTimeUs();
+
       clientId                           = std::get<0>(req);
       seqNo                              = std::get<1>(req); // Sequence number at the client
       uint32_t romMethodOffset           = std::get<2>(req);
@@ -370,6 +404,8 @@ TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &entry, J
 
       stream->setClientId(clientId);
       setSeqNo(seqNo); // Memorize the sequence number of this request
+      if (queueWaitKnown)
+         metrics->recordQueueWait(clientId, queueWaitUs);
 
       bool sessionDataWasEmpty = false;
       {
@@ -533,6 +569,7 @@ TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &entry, J
          // If it's an empty string then I dont't need to cache it
          if(!(std::get<0>(classInfoTuple).empty()))
             {
+            JITServerHelpers::resolveROMClassReference(classInfoTuple, clazz, stream);
             romClass = JITServerHelpers::romClassFromString(std::get<0>(classInfoTuple), compInfo->persistentMemory());
             }
          else
@@ -574,6 +611,24 @@ TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &entry, J
       // If we want something then we need to increaseQueueWeightBy(weight) while holding compilation monitor
       entry._weight = 0;
       entry._useAotCompilation = useAotCompilation;
+
+      // Compute the key of this request in the AOT cache shared by all clients.
+      // Requests whose defining class is not in the client's shared class cache cannot be shared,
+      // nor can requests from clients whose shared class cache cannot be identified.
+      if (useAotCompilation && compInfo->getJITServerAOTCache() &&
+          clientSession->getOrCacheVMInfo(stream)->_sharedCacheUniqueId != 0)
+         {
+         uintptr_t classChainOffset = 0;
+         UDATA *classChain = _vm->sharedCache()->rememberClass(clazz);
+         if (classChain && _vm->sharedCache()->isPointerInSharedCache(classChain, &classChainOffset))
+            {
+            uintptr_t loaderChainOffset = _vm->sharedCache()->getClassChainOffsetOfIdentifyingLoaderForClazzInSharedCache((TR_OpaqueClassBlock *)clazz);
+            _aotCacheKey = JITServerAOTCache::computeKey(romClass, romMethodOffset, clientOptPlan.getOptLevel(),
+                                                         classChainOffset, loaderChainOffset,
+                                                         clientSession->getOrCacheVMInfo(stream), clientOptStr);
+            _aotCacheKeyIsValid = true;
+            }
+         }
       }
    catch (const JITServer::StreamFailure &e)
       {
@@ -770,6 +825,8 @@ TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &entry, J
          TR_Memory::jitPersistentFree(stream);
          entry._stream = NULL;
          }
+      if (metrics)
+         metrics->recordCompThreadBusyTime(JITServerMetrics::getTimeUs() - requestStartUs);
       return;
       }
 
@@ -790,7 +847,42 @@ TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &entry, J
    stream->setClientData(clientSession);
    getClientData()->readAcquireClassUnloadRWMutex();
 
-   void *startPC = compile(compThread, &entry, scratchSegmentProvider);
+   void *startPC = NULL;
+   std::string cachedCodeStr;
+   std::string cachedDataStr;
+   if (getAOTCacheKey() && compInfo->getJITServerAOTCache()->find(*getAOTCacheKey(), cachedCodeStr, cachedDataStr))
+      {
+      // Another client already had this method AOT compiled. Send the cached body instead of
+      // compiling it again; the client will validate and relocate it like any other remote AOT body.
+      if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+         TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "compThreadID=%d found AOT body in the AOT cache for clientUID=%llu seqNo=%u",
+            getCompThreadId(), (unsigned long long)clientId, seqNo);
+
+      try
+         {
+         stream->finishCompilation(cachedCodeStr, cachedDataStr, CHTableCommitData(),
+                                   std::vector<TR_OpaqueClassBlock*>(), std::string(), std::string(),
+                                   std::vector<TR_ResolvedJ9Method*>(), *entry._optimizationPlan,
+                                   std::vector<SerializedRuntimeAssumption>());
+         entry._compErrCode = compilationOK;
+         }
+      catch (const JITServer::StreamFailure &e)
+         {
+         // Handled like a stream failure in compile(): the dead stream is cleaned up below
+         if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "compThreadID=%d JITServer StreamFailure: %s", getCompThreadId(), e.what());
+         Trc_JITServerStreamFailure(compThread, getCompThreadId(), __FUNCTION__, "", "", e.what());
+         entry._compErrCode = compilationStreamFailure;
+         }
+
+      // Mimic the state in which compile() returns
+      compInfo->acquireCompMonitor(compThread);
+      entry.acquireSlotMonitor(compThread);
+      }
+   else
+      {
+      startPC = compile(compThread, &entry, scratchSegmentProvider);
+      }
 
    getClientData()->readReleaseClassUnloadRWMutex();
    stream->setClientData(NULL);
@@ -901,6 +993,8 @@ TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &entry, J
       TR_Memory::jitPersistentFree(stream);
       entry._stream = NULL;
       }
+   if (metrics)
+      metrics->recordCompThreadBusyTime(JITServerMetrics::getTimeUs() - requestStartUs);
    }
 
 /**
@@ -26,6 +26,7 @@
 #include "control/CompilationThread.hpp"
 #include "env/j9methodServer.hpp"
 #include "runtime/JITClientSession.hpp"
+#include "runtime/JITServerAOTCache.hpp"
 
 class TR_IPBytecodeHashTableEntry;
 
@@ -77,6 +78,9 @@ class CompilationInfoPerThreadRemote : public TR::CompilationInfoPerThread
    bool getCachedIsUnresolvedStr(TR_OpaqueClassBlock *ramClass, int32_t cpIndex, TR_IsUnresolvedString &stringAttrs);
 
    void clearPerCompilationCaches();
+
+   // Key of the current AOT compilation in the AOT cache shared by all clients
+   const JITServerAOTCacheKey *getAOTCacheKey() const { return _aotCacheKeyIsValid ? &_aotCacheKey : NULL; }
    void deleteClientSessionData(uint64_t clientId, TR::CompilationInfo* compInfo, J9VMThread* compThread);
    virtual void freeAllResources() override;
 
@@ -146,6 +150,8 @@ class CompilationInfoPerThreadRemote : public TR::CompilationInfoPerThread
    FieldOrStaticAttrTable_t *_fieldAttributesCache;
    FieldOrStaticAttrTable_t *_staticAttributesCache;
    UnorderedMap<std::pair<TR_OpaqueClassBlock *, int32_t>, TR_IsUnresolvedString> *_isUnresolvedStrCache;
+   JITServerAOTCacheKey _aotCacheKey;
+   bool _aotCacheKeyIsValid; // false if the current request cannot use the AOT cache
    }; // class CompilationInfoPerThreadRemote
 } // namespace TR
 
@@ -28,12 +28,14 @@
 #include "infra/CriticalSection.hpp"
 #include "infra/Statistics.hpp"
 #include "net/CommunicationStream.hpp"
+#include "runtime/JITServerROMClassCache.hpp"
 
 
 
 uint32_t     JITServerHelpers::serverMsgTypeCount[] = {};
 uint64_t     JITServerHelpers::_waitTimeMs = 1000;
 bool         JITServerHelpers::_serverAvailable = true;
+bool         JITServerHelpers::_serverUsesROMClassStore = false;
 uint64_t     JITServerHelpers::_nextConnectionRetryTime = 0;
 TR::Monitor *JITServerHelpers::_clientStreamMonitor = NULL;
 
@@ -171,6 +173,26 @@ JITServerHelpers::printJITServerMsgStats(J9JITConfig *jitConfig, TR::Compilation
       j9tty_printf(PORTLIB, "Total number of messages: %u\n", totalMsgCount);
 #endif // defined(MESSAGE_SIZE_STATS)
       }
+
+#ifdef MESSAGE_SIZE_STATS
+   // Ratio between the uncompressed and the compressed size of received messages
+   bool printedHeader = false;
+   for (int i = 0; i < JITServer::MessageType_ARRAYSIZE; ++i)
+      {
+      TR_Stats &ratioStat = JITServer::CommunicationStream::collectMsgCompressionRatio[i];
+      if (ratioStat.samples() > 0)
+         {
+         if (!printedHeader)
+            {
+            j9tty_printf(PORTLIB, "JITServer Message Compression Statistics:\n");
+            j9tty_printf(PORTLIB, "Type# #compressed\tMaxRatio\tMinRatio\tMeanRatio\tTypeName\n");
+            printedHeader = true;
+            }
+         j9tty_printf(PORTLIB, "#%04d %7u\t%f\t%f\t%f\t%s\n", i, ratioStat.samples(),
+                      ratioStat.maxVal(), ratioStat.minVal(), ratioStat.mean(), JITServer::messageNames[i]);
+         }
+      }
+#endif // defined(MESSAGE_SIZE_STATS)
    }
 
 void
@@ -227,6 +249,11 @@ JITServerHelpers::cacheRemoteROMClass(ClientSessionData *clientSessionData, J9Cl
       {
       JITServerHelpers::cacheRemoteROMClass(clientSessionData, clazz, romClass, classInfoTuple, classInfo);
       }
+   else
+      {
+      // Another thread cached the class in the meantime
+      JITServerHelpers::freeRemoteROMClass(romClass);
+      }
    }
 
 void
@@ -282,7 +309,7 @@ JITServerHelpers::getRemoteROMClassIfCached(ClientSessionData *clientSessionData
    }
 
 JITServerHelpers::ClassInfoTuple
-JITServerHelpers::packRemoteROMClassInfo(J9Class *clazz, J9VMThread *vmThread, TR_Memory *trMemory, bool serializeClass)
+JITServerHelpers::packRemoteROMClassInfo(J9Class *clazz, J9VMThread *vmThread, TR_Memory *trMemory, bool serializeClass, bool sendROMClassReference)
    {
    // Always use the base VM here.
    // If this method is called inside AOT compilation, TR_J9SharedCacheVM will
@@ -324,16 +351,63 @@ JITServerHelpers::packRemoteROMClassInfo(J9Class *clazz, J9VMThread *vmThread, T
    uintptr_t classChainOffsetOfIdentifyingLoaderForClazz = fe->sharedCache() ? 
       fe->sharedCache()->getClassChainOffsetOfIdentifyingLoaderForClazzInSharedCacheNoFail((TR_OpaqueClassBlock *)clazz) : 0;
 
-   return std::make_tuple(serializeClass ? packROMClass(clazz->romClass, trMemory) : std::string(), methodsOfClass, baseClass, numDims, parentClass,
+   std::string romClassStr;
+   if (serializeClass)
+      {
+      romClassStr = packROMClass(clazz->romClass, trMemory);
+      if (sendROMClassReference)
+         {
+         ROMClassReference reference = { hashBytes(romClassStr.data(), romClassStr.size()), (uint32_t)romClassStr.size(), 0 };
+         romClassStr.assign((const char *)&reference, sizeof(reference));
+         }
+      }
+
+   return std::make_tuple(romClassStr, methodsOfClass, baseClass, numDims, parentClass,
                           TR::Compiler->cls.getITable((TR_OpaqueClassBlock *) clazz), methodTracingInfo,
                           classHasFinalFields, classDepthAndFlags, classInitialized, byteOffsetToLockword,
                           leafComponentClass, classLoader, hostClass, componentClass, arrayClass, totalInstanceSize,
                           clazz->romClass, cp, classFlags, classChainOffsetOfIdentifyingLoaderForClazz, origROMMethods);
    }
 
+JITServerHelpers::ClassInfoTuple
+JITServerHelpers::getRemoteROMClassInfo(J9Class *clazz, JITServer::ServerStream *stream)
+   {
+   // With a ROM class store, ask for a reference first; most ROM classes are identical for all clients
+   bool sendROMClassReference = TR::CompilationInfo::get()->getJITServerROMClassCache() != NULL;
+   stream->write(JITServer::MessageType::ResolvedMethod_getRemoteROMClassAndMethods, clazz, sendROMClassReference);
+   const auto &recv = stream->read<ClassInfoTuple>();
+   ClassInfoTuple classInfoTuple = std::get<0>(recv);
+   resolveROMClassReference(classInfoTuple, clazz, stream);
+   return classInfoTuple;
+   }
+
+void
+JITServerHelpers::resolveROMClassReference(ClassInfoTuple &classInfoTuple, J9Class *clazz, JITServer::ServerStream *stream)
+   {
+   std::string &romClassStr = std::get<0>(classInfoTuple);
+   if (!isROMClassReference(romClassStr))
+      return;
+
+   ROMClassReference reference;
+   memcpy(&reference, romClassStr.data(), sizeof(reference));
+   JITServerROMClassCache *romClassCache = TR::CompilationInfo::get()->getJITServerROMClassCache();
+   if (romClassCache && romClassCache->copyIfPresent(reference._hash, reference._size, romClassStr))
+      return;
+
+   // The store doesn't have this ROM class, or is disabled since the client learned about it
+   stream->write(JITServer::MessageType::ResolvedMethod_getRemoteROMClassAndMethods, clazz, false);
+   const auto &recv = stream->read<ClassInfoTuple>();
+   classInfoTuple = std::get<0>(recv);
+   }
+
 J9ROMClass *
 JITServerHelpers::romClassFromString(const std::string &romClassStr, TR_PersistentMemory *trMemory)
    {
+   // Share one copy of identical ROM classes between all clients if the server-wide store is enabled
+   JITServerROMClassCache *romClassCache = TR::CompilationInfo::get()->getJITServerROMClassCache();
+   if (romClassCache)
+      return romClassCache->getOrCreate(romClassStr);
+
    auto romClass = (J9ROMClass *)(trMemory->allocatePersistentMemory(romClassStr.size(), TR_Memory::ROMClass));
    if (!romClass)
       throw std::bad_alloc();
@@ -341,21 +415,27 @@ JITServerHelpers::romClassFromString(const std::string &romClassStr, TR_Persiste
    return romClass;
    }
 
+void
+JITServerHelpers::freeRemoteROMClass(J9ROMClass *romClass)
+   {
+   JITServerROMClassCache *romClassCache = TR::CompilationInfo::get()->getJITServerROMClassCache();
+   if (romClassCache)
+      romClassCache->release(romClass);
+   else
+      TR_Memory::jitPersistentFree(romClass);
+   }
+
 J9ROMClass *
 JITServerHelpers::getRemoteROMClass(J9Class *clazz, JITServer::ServerStream *stream, TR_Memory *trMemory, ClassInfoTuple *classInfoTuple)
    {
-   stream->write(JITServer::MessageType::ResolvedMethod_getRemoteROMClassAndMethods, clazz);
-   const auto &recv = stream->read<ClassInfoTuple>();
-   *classInfoTuple = std::get<0>(recv);
+   *classInfoTuple = getRemoteROMClassInfo(clazz, stream);
    return romClassFromString(std::get<0>(*classInfoTuple), trMemory->trPersistentMemory());
    }
 
 J9ROMClass *
 JITServerHelpers::getRemoteROMClass(J9Class *clazz, JITServer::ServerStream *stream, TR_PersistentMemory *trMemory, ClassInfoTuple *classInfoTuple)
    {
-   stream->write(JITServer::MessageType::ResolvedMethod_getRemoteROMClassAndMethods, clazz);
-   const auto &recv = stream->read<ClassInfoTuple>();
-   *classInfoTuple = std::get<0>(recv);
+   *classInfoTuple = getRemoteROMClassInfo(clazz, stream);
    return romClassFromString(std::get<0>(*classInfoTuple), trMemory);
    }
 
@@ -379,9 +459,7 @@ JITServerHelpers::getAndCacheRAMClassInfo(J9Class *clazz, ClientSessionData *cli
          }
       }
 
-   stream->write(JITServer::MessageType::ResolvedMethod_getRemoteROMClassAndMethods, clazz);
-   const auto &recv = stream->read<ClassInfoTuple>();
-   classInfoTuple = std::get<0>(recv);
+   classInfoTuple = getRemoteROMClassInfo(clazz, stream);
 
    OMR::CriticalSection cacheRemoteROMClass(clientSessionData->getROMMapMonitor());
    auto it = clientSessionData->getROMClassMap().find(clazz);
@@ -418,9 +496,7 @@ JITServerHelpers::getAndCacheRAMClassInfo(J9Class *clazz, ClientSessionData *cli
          return true;
          }
       }
-   stream->write(JITServer::MessageType::ResolvedMethod_getRemoteROMClassAndMethods, clazz);
-   const auto &recv = stream->read<ClassInfoTuple>();
-   classInfoTuple = std::get<0>(recv);
+   classInfoTuple = getRemoteROMClassInfo(clazz, stream);
 
    OMR::CriticalSection cacheRemoteROMClass(clientSessionData->getROMMapMonitor());
    auto it = clientSessionData->getROMClassMap().find(clazz);
@@ -622,6 +698,18 @@ JITServerHelpers::isAddressInROMClass(const void *address, const J9ROMClass *rom
    return ((address >= romClass) && (address < (((uint8_t*) romClass) + romClass->romSize)));
    }
 
+uint64_t
+JITServerHelpers::hashBytes(const void *data, size_t size, uint64_t hash)
+   {
+   const uint8_t *bytes = (const uint8_t *)data;
+   for (size_t i = 0; i < size; ++i)
+      {
+      hash ^= bytes[i];
+      hash *= 1099511628211ULL;
+      }
+   return hash;
+   }
+
 
 uintptr_t
 JITServerHelpers::walkReferenceChainWithOffsets(TR_J9VM * fe, const std::vector<uintptr_t>& listOfOffsets, uintptr_t receiver)
@@ -638,9 +726,7 @@ uintptr_t
 JITServerHelpers::getRemoteClassDepthAndFlagsWhenROMClassNotCached(J9Class *clazz, ClientSessionData *clientSessionData, JITServer::ServerStream *stream)
 {
    ClientSessionData::ClassInfo classInfo;
-   stream->write(JITServer::MessageType::ResolvedMethod_getRemoteROMClassAndMethods, clazz);
-   const auto &recv = stream->read<JITServerHelpers::ClassInfoTuple>();
-   JITServerHelpers::ClassInfoTuple classInfoTuple = std::get<0>(recv);
+   JITServerHelpers::ClassInfoTuple classInfoTuple = getRemoteROMClassInfo(clazz, stream);
 
    OMR::CriticalSection cacheRemoteROMClass(clientSessionData->getROMMapMonitor());
    auto it = clientSessionData->getROMClassMap().find(clazz);
@@ -71,7 +71,21 @@ class JITServerHelpers
       uintptr_t, std::vector<J9ROMMethod *>                          // 20: _classChainOffsetOfIdentifyingLoaderForClazz 21. _origROMMethods
       >;
 
-   static ClassInfoTuple packRemoteROMClassInfo(J9Class *clazz, J9VMThread *vmThread, TR_Memory *trMemory, bool serializeClass);
+   // When the server keeps a store of ROM classes shared by all clients, the first element of a
+   // ClassInfoTuple can be a reference to the packed ROM class (its hash and size) instead of its content.
+   // The server then copies the content from the store, or asks for it if the store doesn't have it.
+   struct ROMClassReference
+      {
+      uint64_t _hash;
+      uint32_t _size;
+      uint32_t _padding;
+      };
+   // A packed ROM class is always larger than J9ROMClass, which is much larger than a reference
+   static bool isROMClassReference(const std::string &romClassStr) { return romClassStr.size() == sizeof(ROMClassReference); }
+
+   static ClassInfoTuple packRemoteROMClassInfo(J9Class *clazz, J9VMThread *vmThread, TR_Memory *trMemory, bool serializeClass, bool sendROMClassReference = false);
+   static ClassInfoTuple getRemoteROMClassInfo(J9Class *clazz, JITServer::ServerStream *stream);
+   static void resolveROMClassReference(ClassInfoTuple &classInfoTuple, J9Class *clazz, JITServer::ServerStream *stream);
    static void cacheRemoteROMClass(ClientSessionData *clientSessionData, J9Class *clazz, J9ROMClass *romClass, ClassInfoTuple *classInfoTuple);
    static void cacheRemoteROMClass(ClientSessionData *clientSessionData, J9Class *clazz, J9ROMClass *romClass, ClassInfoTuple *classInfoTuple, ClientSessionData::ClassInfo &classInfo);
    static J9ROMClass *getRemoteROMClassIfCached(ClientSessionData *clientSessionData, J9Class *clazz);
@@ -93,6 +107,9 @@ class JITServerHelpers
    static bool shouldRetryConnection(OMRPortLibrary *portLibrary);
    static void postStreamConnectionSuccess();
    static bool isServerAvailable() { return _serverAvailable; }
+   // Set when the server asked for a ROM class reference; compilation requests then send references too
+   static bool serverUsesROMClassStore() { return _serverUsesROMClassStore; }
+   static void setServerUsesROMClassStore() { _serverUsesROMClassStore = true; }
 
    static void printJITServerMsgStats(J9JITConfig *, TR::CompilationInfo *);
    static void printJITServerCHTableStats(J9JITConfig *, TR::CompilationInfo *);
@@ -102,6 +119,10 @@ class JITServerHelpers
 
    static bool isAddressInROMClass(const void *address, const J9ROMClass *romClass);
 
+   // FNV-1a; pass the previous result as the last argument to hash several buffers together
+   static uint64_t hashBytes(const void *data, size_t size, uint64_t hash = 14695981039346656037ULL);
+   static void freeRemoteROMClass(J9ROMClass *romClass);
+
    static uintptr_t walkReferenceChainWithOffsets(TR_J9VM * fe, const std::vector<uintptr_t>& listOfOffsets, uintptr_t receiver);
 
    private:
@@ -116,6 +137,7 @@ class JITServerHelpers
    static uint64_t _waitTimeMs;
    static uint64_t _nextConnectionRetryTime;
    static bool _serverAvailable;
+   static bool _serverUsesROMClassStore;
    static TR::Monitor * _clientStreamMonitor;
    }; // class JITServerHelpers
 
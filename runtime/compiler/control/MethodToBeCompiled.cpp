@@ -82,6 +82,7 @@ void TR_MethodToBeCompiled::initialize(TR::IlGeneratorMethodDetails & details, v
    _jitStateWhenQueued = UNDEFINED_STATE;
    _entryIsCountedAsInvRequest = false;
    _GCRrequest = false;
+   _entryIsCountedAsAotLoad = false;
 
    _methodIsInSharedCache = TR_maybe;
 #if defined(J9VM_OPT_JITSERVER)
@@ -51,7 +51,7 @@ struct J9VMThread;
 
 struct TR_MethodToBeCompiled
    {
-   enum LPQ_REASON { REASON_NONE = 0, REASON_IPROFILER_CALLS, REASON_LOW_COUNT_EXPIRED, REASON_UPGRADE };
+   enum LPQ_REASON { REASON_NONE = 0, REASON_IPROFILER_CALLS, REASON_LOW_COUNT_EXPIRED, REASON_UPGRADE, REASON_COMPILE_PLAN };
    static int16_t _globalIndex;
    static TR_MethodToBeCompiled *allocate(J9JITConfig *jitConfig);
    void shutdown();
@@ -128,6 +128,8 @@ struct TR_MethodToBeCompiled
                                        // The flag in methodInfo is not enough because it may indicate true when
                                        // the entry is queued, but change afterwards if method receives samples
                                        // to be upgraded to hot or scorching
+   bool                   _entryIsCountedAsAotLoad; // the entry was queued as a first time compilation of a
+                                                    // method found in the shared cache; used for proper counting
    int16_t                _index;
    uint8_t                _freeTag; // temporary to catch a nasty bug
    uint8_t                _weight; // Up to 256 levels of weight
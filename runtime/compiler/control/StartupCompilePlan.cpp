@@ -0,0 +1,253 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "control/StartupCompilePlan.hpp"
+
+#include <string.h>
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "control/CompilationRuntime.hpp"
+#include "control/MethodToBeCompiled.hpp"
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+#include "control/OptimizationPlan.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/J9SharedCache.hpp"
+#include "env/VMJ9.h"
+#include "env/VerboseLog.hpp"
+#include "infra/CriticalSection.hpp"
+#include "infra/Monitor.hpp"
+
+const char TR_StartupCompilePlan::_key[] = "J9StartupCompilePlan";
+
+TR_StartupCompilePlan::TR_StartupCompilePlan(J9JITConfig *jitConfig, TR::Monitor *monitor, Entry *entries, uint32_t maxEntries) :
+   _jitConfig(jitConfig),
+   _monitor(monitor),
+   _entries(entries),
+   _numEntries(0),
+   _maxEntries(maxEntries),
+   _recording(true),
+   _planEntries(NULL),
+   _numPlanEntries(0),
+   _replayMap(NULL),
+   _queued(NULL),
+   _numQueued(0)
+   {
+   }
+
+TR_StartupCompilePlan::TR_StartupCompilePlan(J9JITConfig *jitConfig, const Entry *planEntries, uint32_t numPlanEntries, bool *queued) :
+   _jitConfig(jitConfig),
+   _monitor(NULL),
+   _entries(NULL),
+   _numEntries(0),
+   _maxEntries(0),
+   _recording(false),
+   _planEntries(planEntries),
+   _numPlanEntries(numPlanEntries),
+   _replayMap(NULL),
+   _queued(queued),
+   _numQueued(0)
+   {
+   _replayMap = new (PERSISTENT_NEW) PersistentUnorderedMap<uintptr_t, uint32_t>(
+      PersistentUnorderedMap<uintptr_t, uint32_t>::allocator_type(TR::Compiler->persistentAllocator()));
+   if (_replayMap)
+      {
+      // If a ROM method appears more than once, the first (earliest) entry wins
+      for (uint32_t i = 0; i < numPlanEntries; i++)
+         _replayMap->insert(std::make_pair(planEntries[i]._romMethodOffset, i));
+      }
+   }
+
+TR_StartupCompilePlan *
+TR_StartupCompilePlan::allocate(J9JITConfig *jitConfig, J9VMThread *vmThread, uint32_t maxEntries)
+   {
+#if defined(J9VM_OPT_SHARED_CLASSES)
+   J9JavaVM *javaVM = jitConfig->javaVM;
+   if (!TR::Options::sharedClassCache() || !javaVM->sharedClassConfig || maxEntries == 0)
+      return NULL;
+
+   J9SharedDataDescriptor desc;
+   desc.address = NULL;
+   javaVM->sharedClassConfig->findSharedData(vmThread, _key, sizeof(_key) - 1, J9SHR_DATA_TYPE_JITHINT,
+                                             FALSE, &desc, NULL);
+   if (desc.address)
+      {
+      const Header *header = (const Header *)desc.address;
+      if (header->_version != VERSION ||
+          desc.length < sizeof(Header) + (UDATA)header->_numEntries * sizeof(Entry))
+         {
+         if (TR::Options::getVerboseOption(TR_VerbosePerformance))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "Ignoring startup compile plan with version %u found in the SCC", header->_version);
+         return NULL;
+         }
+      bool *queued = (bool *)jitPersistentAlloc(header->_numEntries * sizeof(bool));
+      if (!queued)
+         return NULL;
+      memset(queued, 0, header->_numEntries * sizeof(bool));
+      TR_StartupCompilePlan *plan = new (PERSISTENT_NEW) TR_StartupCompilePlan(jitConfig, (const Entry *)(header + 1), header->_numEntries, queued);
+      if (!plan || !plan->_replayMap)
+         return NULL;
+      if (TR::Options::getVerboseOption(TR_VerbosePerformance))
+         TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "Replaying startup compile plan with %u entries from the SCC", header->_numEntries);
+      return plan;
+      }
+
+   Entry *entries = (Entry *)jitPersistentAlloc(maxEntries * sizeof(Entry));
+   if (!entries)
+      return NULL;
+   TR::Monitor *monitor = TR::Monitor::create("JIT-StartupCompilePlanMonitor");
+   if (!monitor)
+      return NULL;
+   return new (PERSISTENT_NEW) TR_StartupCompilePlan(jitConfig, monitor, entries, maxEntries);
+#else
+   return NULL;
+#endif /* defined(J9VM_OPT_SHARED_CLASSES) */
+   }
+
+void
+TR_StartupCompilePlan::recordCompilation(TR_J9SharedCache *sc, TR_MethodToBeCompiled *entry)
+   {
+   if (!_recording || !entry->getMethodDetails().isOrdinaryMethod())
+      return;
+   J9ROMMethod *romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(entry->getMethodDetails().getMethod());
+   if (romMethod->modifiers & J9AccNative)
+      return;
+   // Methods of classes that are not in the SCC cannot be identified in subsequent runs
+   uintptr_t romMethodOffset = 0;
+   if (!sc->isROMMethodInSharedCache(romMethod, &romMethodOffset))
+      return;
+
+   OMR::CriticalSection recordCompilation(_monitor);
+   if (!_recording || _numEntries >= _maxEntries)
+      return;
+   Entry &planEntry = _entries[_numEntries++];
+   planEntry._romMethodOffset = romMethodOffset;
+   planEntry._queueTime = (uint32_t)entry->_entryTime;
+   planEntry._optLevel = (uint8_t)entry->_optimizationPlan->getOptLevel();
+   planEntry._isAotLoad = entry->isAotLoad() ? 1 : 0;
+   }
+
+bool
+TR_StartupCompilePlan::store(J9VMThread *vmThread)
+   {
+#if defined(J9VM_OPT_SHARED_CLASSES)
+   if (!_recording)
+      return false;
+
+   uint32_t numEntries;
+      {
+      OMR::CriticalSection storePlan(_monitor);
+      if (!_recording) // another thread got here first
+         return false;
+      _recording = false;
+      numEntries = _numEntries;
+      }
+   if (numEntries == 0)
+      return false;
+
+   // The entries are not modified anymore, so we can build the blob outside the monitor
+   size_t size = sizeof(Header) + numEntries * sizeof(Entry);
+   Header *header = (Header *)jitPersistentAlloc(size);
+   if (!header)
+      return false;
+   header->_version = VERSION;
+   header->_numEntries = numEntries;
+   memcpy(header + 1, _entries, numEntries * sizeof(Entry));
+
+   J9SharedDataDescriptor desc;
+   desc.address = (U_8 *)header;
+   desc.length = size;
+   desc.type = J9SHR_DATA_TYPE_JITHINT;
+   desc.flags = J9SHRDATA_SINGLE_STORE_FOR_KEY_TYPE;
+   const void *stored = _jitConfig->javaVM->sharedClassConfig->storeSharedData(vmThread, _key, sizeof(_key) - 1, &desc);
+   jitPersistentFree(header);
+
+   if (TR::Options::getVerboseOption(TR_VerbosePerformance))
+      TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "%s startup compile plan with %u entries in the SCC",
+                                     stored ? "Stored" : "Failed to store", numEntries);
+   return stored != NULL;
+#else
+   return false;
+#endif /* defined(J9VM_OPT_SHARED_CLASSES) */
+   }
+
+void
+TR_StartupCompilePlan::replayClass(J9VMThread *vmThread, J9Class *clazz, TR::CompilationInfo *compInfo)
+   {
+#if defined(J9VM_OPT_SHARED_CLASSES)
+   if (!isReplaying() || _numQueued >= _numPlanEntries)
+      return;
+   TR_J9VMBase *fe = TR_J9VMBase::get(_jitConfig, vmThread, TR_J9VMBase::AOT_VM);
+   TR_J9SharedCache *sc = fe ? fe->sharedCache() : NULL;
+   if (!sc || !sc->isROMClassInSharedCache(clazz->romClass))
+      return;
+
+   bool enqueued = false;
+   bool monitorAcquired = false;
+   J9Method *ramMethods = clazz->ramMethods;
+   uint32_t numMethods = clazz->romClass->romMethodCount;
+   for (uint32_t m = 0; m < numMethods; m++)
+      {
+      J9Method *method = ramMethods + m;
+      J9ROMMethod *romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(method);
+      uintptr_t romMethodOffset = 0;
+      if (!sc->isROMMethodInSharedCache(romMethod, &romMethodOffset))
+         continue;
+      auto it = _replayMap->find(romMethodOffset); // map is read-only, no need for a lock
+      if (it == _replayMap->end())
+         continue;
+
+      if (!monitorAcquired)
+         {
+         compInfo->getCompilationMonitor()->enter();
+         monitorAcquired = true;
+         }
+      // The same ROM class can be shared by classes from different class loaders
+      if (_queued[it->second])
+         continue;
+      _queued[it->second] = true;
+      _numQueued++;
+
+      const Entry &planEntry = _planEntries[it->second];
+      TR_YesNoMaybe methodIsInSharedCache = TR_maybe;
+#if defined(J9VM_INTERP_AOT_RUNTIME_SUPPORT)
+      if (planEntry._isAotLoad &&
+          !TR::Options::getAOTCmdLineOptions()->getOption(TR_NoLoadAOT) &&
+          static_cast<TR_JitPrivateConfig *>(_jitConfig->privateConfig)->aotValidHeader == TR_yes &&
+          _jitConfig->javaVM->sharedClassConfig->existsCachedCodeForROMMethod(vmThread, romMethod))
+         methodIsInSharedCache = TR_yes;
+#endif /* defined(J9VM_INTERP_AOT_RUNTIME_SUPPORT) */
+      if (compInfo->getLowPriorityCompQueue().addFirstTimeCompReqToLPQ(method, TR_MethodToBeCompiled::REASON_COMPILE_PLAN,
+                                                                       (TR_Hotness)planEntry._optLevel, methodIsInSharedCache))
+         enqueued = true;
+      }
+
+   if (monitorAcquired)
+      {
+      // Wake up a sleeping compilation thread if conditions allow for processing of LPQ requests
+      if (enqueued && compInfo->canProcessLowPriorityRequest() && compInfo->getNumCompThreadsJobless() > 0)
+         compInfo->getCompilationMonitor()->notifyAll();
+      compInfo->getCompilationMonitor()->exit();
+      }
+#endif /* defined(J9VM_OPT_SHARED_CLASSES) */
+   }
@@ -0,0 +1,129 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef STARTUPCOMPILEPLAN_HPP
+#define STARTUPCOMPILEPLAN_HPP
+
+#pragma once
+
+#include "j9.h"
+#include "env/TRMemory.hpp"
+#include "env/PersistentCollections.hpp"
+
+namespace TR { class CompilationInfo; }
+namespace TR { class Monitor; }
+class TR_J9SharedCache;
+struct TR_MethodToBeCompiled;
+
+/**
+   @class TR_StartupCompilePlan
+   @brief Ordered log of the first-time compilations performed during startup,
+          kept in the shared class cache and replayed in subsequent runs
+
+   In the first run that uses a given SCC the plan is in recording mode: every successful
+   first-time compilation or AOT load that happens during the STARTUP phase is appended
+   to the plan (ROM method offset into the SCC, optimization level, queue time and whether
+   it was an AOT load). When the JVM exits the STARTUP phase (or shuts down before that)
+   the plan is stored in the SCC as a single JITHINT blob.
+
+   In subsequent runs the plan is found in the SCC and is in replay mode: when a class
+   gets initialized during startup, its methods that appear in the plan are queued in
+   the low priority queue (LPQ) at their recorded optimization level, or as AOT loads
+   when the SCC has a body for them. Idle compilation threads then process these requests
+   before the invocation counts of the methods expire.
+
+   The feature is enabled with -Xjit:startupCompilePlanSize=<n> where n is the
+   maximum number of compilations that are recorded.
+ */
+class TR_StartupCompilePlan
+   {
+   public:
+   TR_PERSISTENT_ALLOC(TR_Memory::PersistentInfo)
+
+   struct Entry
+      {
+      uintptr_t _romMethodOffset; // offset of the J9ROMMethod in the SCC; this is the key
+      uint32_t  _queueTime;       // ms since JVM start when the request was queued
+      uint8_t   _optLevel;        // TR_Hotness of the compilation
+      uint8_t   _isAotLoad;
+      };
+
+   struct Header
+      {
+      uint32_t _version;
+      uint32_t _numEntries;
+      };
+
+   /**
+      @brief Look for a plan in the SCC and create the object in replay mode if
+             one is found, or in recording mode otherwise
+
+      @return the new plan or NULL if the SCC is not usable or we ran out of memory
+   */
+   static TR_StartupCompilePlan *allocate(J9JITConfig *jitConfig, J9VMThread *vmThread, uint32_t maxEntries);
+
+   bool isRecording() const { return _recording; }
+   bool isReplaying() const { return _replayMap != NULL; }
+
+   /**
+      @brief Append a successful first-time compilation to the plan; executed by compilation threads
+   */
+   void recordCompilation(TR_J9SharedCache *sc, TR_MethodToBeCompiled *entry);
+
+   /**
+      @brief Store the recorded plan in the SCC and stop recording
+
+      @return true if the plan was stored
+   */
+   bool store(J9VMThread *vmThread);
+
+   /**
+      @brief Queue LPQ requests for the methods of the given class that appear in the plan;
+             executed by application threads when the class is initialized
+   */
+   void replayClass(J9VMThread *vmThread, J9Class *clazz, TR::CompilationInfo *compInfo);
+
+   private:
+   TR_StartupCompilePlan(J9JITConfig *jitConfig, TR::Monitor *monitor, Entry *entries, uint32_t maxEntries);
+   TR_StartupCompilePlan(J9JITConfig *jitConfig, const Entry *planEntries, uint32_t numPlanEntries, bool *queued);
+
+   static const char _key[];
+   static const uint32_t VERSION = 1;
+
+   J9JITConfig *_jitConfig;
+
+   // Recording mode
+   TR::Monitor *_monitor;   // serializes comp threads that append to _entries
+   Entry       *_entries;
+   uint32_t     _numEntries;
+   uint32_t     _maxEntries;
+   volatile bool _recording;
+
+   // Replay mode
+   const Entry *_planEntries; // points into the SCC
+   uint32_t     _numPlanEntries;
+   PersistentUnorderedMap<uintptr_t, uint32_t> *_replayMap; // ROM method offset -> index in _planEntries; read-only after creation
+   bool        *_queued; // one flag per plan entry; protected by the compilation monitor
+   uint32_t     _numQueued;
+   };
+
+#endif // STARTUPCOMPILEPLAN_HPP
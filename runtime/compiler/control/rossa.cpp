@@ -54,6 +54,7 @@
 #include "control/JitDump.hpp"
 #include "control/Recompilation.hpp"
 #include "control/RecompilationInfo.hpp"
+#include "control/StartupCompilePlan.hpp"
 #include "runtime/ArtifactManager.hpp"
 #include "runtime/CodeCache.hpp"
 #include "runtime/CodeCacheManager.hpp"
@@ -113,6 +114,9 @@
 #include "net/ClientStream.hpp"
 #include "net/LoadSSLLibs.hpp"
 #include "runtime/JITClientSession.hpp"
+#include "runtime/JITServerAOTCache.hpp"
+#include "runtime/JITServerROMClassCache.hpp"
+#include "runtime/JITServerMetrics.hpp"
 #include "runtime/Listener.hpp"
 #include "runtime/JITServerStatisticsThread.hpp"
 #include "runtime/JITServerIProfiler.hpp"
@@ -212,6 +216,7 @@ char *compilationErrorNames[]={
    "compilationStreamInterrupted", // 59
 #endif /* defined(J9VM_OPT_JITSERVER) */
    "compilationAotHasInvokeSpecialInterface", //60
+   "compilationMemoryBudgetExceeded", //61
    "compilationMaxError",
 };
 
@@ -643,9 +648,20 @@ jitExclusiveVMShutdownPending(J9VMThread * vmThread)
          {
          listener->stop();
          }
+
+      // Persist the shared ROM classes so that the next server instance starts with them
+      JITServerROMClassCache *romClassCache = compInfo->getJITServerROMClassCache();
+      const std::string &snapshotFile = compInfo->getPersistentInfo()->getJITServerROMClassCacheFile();
+      if (romClassCache && !snapshotFile.empty())
+         romClassCache->save(snapshotFile.c_str());
       }
 #endif /* defined(J9VM_OPT_JITSERVER) */
 
+   // Short running applications may never exit the STARTUP phase; store what we recorded so far
+   TR_StartupCompilePlan *startupCompilePlan = getCompilationInfo(javaVM->jitConfig)->getStartupCompilePlan();
+   if (startupCompilePlan && startupCompilePlan->isRecording())
+      startupCompilePlan->store(vmThread);
+
    getCompilationInfo(javaVM->jitConfig)->stopCompilationThreads();
 #endif
    }
@@ -1680,6 +1696,34 @@ onLoadInternal(
       // Allocate the hashtable that holds information about clients
       compInfo->setClientSessionHT(ClientSessionHT::allocate());
 
+      // Allocate the cache of AOT bodies shared by all clients, if requested
+      if (compInfo->getPersistentInfo()->getJITServerUseAOTCache())
+         {
+         compInfo->setJITServerAOTCache(JITServerAOTCache::allocate(compInfo->getPersistentInfo()->getJITServerAOTCacheMaxBytes()));
+         if (!compInfo->getJITServerAOTCache())
+            return -1;
+         }
+
+      // Allocate the store of ROM classes shared by all clients, if requested,
+      // and populate it from the snapshot left by a previous server instance
+      if (compInfo->getPersistentInfo()->getJITServerUseROMClassCache())
+         {
+         compInfo->setJITServerROMClassCache(JITServerROMClassCache::allocate());
+         if (!compInfo->getJITServerROMClassCache())
+            return -1;
+         const std::string &snapshotFile = compInfo->getPersistentInfo()->getJITServerROMClassCacheFile();
+         if (!snapshotFile.empty())
+            compInfo->getJITServerROMClassCache()->load(snapshotFile.c_str());
+         }
+
+      // Allocate the metrics collector if metrics were requested
+      if (!compInfo->getPersistentInfo()->getJITServerMetricsFile().empty())
+         {
+         compInfo->setJITServerMetrics(JITServerMetrics::allocate());
+         if (!compInfo->getJITServerMetrics())
+            return -1;
+         }
+
       ((TR_JitPrivateConfig*)(jitConfig->privateConfig))->listener = TR_Listener::allocate();
       if (!((TR_JitPrivateConfig*)(jitConfig->privateConfig))->listener)
          {
@@ -1945,6 +1989,10 @@ aboutToBootstrap(J9JavaVM * javaVM, J9JITConfig * jitConfig)
             }
 #endif
          }
+
+      // Look for a startup compile plan recorded by a previous run, or start recording one
+      if (validateSCC && TR::Options::_startupCompilePlanSize > 0 && TR::Options::sharedClassCache())
+         compInfo->setStartupCompilePlan(TR_StartupCompilePlan::allocate(jitConfig, curThread, TR::Options::_startupCompilePlanSize));
       }
 #endif
 
@@ -87,6 +87,7 @@ typedef enum {
    compilationStreamInterrupted                    = compilationFirstJITServerFailure+4,
 #endif /* defined(J9VM_OPT_JITSERVER) */
    compilationAotHasInvokeSpecialInterface, //60
+   compilationMemoryBudgetExceeded, //61
    /* please insert new codes before compilationMaxError which is used in jar2jxe to test the error codes range */
    /* If new codes are added then add the corresponding names in compilationErrorNames table in rossa.cpp */
    compilationMaxError /* must be the last one */
@@ -106,6 +106,7 @@ class PersistentInfo : public OMR::PersistentInfoConnector
          _classLoadingPhaseGracePeriod(0),
          _startTime(0),
          _globalClassUnloadID(0),
+         _globalClassRedefinitionID(0),
          _externalStartupEndedSignal(false),
          _disableFurtherCompilation(false),
          _loadFactor(1),
@@ -135,6 +136,15 @@ class PersistentInfo : public OMR::PersistentInfoConnector
          _JITServerPort(38400),
          _socketTimeoutMs(2000),
          _clientUID(0),
+         _JITServerUseAOTCache(false),
+         _JITServerAOTCacheMaxBytes(300 * 1024 * 1024),
+         _JITServerUseCompression(false),
+         _JITServerCompressionThreshold(4096),
+         _JITServerUseEventDrivenIO(false),
+         _JITServerUseROMClassCache(false),
+         _JITServerROMClassCacheFile(),
+         _JITServerMetricsFile(),
+         _JITServerUseFairScheduling(false),
 #endif /* defined(J9VM_OPT_JITSERVER) */
       OMR::PersistentInfoConnector(pm)
       {}
@@ -182,6 +192,9 @@ class PersistentInfo : public OMR::PersistentInfoConnector
    int32_t getGlobalClassUnloadID() const {return _globalClassUnloadID;}
    void incGlobalClassUnloadID() {_globalClassUnloadID++;}
 
+   int32_t getGlobalClassRedefinitionID() const {return _globalClassRedefinitionID;}
+   void incGlobalClassRedefinitionID() {_globalClassRedefinitionID++;}
+
    bool getExternalStartupEndedSignal() const { return _externalStartupEndedSignal; }
    void setExternalStartupEndedSignal(bool b) { _externalStartupEndedSignal = b; }
 
@@ -307,6 +320,24 @@ class PersistentInfo : public OMR::PersistentInfoConnector
    void setJITServerPort(uint32_t port) { _JITServerPort = port; }
    uint64_t getClientUID() const { return _clientUID; }
    void setClientUID(uint64_t val) { _clientUID = val; }
+   bool getJITServerUseAOTCache() const { return _JITServerUseAOTCache; }
+   void setJITServerUseAOTCache(bool use) { _JITServerUseAOTCache = use; }
+   size_t getJITServerAOTCacheMaxBytes() const { return _JITServerAOTCacheMaxBytes; }
+   void setJITServerAOTCacheMaxBytes(size_t bytes) { _JITServerAOTCacheMaxBytes = bytes; }
+   bool getJITServerUseCompression() const { return _JITServerUseCompression; }
+   void setJITServerUseCompression(bool use) { _JITServerUseCompression = use; }
+   uint32_t getJITServerCompressionThreshold() const { return _JITServerCompressionThreshold; }
+   void setJITServerCompressionThreshold(uint32_t bytes) { _JITServerCompressionThreshold = bytes; }
+   bool getJITServerUseEventDrivenIO() const { return _JITServerUseEventDrivenIO; }
+   void setJITServerUseEventDrivenIO(bool use) { _JITServerUseEventDrivenIO = use; }
+   bool getJITServerUseROMClassCache() const { return _JITServerUseROMClassCache; }
+   void setJITServerUseROMClassCache(bool use) { _JITServerUseROMClassCache = use; }
+   const std::string &getJITServerROMClassCacheFile() const { return _JITServerROMClassCacheFile; }
+   void setJITServerROMClassCacheFile(char *fileName) { _JITServerROMClassCacheFile = fileName; }
+   const std::string &getJITServerMetricsFile() const { return _JITServerMetricsFile; }
+   void setJITServerMetricsFile(char *fileName) { _JITServerMetricsFile = fileName; }
+   bool getJITServerUseFairScheduling() const { return _JITServerUseFairScheduling; }
+   void setJITServerUseFairScheduling(bool use) { _JITServerUseFairScheduling = use; }
 #endif /* defined(J9VM_OPT_JITSERVER) */
 
    private:
@@ -335,6 +366,8 @@ class PersistentInfo : public OMR::PersistentInfoConnector
 
    int32_t _globalClassUnloadID; // incremented each time GC does a class unload
 
+   int32_t _globalClassRedefinitionID; // incremented each time classes are redefined
+
    bool _externalStartupEndedSignal; // the app will tell us when startup ends
 
    bool _disableFurtherCompilation;
@@ -397,6 +430,15 @@ class PersistentInfo : public OMR::PersistentInfoConnector
    uint32_t    _JITServerPort;
    uint32_t    _socketTimeoutMs; // timeout for communication sockets used in out-of-process JIT compilation
    uint64_t    _clientUID;
+   bool        _JITServerUseAOTCache; // share AOT bodies between clients of the same JITServer
+   size_t      _JITServerAOTCacheMaxBytes;
+   bool        _JITServerUseCompression; // compress large messages if the other side agrees
+   uint32_t    _JITServerCompressionThreshold; // messages smaller than this (bytes) are never compressed
+   bool        _JITServerUseEventDrivenIO; // listener multiplexes idle client connections with epoll
+   bool        _JITServerUseROMClassCache; // share identical ROM classes between clients of the same JITServer
+   std::string _JITServerROMClassCacheFile; // snapshot of the ROM class store; empty if not persisted
+   std::string _JITServerMetricsFile; // file periodically rewritten with metrics; empty if metrics are disabled
+   bool        _JITServerUseFairScheduling; // share compilation threads fairly between clients
 #endif /* defined(J9VM_OPT_JITSERVER) */
    };
 
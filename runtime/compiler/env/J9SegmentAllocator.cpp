@@ -124,6 +124,25 @@ SegmentAllocator::release(J9MemorySegment &unusedSegment) throw()
    deallocate(unusedSegment);
    }
 
+void
+SegmentAllocator::decommit(J9MemorySegment &segment) throw()
+   {
+   // Only virtual segments are backed by pages that can be given back
+   if (!(_segmentType & MEMORY_TYPE_VIRTUAL))
+      return;
+   PORT_ACCESS_FROM_JAVAVM(&_javaVM);
+   j9vmem_decommit_memory(segment.heapBase, segment.heapTop - segment.heapBase, &segment.vmemIdentifier);
+   }
+
+bool
+SegmentAllocator::recommit(J9MemorySegment &segment) throw()
+   {
+   if (!(_segmentType & MEMORY_TYPE_VIRTUAL))
+      return true;
+   PORT_ACCESS_FROM_JAVAVM(&_javaVM);
+   return j9vmem_commit_memory(segment.heapBase, segment.heapTop - segment.heapBase, &segment.vmemIdentifier) != NULL;
+   }
+
 size_t
 SegmentAllocator::pageSize() throw()
    {
@@ -47,6 +47,9 @@ public:
    J9MemorySegment &request(size_t segmentSize);
    void release(J9MemorySegment &unusedSegment) throw();
 
+   void decommit(J9MemorySegment &segment) throw();
+   bool recommit(J9MemorySegment &segment) throw();
+
    size_t pageSize() throw();
    size_t pageAlign(const size_t requestedSize) throw();
 
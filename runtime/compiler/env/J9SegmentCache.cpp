@@ -24,11 +24,13 @@
 #include "j9.h"
 #include "infra/Assert.hpp"
 
-J9::J9SegmentCache::J9SegmentCache(size_t cachedSegmentSize, J9SegmentProvider &backingProvider) :
+J9::J9SegmentCache::J9SegmentCache(size_t cachedSegmentSize, J9SegmentProvider &backingProvider, size_t maxPooledSegments) :
    _cachedSegmentSize(cachedSegmentSize),
    _backingProvider(backingProvider),
    _firstSegment(&_backingProvider.request(_cachedSegmentSize)),
-   _firstSegmentInUse(false)
+   _firstSegmentInUse(false),
+   _maxPooledSegments(maxPooledSegments < MAX_POOLED_SEGMENTS ? maxPooledSegments : MAX_POOLED_SEGMENTS),
+   _numPooledSegments(0)
    {
    }
 
@@ -36,31 +38,46 @@ J9::J9SegmentCache::J9SegmentCache(J9SegmentCache &donor) :
    _cachedSegmentSize(donor._cachedSegmentSize),
    _backingProvider(donor._backingProvider),
    _firstSegment(donor._firstSegment),
-   _firstSegmentInUse(false)
+   _firstSegmentInUse(false),
+   _maxPooledSegments(donor._maxPooledSegments),
+   _numPooledSegments(donor._numPooledSegments)
    {
    TR_ASSERT(donor._firstSegmentInUse == false, "Unsafe hand off between SegmentCaches");
    donor._firstSegment = 0;
+   for (size_t i = 0; i < _numPooledSegments; ++i)
+      _pooledSegments[i] = donor._pooledSegments[i];
+   donor._numPooledSegments = 0;
    }
 
 J9::J9SegmentCache::~J9SegmentCache() throw()
    {
    if (_firstSegment)
       _backingProvider.release(*_firstSegment);
+   while (_numPooledSegments > 0)
+      _backingProvider.release(*_pooledSegments[--_numPooledSegments]);
    }
 
 J9MemorySegment &
 J9::J9SegmentCache::request(size_t requiredSize)
    {
    TR_ASSERT(_firstSegment, "Segment was stolen");
-   if (
-      _firstSegmentInUse
-      || requiredSize > _cachedSegmentSize
-      )
+   if (requiredSize > _cachedSegmentSize)
       {
       return _backingProvider.request(requiredSize);
       }
-   _firstSegmentInUse = true;
-   return *_firstSegment;
+   if (!_firstSegmentInUse)
+      {
+      _firstSegmentInUse = true;
+      return *_firstSegment;
+      }
+   while (_numPooledSegments > 0)
+      {
+      J9MemorySegment &pooledSegment = *_pooledSegments[--_numPooledSegments];
+      if (_backingProvider.recommit(pooledSegment))
+         return pooledSegment;
+      _backingProvider.release(pooledSegment);
+      }
+   return _backingProvider.request(requiredSize);
    }
 
 void
@@ -71,6 +88,15 @@ J9::J9SegmentCache::release(J9MemorySegment &unusedSegment) throw()
       _firstSegmentInUse = false;
       unusedSegment.heapAlloc = unusedSegment.heapBase;
       }
+   else if (
+      _numPooledSegments < _maxPooledSegments
+      && static_cast<size_t>(unusedSegment.heapTop - unusedSegment.heapBase) == _cachedSegmentSize
+      )
+      {
+      unusedSegment.heapAlloc = unusedSegment.heapBase;
+      _backingProvider.decommit(unusedSegment);
+      _pooledSegments[_numPooledSegments++] = &unusedSegment;
+      }
    else
       {
       _backingProvider.release(unusedSegment);
@@ -33,7 +33,7 @@ class J9SegmentCache : public J9SegmentProvider
    {
 public:
 
-   J9SegmentCache(size_t cachedSegmentSize, J9SegmentProvider &backingProvider);
+   J9SegmentCache(size_t cachedSegmentSize, J9SegmentProvider &backingProvider, size_t maxPooledSegments = 0);
    J9SegmentCache(J9SegmentCache &donor);
 
    ~J9SegmentCache() throw();
@@ -44,11 +44,20 @@ public:
 
    J9SegmentCache &ref() { return *this; }
 
+   static const size_t MAX_POOLED_SEGMENTS = 16;
+
 private:
    size_t _cachedSegmentSize;
    J9SegmentProvider &_backingProvider;
    J9MemorySegment *_firstSegment;
    bool _firstSegmentInUse;
+
+   // Further segments of _cachedSegmentSize released by earlier requests.  They
+   // are decommitted while idle so they do not count against the resident set,
+   // but keep their address range for reuse without a new system allocation.
+   size_t _maxPooledSegments;
+   size_t _numPooledSegments;
+   J9MemorySegment *_pooledSegments[MAX_POOLED_SEGMENTS];
    };
 
 }
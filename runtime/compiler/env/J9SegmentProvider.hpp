@@ -41,6 +41,13 @@ public:
    virtual void release(J9MemorySegment& segment) throw() = 0;
    virtual size_t getPreferredSegmentSize() { return 0; }
 
+   /*
+    * An idle segment may be decommitted so the system can reclaim its pages;
+    * it must be recommitted before it is used again
+    */
+   virtual void decommit(J9MemorySegment& segment) throw() { }
+   virtual bool recommit(J9MemorySegment& segment) throw() { return true; }
+
 protected:
    J9SegmentProvider();
    J9SegmentProvider(const J9SegmentProvider &other);
@@ -21,6 +21,8 @@
  *******************************************************************************/
 
 #include "env/PersistentAllocator.hpp"
+
+#include <string.h>
 #include "il/DataTypes.hpp"
 #include "infra/Monitor.hpp"
 
@@ -32,6 +34,8 @@ PersistentAllocator::PersistentAllocator(const PersistentAllocatorKit &creationK
    _minimumSegmentSize(creationKit.minimumSegmentSize),
    _segmentAllocator(MEMORY_TYPE_JIT_PERSISTENT, creationKit.javaVM),
    _freeBlocks(),
+   _numThreadCaches(0),
+   _stats(),
 #if defined(J9VM_OPT_JITSERVER)
    _isJITServer(creationKit.javaVM.internalVMFunctions->isJITServerEnabled(&creationKit.javaVM)),
 #endif
@@ -40,6 +44,11 @@ PersistentAllocator::PersistentAllocator(const PersistentAllocatorKit &creationK
    j9thread_monitor_init_with_name(&_smallBlockListsMonitor, 0, "JIT-SmallBlockListsMonitor");
    if (!_smallBlockListsMonitor)
       throw std::bad_alloc();
+   if (omrthread_tls_alloc(&_threadCacheKey) != 0)
+      {
+      j9thread_monitor_destroy(_smallBlockListsMonitor);
+      throw std::bad_alloc();
+      }
    }
 
 PersistentAllocator::~PersistentAllocator() throw()
@@ -52,6 +61,7 @@ PersistentAllocator::~PersistentAllocator() throw()
       }
    j9thread_monitor_destroy(_smallBlockListsMonitor);
    _smallBlockListsMonitor = NULL;
+   omrthread_tls_free(_threadCacheKey);
    }
 
 void *
@@ -177,7 +187,9 @@ PersistentAllocator::allocateInternal(size_t requestedSize)
    TR_ASSERT( sizeof(Block) == mem_round( sizeof(Block) ),"Persistent block size will prevent us from properly aligning allocations.");
  
    size_t const dataSize = mem_round(requestedSize);
-   size_t const allocSize = sizeof(Block) + dataSize;
+   size_t allocSize = sizeof(Block) + dataSize;
+   // Medium sizes are rounded up to their size class
+   size_t const index = allocationIndex(allocSize);
    void * allocation = NULL;
 
    if (TR::AllocatedMemoryMeter::_enabled & persistentAlloc)
@@ -190,25 +202,35 @@ PersistentAllocator::allocateInternal(size_t requestedSize)
       j9thread_monitor_exit(_smallBlockListsMonitor);
       }
 
-   // If this is a small block try to allocate it from the appropriate
-   // fixed-size-block chain.
+   // If this is a small or medium block try to allocate it from the appropriate
+   // fixed-size-block chain, going through the thread cache if there is one.
    //
-   size_t const index = freeBlocksIndex(allocSize);
    if (index != LARGE_BLOCK_LIST_INDEX) // fixed-size-block chain
       {
-      j9thread_monitor_enter(_smallBlockListsMonitor);
-      Block * block = _freeBlocks[index];
+      ThreadCache * cache = _numThreadCaches ? getThreadCache() : NULL;
+      Block * block = NULL;
+      if (cache)
+         {
+         block = allocateFromThreadCache(cache, index);
+         }
+      else
+         {
+         j9thread_monitor_enter(_smallBlockListsMonitor);
+         block = _freeBlocks[index];
+         if (block)
+            {
+            _freeBlocks[index] = block->next();
+            _stats._sharedListAllocs++;
+            }
+         j9thread_monitor_exit(_smallBlockListsMonitor);
+         }
       if (block)
          {
-         _freeBlocks[index] = block->next();
          block->setNext(NULL);
-         j9thread_monitor_exit(_smallBlockListsMonitor);
          allocation = block + 1; // Return pointer after the header
          }
       else // Couldn't find suitable free block; need to allocate from segment
          {
-         j9thread_monitor_exit(_smallBlockListsMonitor);
-
          // Find the first persistent segment with enough free space
          if (::memoryAllocMonitor)
             ::memoryAllocMonitor->enter();
@@ -221,6 +243,7 @@ PersistentAllocator::allocateInternal(size_t requestedSize)
       {
       if (::memoryAllocMonitor)
          ::memoryAllocMonitor->enter();
+      _stats._variableSizeAllocs++;
       Block * block = 
 #if defined(J9VM_OPT_JITSERVER)
          _isJITServer ? allocateFromIndexedListLocked(allocSize) :
@@ -294,7 +317,9 @@ PersistentAllocator::allocateFromSegmentLocked(size_t allocSize)
          _segmentAllocator.deallocate(*segment);
          return NULL;
          }
+      _stats._segmentBytes += segment->size;
       }
+   _stats._segmentAllocs++;
    TR_ASSERT(segment && remainingSpace(*segment) >= allocSize, "Failed to acquire a segment");
    Block * block = new(operator new(allocSize, *segment)) Block(allocSize);
    return block + 1;
@@ -572,14 +597,24 @@ PersistentAllocator::freeBlock(Block * block)
    size_t const index = freeBlocksIndex(block->size());
    if (index > LARGE_BLOCK_LIST_INDEX)
       {
-      j9thread_monitor_enter(_smallBlockListsMonitor);
-      freeFixedSizeBlock(block);
-      j9thread_monitor_exit(_smallBlockListsMonitor);
+      ThreadCache * cache = _numThreadCaches ? getThreadCache() : NULL;
+      if (cache)
+         {
+         freeToThreadCache(cache, block, index);
+         }
+      else
+         {
+         j9thread_monitor_enter(_smallBlockListsMonitor);
+         freeFixedSizeBlock(block);
+         _stats._sharedListFrees++;
+         j9thread_monitor_exit(_smallBlockListsMonitor);
+         }
       }
    else
       {
       if (::memoryAllocMonitor)
          ::memoryAllocMonitor->enter();
+      _stats._variableSizeFrees++;
 #if defined(J9VM_OPT_JITSERVER)
       if (_isJITServer)
          freeBlockToIndexedList(block);
@@ -591,6 +626,149 @@ PersistentAllocator::freeBlock(Block * block)
       }
    }
 
+PersistentAllocator::Block *
+PersistentAllocator::allocateFromThreadCache(ThreadCache * cache, size_t index)
+   {
+   Block * block = cache->_freeBlocks[index];
+   if (!block)
+      {
+      // Refill the cache with a batch of blocks from the shared list
+      uint32_t const batchSize = threadCacheBatchSize(index);
+      j9thread_monitor_enter(_smallBlockListsMonitor);
+      Block * first = _freeBlocks[index];
+      if (first)
+         {
+         Block * last = first;
+         uint32_t numBlocks = 1;
+         while (numBlocks < batchSize && last->next())
+            {
+            last = last->next();
+            numBlocks++;
+            }
+         _freeBlocks[index] = last->next();
+         last->setNext(NULL);
+         cache->_freeBlocks[index] = first;
+         cache->_numFreeBlocks[index] = numBlocks;
+         _stats._threadCacheRefills++;
+         }
+      _stats._threadCacheAllocs += cache->_numAllocs;
+      _stats._threadCacheFrees += cache->_numFrees;
+      j9thread_monitor_exit(_smallBlockListsMonitor);
+      cache->_numAllocs = 0;
+      cache->_numFrees = 0;
+
+      block = cache->_freeBlocks[index];
+      if (!block)
+         return NULL; // caller will carve a new block out of a segment
+      }
+   cache->_freeBlocks[index] = block->next();
+   cache->_numFreeBlocks[index]--;
+   cache->_numAllocs++;
+   return block;
+   }
+
+void
+PersistentAllocator::freeToThreadCache(ThreadCache * cache, Block * block, size_t index)
+   {
+   block->setNext(cache->_freeBlocks[index]);
+   cache->_freeBlocks[index] = block;
+   cache->_numFreeBlocks[index]++;
+   cache->_numFrees++;
+
+   uint32_t const batchSize = threadCacheBatchSize(index);
+   if (cache->_numFreeBlocks[index] > 2 * batchSize)
+      {
+      // Return one batch to the shared list, keeping the most recently freed blocks
+      Block * last = cache->_freeBlocks[index];
+      for (uint32_t i = 1; i < batchSize; i++)
+         last = last->next();
+      Block * first = last->next();
+      Block * tail = first;
+      for (uint32_t i = 1; i < batchSize; i++)
+         tail = tail->next();
+      last->setNext(tail->next());
+      cache->_numFreeBlocks[index] -= batchSize;
+
+      j9thread_monitor_enter(_smallBlockListsMonitor);
+      tail->setNext(_freeBlocks[index]);
+      _freeBlocks[index] = first;
+      _stats._threadCacheFlushes++;
+      _stats._threadCacheAllocs += cache->_numAllocs;
+      _stats._threadCacheFrees += cache->_numFrees;
+      j9thread_monitor_exit(_smallBlockListsMonitor);
+      cache->_numAllocs = 0;
+      cache->_numFrees = 0;
+      }
+   }
+
+void
+PersistentAllocator::enableThreadCache()
+   {
+   if (getThreadCache())
+      return;
+   ThreadCache * cache = static_cast<ThreadCache *>(allocate(sizeof(ThreadCache), std::nothrow));
+   if (!cache)
+      return; // this thread will use the shared lists
+   memset(cache, 0, sizeof(ThreadCache));
+   if (omrthread_tls_set(j9thread_self(), _threadCacheKey, cache) != 0)
+      {
+      deallocate(cache);
+      return;
+      }
+   j9thread_monitor_enter(_smallBlockListsMonitor);
+   _numThreadCaches++;
+   j9thread_monitor_exit(_smallBlockListsMonitor);
+   }
+
+void
+PersistentAllocator::releaseThreadCache()
+   {
+   ThreadCache * cache = getThreadCache();
+   if (!cache)
+      return;
+   omrthread_tls_set(j9thread_self(), _threadCacheKey, NULL);
+
+   // Give all cached blocks back to the shared lists
+   j9thread_monitor_enter(_smallBlockListsMonitor);
+   for (size_t index = LARGE_BLOCK_LIST_INDEX + 1; index < NUM_FREE_BLOCK_LISTS; index++)
+      {
+      Block * block = cache->_freeBlocks[index];
+      while (block)
+         {
+         Block * next = block->next();
+         freeFixedSizeBlock(block);
+         block = next;
+         }
+      }
+   _stats._threadCacheAllocs += cache->_numAllocs;
+   _stats._threadCacheFrees += cache->_numFrees;
+   _numThreadCaches--;
+   j9thread_monitor_exit(_smallBlockListsMonitor);
+
+   deallocate(cache);
+   }
+
+void
+PersistentAllocator::printStatistics(FILE *file)
+   {
+   Statistics stats;
+   j9thread_monitor_enter(_smallBlockListsMonitor);
+   stats = _stats;
+   uint32_t numThreadCaches = _numThreadCaches;
+   j9thread_monitor_exit(_smallBlockListsMonitor);
+
+   fprintf(file, "Persistent allocator statistics:\n");
+   fprintf(file, "   Segments:             %llu KB\n", (unsigned long long)(stats._segmentBytes / 1024));
+   fprintf(file, "   Blocks from segments: %llu\n", (unsigned long long)stats._segmentAllocs);
+   fprintf(file, "   Thread caches:        %u active, allocs=%llu frees=%llu refills=%llu flushes=%llu\n", numThreadCaches,
+      (unsigned long long)stats._threadCacheAllocs, (unsigned long long)stats._threadCacheFrees,
+      (unsigned long long)stats._threadCacheRefills, (unsigned long long)stats._threadCacheFlushes);
+   fprintf(file, "   Shared fixed-size:    allocs=%llu frees=%llu\n",
+      (unsigned long long)stats._sharedListAllocs, (unsigned long long)stats._sharedListFrees);
+   fprintf(file, "   Variable-size:        allocs=%llu frees=%llu\n",
+      (unsigned long long)stats._variableSizeAllocs, (unsigned long long)stats._variableSizeFrees);
+   }
+
 void
 PersistentAllocator::deallocate(void * mem, size_t) throw()
    {
@@ -29,7 +29,9 @@ namespace J9 { class PersistentAllocator; }
 namespace TR { using J9::PersistentAllocator; }
 
 #include <new>
+#include <stdio.h>
 #include "j9cfg.h"
+#include "j9thread.h"
 #include "env/PersistentAllocatorKit.hpp"
 #include "env/RawAllocator.hpp"
 #include "env/TypedAllocator.hpp"
@@ -58,6 +60,20 @@ public:
    void *allocate(size_t size, void * hint = 0);
    void deallocate(void * p, size_t sizeHint = 0) throw();
 
+   /**
+    * @brief Attach a private cache of free fixed-size blocks to the calling thread
+    *
+    * Fixed-size allocations and frees done by the calling thread are then served from
+    * the cache without acquiring _smallBlockListsMonitor; blocks move between the cache
+    * and the shared free lists in batches. Meant for long lived threads that allocate
+    * heavily (compilation threads, IProfiler thread). Must be paired with
+    * releaseThreadCache() on the same thread before it exits.
+    */
+   void enableThreadCache();
+   void releaseThreadCache();
+
+   void printStatistics(FILE *file);
+
    friend bool operator ==(const PersistentAllocator &left, const PersistentAllocator &right)
       {
       return &left == &right;
@@ -97,17 +113,79 @@ private:
    J9ThreadMonitor * _smallBlockListsMonitor;
 
    static const size_t PERSISTANT_BLOCK_SIZE_BUCKETS = 16;
+   // Blocks that are too large for the small buckets but smaller than MEDIUM_BLOCK_LIMIT
+   // are segregated in size classes that are MEDIUM_BLOCK_GRANULARITY bytes apart.
+   // A medium list contains blocks at least as large as its size class, so allocations
+   // round up to the next size class and frees round down.
+   static const size_t NUM_MEDIUM_BLOCK_LISTS = 32;
+   static const size_t MEDIUM_BLOCK_GRANULARITY = 32;
+   static const size_t MEDIUM_BLOCK_MIN_SIZE = sizeof(Block) + PERSISTANT_BLOCK_SIZE_BUCKETS * sizeof(void *);
+   static const size_t MEDIUM_BLOCK_LIMIT = MEDIUM_BLOCK_MIN_SIZE + NUM_MEDIUM_BLOCK_LISTS * MEDIUM_BLOCK_GRANULARITY;
+   static const size_t NUM_FREE_BLOCK_LISTS = PERSISTANT_BLOCK_SIZE_BUCKETS + NUM_MEDIUM_BLOCK_LISTS;
    // first list/bucket is for large blocks of variable size
    static const size_t LARGE_BLOCK_LIST_INDEX = 0;
    static size_t freeBlocksIndex(size_t const blockSize)
       {
       size_t const adjustedBlockSize = blockSize - sizeof(Block);
       size_t const candidateBucket = adjustedBlockSize / sizeof(void *);
-      return candidateBucket < PERSISTANT_BLOCK_SIZE_BUCKETS ?
-         candidateBucket :
-         LARGE_BLOCK_LIST_INDEX;
+      if (candidateBucket < PERSISTANT_BLOCK_SIZE_BUCKETS)
+         return candidateBucket;
+      if (blockSize < MEDIUM_BLOCK_LIMIT)
+         return PERSISTANT_BLOCK_SIZE_BUCKETS + (blockSize - MEDIUM_BLOCK_MIN_SIZE) / MEDIUM_BLOCK_GRANULARITY;
+      return LARGE_BLOCK_LIST_INDEX;
+      }
+   // Like freeBlocksIndex, but medium sizes are rounded up to their size class
+   static size_t allocationIndex(size_t &allocSize)
+      {
+      if (allocSize >= MEDIUM_BLOCK_MIN_SIZE && allocSize < MEDIUM_BLOCK_LIMIT)
+         {
+         size_t const mediumIndex = (allocSize - MEDIUM_BLOCK_MIN_SIZE + MEDIUM_BLOCK_GRANULARITY - 1) / MEDIUM_BLOCK_GRANULARITY;
+         if (mediumIndex >= NUM_MEDIUM_BLOCK_LISTS)
+            return LARGE_BLOCK_LIST_INDEX;
+         allocSize = MEDIUM_BLOCK_MIN_SIZE + mediumIndex * MEDIUM_BLOCK_GRANULARITY;
+         return PERSISTANT_BLOCK_SIZE_BUCKETS + mediumIndex;
+         }
+      return freeBlocksIndex(allocSize);
       }
 
+   // Private cache of free fixed-size blocks owned by one thread
+   struct ThreadCache
+      {
+      Block * _freeBlocks[NUM_FREE_BLOCK_LISTS];
+      uint32_t _numFreeBlocks[NUM_FREE_BLOCK_LISTS];
+      uint64_t _numAllocs; // merged into _stats when blocks are exchanged with the shared lists
+      uint64_t _numFrees;
+      };
+   // Blocks are exchanged with the shared lists in batches of about this many bytes;
+   // a thread cache holds at most two batches per list
+   static const size_t THREAD_CACHE_BATCH_BYTES = 1024;
+   static const uint32_t THREAD_CACHE_MAX_BATCH = 32;
+   static uint32_t threadCacheBatchSize(size_t index)
+      {
+      size_t const blockSize = index < PERSISTANT_BLOCK_SIZE_BUCKETS ?
+         sizeof(Block) + index * sizeof(void *) :
+         MEDIUM_BLOCK_MIN_SIZE + (index - PERSISTANT_BLOCK_SIZE_BUCKETS) * MEDIUM_BLOCK_GRANULARITY;
+      size_t const batch = THREAD_CACHE_BATCH_BYTES / blockSize;
+      return batch == 0 ? 1 : (batch > THREAD_CACHE_MAX_BATCH ? THREAD_CACHE_MAX_BATCH : (uint32_t)batch);
+      }
+   ThreadCache * getThreadCache() const { return static_cast<ThreadCache *>(j9thread_tls_get(j9thread_self(), _threadCacheKey)); }
+   Block * allocateFromThreadCache(ThreadCache * cache, size_t index);
+   void freeToThreadCache(ThreadCache * cache, Block * block, size_t index);
+
+   struct Statistics
+      {
+      uint64_t _threadCacheAllocs;  // served from a thread cache without locking
+      uint64_t _threadCacheFrees;
+      uint64_t _threadCacheRefills; // batches moved from the shared lists to a thread cache
+      uint64_t _threadCacheFlushes; // batches moved from a thread cache to the shared lists
+      uint64_t _sharedListAllocs;   // fixed-size blocks served from the shared lists
+      uint64_t _sharedListFrees;
+      uint64_t _variableSizeAllocs;
+      uint64_t _variableSizeFrees;
+      uint64_t _segmentAllocs;      // blocks carved out of segments
+      uint64_t _segmentBytes;       // total size of segments allocated
+      };
+
    void * allocateInternal(size_t);
    Block * allocateFromVariableSizeListLocked(size_t allocSize);
    void * allocateFromSegmentLocked(size_t allocSize);
@@ -122,7 +200,12 @@ private:
 
    size_t const _minimumSegmentSize;
    SegmentAllocator _segmentAllocator;
-   Block * _freeBlocks[PERSISTANT_BLOCK_SIZE_BUCKETS];
+   Block * _freeBlocks[NUM_FREE_BLOCK_LISTS];
+   j9thread_tls_key_t _threadCacheKey;
+   volatile uint32_t _numThreadCaches; // read without the monitor to skip the TLS lookup when no thread uses a cache
+   // Fixed-size and thread cache counters are protected by _smallBlockListsMonitor;
+   // variable-size and segment counters by memoryAllocMonitor
+   Statistics _stats;
    typedef TR::typed_allocator<TR::reference_wrapper<J9MemorySegment>, TR::RawAllocator> SegmentContainerAllocator;
    typedef std::deque<TR::reference_wrapper<J9MemorySegment>, SegmentContainerAllocator> SegmentContainer;
    SegmentContainer _segments;
@@ -2937,6 +2937,19 @@ bool TR_J9VMBase::supressInliningRecognizedInitialCallee(TR_CallSite* callsite,
                dontInlineRecognizedMethod = true;
                }
             break;
+         case TR::com_ibm_jit_JITHelpers_intrinsicCompareLatin1:
+         case TR::com_ibm_jit_JITHelpers_intrinsicCompareUTF16:
+            if (comp->cg()->getSupportsInlineStringCompare())
+               {
+               dontInlineRecognizedMethod = true;
+               }
+            break;
+         case TR::java_lang_StringCoding_hasNegatives:
+            if (comp->cg()->getSupportsInlineHasNegatives())
+               {
+               dontInlineRecognizedMethod = true;
+               }
+            break;
          case TR::java_lang_Math_max_D:
          case TR::java_lang_Math_min_D:
             if(comp->cg()->getSupportsVectorRegisters() && !comp->getOption(TR_DisableSIMDDoubleMaxMin))
@@ -3572,6 +3585,8 @@ TR_J9VMBase::compilationShouldBeInterrupted(TR::Compilation * comp, TR_CallingCo
    if (compInfoPTB->compilationShouldBeInterrupted())
       return true;
 
+   compInfoPTB->checkCompilationMemoryBudget(comp);
+
    if (!comp->getOption(TR_DisableNoVMAccess))
       {
       bool exitClassUnloadMonitor = persistentMemory(_jitConfig)->getPersistentInfo()->GCwillBlockOnClassUnloadMonitor();
@@ -5229,7 +5244,17 @@ TR_J9VMBase::getDesignatedCodeCache(TR::Compilation *comp) // MCT
    bool hadClassUnloadMonitor;
    bool hadVMAccess = releaseClassUnloadMonitorAndAcquireVMaccessIfNeeded(comp, &hadClassUnloadMonitor);
 
-   TR::CodeCache * result = TR::CodeCacheManager::instance()->reserveCodeCache(false, 0, compThreadID, &numReserved);
+   // Bodies that sampling promoted to hot or scorching are placed together in
+   // the hot code cache; profiling bodies are short lived so they are kept out
+   static char *enableHotCodeCache = feGetEnv("TR_enableHotCodeCache");
+   TR::CodeCache * result = NULL;
+   if (enableHotCodeCache &&
+       comp &&
+       comp->getMethodHotness() >= hot &&
+       !comp->isProfilingCompilation())
+      result = TR::CodeCacheManager::instance()->reserveHotCodeCache(0, compThreadID, &numReserved);
+   else
+      result = TR::CodeCacheManager::instance()->reserveCodeCache(false, 0, compThreadID, &numReserved);
 
    acquireClassUnloadMonitorAndReleaseVMAccessIfNeeded(comp, hadVMAccess, hadClassUnloadMonitor);
    if (!result)
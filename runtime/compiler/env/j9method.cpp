@@ -3180,6 +3180,7 @@ void TR_ResolvedJ9Method::construct()
       {x(TR::java_lang_StringCoding_encode8859_1,       "encode8859_1",       "(B[B)[B")},
       {x(TR::java_lang_StringCoding_encodeASCII,        "encodeASCII",        "(B[B)[B")},
       {x(TR::java_lang_StringCoding_encodeUTF8,         "encodeUTF8",         "(B[B)[B")},
+      {x(TR::java_lang_StringCoding_hasNegatives,       "hasNegatives",       "([BII)Z")},
       {  TR::unknownMethod}
       };
 
@@ -3386,6 +3387,15 @@ void TR_ResolvedJ9Method::construct()
       {  TR::unknownMethod}
       };
 
+   // Signatures differ between Vector API incubator releases; the expansion checks the shape of each call
+   static X VectorSupportMethods[] =
+      {
+      {  TR::jdk_internal_vm_vector_VectorSupport_load,     4, "load",     (int16_t)-1, "*"},
+      {  TR::jdk_internal_vm_vector_VectorSupport_store,    5, "store",    (int16_t)-1, "*"},
+      {  TR::jdk_internal_vm_vector_VectorSupport_binaryOp, 8, "binaryOp", (int16_t)-1, "*"},
+      {  TR::unknownMethod}
+      };
+
    static X ArrayMethods[] =
       {
       {x(TR::java_lang_reflect_Array_getLength, "getLength", "(Ljava/lang/Object;)I")},
@@ -3443,6 +3453,8 @@ void TR_ResolvedJ9Method::construct()
       {x(TR::com_ibm_jit_JITHelpers_isArray,                                  "isArray", "(Ljava/lang/Object;)Z")},
       {x(TR::com_ibm_jit_JITHelpers_intrinsicIndexOfStringLatin1,             "intrinsicIndexOfStringLatin1", "(Ljava/lang/Object;ILjava/lang/Object;II)I")},
       {x(TR::com_ibm_jit_JITHelpers_intrinsicIndexOfStringUTF16,              "intrinsicIndexOfStringUTF16", "(Ljava/lang/Object;ILjava/lang/Object;II)I")},
+      {x(TR::com_ibm_jit_JITHelpers_intrinsicCompareLatin1,                   "intrinsicCompareLatin1", "(Ljava/lang/Object;ILjava/lang/Object;II)I")},
+      {x(TR::com_ibm_jit_JITHelpers_intrinsicCompareUTF16,                    "intrinsicCompareUTF16", "(Ljava/lang/Object;ILjava/lang/Object;II)I")},
       {x(TR::com_ibm_jit_JITHelpers_intrinsicIndexOfLatin1,                   "intrinsicIndexOfLatin1", "(Ljava/lang/Object;BII)I")},
       {x(TR::com_ibm_jit_JITHelpers_intrinsicIndexOfUTF16,                    "intrinsicIndexOfUTF16", "(Ljava/lang/Object;CII)I")},
 #ifdef TR_TARGET_32BIT
@@ -3632,6 +3644,32 @@ void TR_ResolvedJ9Method::construct()
       {  TR::unknownMethod}
       };
 
+   static X CRC32CMethods[] =
+      {
+      {x(TR::java_util_zip_CRC32C_updateBytes,             "updateBytes",             "(I[BII)I")},
+      {x(TR::java_util_zip_CRC32C_updateDirectByteBuffer,  "updateDirectByteBuffer",  "(IJII)I")},
+      {  TR::unknownMethod}
+      };
+
+   static X Base64EncoderMethods[] =
+      {
+      {x(TR::java_util_Base64_Encoder_encodeBlock,         "encodeBlock",             "([BII[BIZ)V")},
+      {  TR::unknownMethod}
+      };
+
+   static X AESCryptMethods[] =
+      {
+      {x(TR::com_sun_crypto_provider_AESCrypt_implEncryptBlock,  "implEncryptBlock",  "([BI[BI)V")},
+      {x(TR::com_sun_crypto_provider_AESCrypt_implDecryptBlock,  "implDecryptBlock",  "([BI[BI)V")},
+      {  TR::unknownMethod}
+      };
+
+   static X GHASHMethods[] =
+      {
+      {x(TR::com_sun_crypto_provider_GHASH_processBlocks,  "processBlocks",           "([BII[J[J)V")},
+      {  TR::unknownMethod}
+      };
+
    static X ByteMethods[] =
       {
       {  TR::java_lang_Byte_init,          6,    "<init>", (int16_t)-1,    "*"},
@@ -4303,6 +4341,7 @@ void TR_ResolvedJ9Method::construct()
       { "java/lang/StrictMath", StrictMathMethods },
       { "java/math/BigDecimal", BigDecimalMethods },
       { "java/math/BigInteger", BigIntegerMethods },
+      { "java/util/zip/CRC32C", CRC32CMethods     },
       { 0 }
       };
 
@@ -4347,6 +4386,7 @@ void TR_ResolvedJ9Method::construct()
       { "sun/nio/cs/UTF_8$Encoder", EncodeMethods },
       { "sun/nio/cs/UTF16_Encoder", EncodeMethods },
       { "jdk/internal/misc/Unsafe", UnsafeMethods },
+      { "java/util/Base64$Encoder", Base64EncoderMethods },
       { 0 }
       };
 
@@ -4389,6 +4429,7 @@ void TR_ResolvedJ9Method::construct()
       { "sun/nio/cs/ISO_8859_1$Encoder", EncodeMethods },
       { "sun/nio/cs/ISO_8859_1$Decoder", EncodeMethods },
       { "java/io/ByteArrayOutputStream", ByteArrayOutputStreamMethods },
+      { "com/sun/crypto/provider/GHASH", GHASHMethods },
       { 0 }
       };
 
@@ -4416,6 +4457,7 @@ void TR_ResolvedJ9Method::construct()
       { "java/lang/invoke/MutableCallSite", MutableCallSiteMethods },
       { "java/lang/invoke/PrimitiveHandle", PrimitiveHandleMethods },
       { "com/ibm/dataaccess/PackedDecimal", DataAccessPackedDecimalMethods },
+      { "com/sun/crypto/provider/AESCrypt", AESCryptMethods },
       { 0 }
       };
 
@@ -4450,6 +4492,7 @@ void TR_ResolvedJ9Method::construct()
       { "com/ibm/tenant/InternalTenantContext", MTTenantContext },
       { "java/lang/StringCoding$StringDecoder", StringCoding_StringDecoderMethods },
       { "java/lang/StringCoding$StringEncoder", StringCoding_StringEncoderMethods },
+      { "jdk/internal/vm/vector/VectorSupport", VectorSupportMethods },
       { 0 }
       };
 
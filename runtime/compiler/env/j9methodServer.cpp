@@ -1953,6 +1953,81 @@ TR_ResolvedJ9JITServerMethod::cacheFields()
       }
    }
 
+void
+TR_ResolvedJ9JITServerMethod::prefetchFieldAttributes()
+   {
+   // 1. Iterate through bytecodes and look for loads/stores
+   // If the attributes of the corresponding field or static are not cached,
+   // add them to the list of attributes that will be requested in one batch,
+   // instead of one ResolvedMethod_fieldAttributes/staticAttributes round-trip per field.
+   auto compInfoPT = _fe->_compInfoPT;
+   TR::Compilation *comp = compInfoPT->getCompilation();
+   // AOT compilations need field attributes with validation records, which are
+   // created per request by TR_ResolvedRelocatableJ9JITServerMethod
+   if (comp->compileRelocatableCode())
+      return;
+
+   TR_J9ByteCodeIterator bci(0, this, _fe, comp);
+   std::vector<int32_t> cpIndices;
+   std::vector<uint8_t> isStaticField;
+   std::vector<uint8_t> isStoreField;
+   for (TR_J9ByteCode bc = bci.first(); bc != J9BCunknown; bc = bci.next())
+      {
+      bool isStatic;
+      bool isStore;
+      switch (bc)
+         {
+         case J9BCgetfield:  isStatic = false; isStore = false; break;
+         case J9BCputfield:  isStatic = false; isStore = true;  break;
+         case J9BCgetstatic: isStatic = true;  isStore = false; break;
+         case J9BCputstatic: isStatic = true;  isStore = true;  break;
+         default: continue;
+         }
+
+      int32_t cpIndex = bci.next2Bytes();
+      TR_J9MethodFieldAttributes attributes;
+      if (getCachedFieldAttributes(cpIndex, attributes, isStatic))
+         continue;
+
+      // The same field can be accessed many times in a method, only ask for it once
+      bool alreadyRequested = false;
+      for (size_t i = 0; i < cpIndices.size(); ++i)
+         {
+         if (cpIndices[i] == cpIndex && isStaticField[i] == isStatic)
+            {
+            alreadyRequested = true;
+            break;
+            }
+         }
+      if (!alreadyRequested)
+         {
+         cpIndices.push_back(cpIndex);
+         isStaticField.push_back(isStatic);
+         isStoreField.push_back(isStore);
+         }
+      }
+
+   // If there's just one field, it's faster to get it through regular means,
+   // to avoid overhead of vectors
+   int32_t numFields = cpIndices.size();
+   if (numFields < 2)
+      return;
+
+   // 2. Send a message to get the attributes of all fields
+   _stream->write(JITServer::MessageType::ResolvedMethod_getMultipleFieldAttributes, _remoteMirror, cpIndices, isStaticField, isStoreField);
+   auto recv = _stream->read<std::vector<TR_J9MethodFieldAttributes>>();
+
+   // 3. Cache all received attributes
+   auto &attributes = std::get<0>(recv);
+   TR_ASSERT(numFields == attributes.size(), "Number of received field attributes does not match the requested number");
+   for (int32_t i = 0; i < numFields; ++i)
+      {
+      TR_J9MethodFieldAttributes cachedAttributes;
+      if (!getCachedFieldAttributes(cpIndices[i], cachedAttributes, isStaticField[i]))
+         cacheFieldAttributes(cpIndices[i], attributes[i], isStaticField[i]);
+      }
+   }
+
 int32_t
 TR_ResolvedJ9JITServerMethod::collectImplementorsCapped(
    TR_OpaqueClassBlock *topClass,
@@ -163,6 +163,10 @@ public:
    void setVersionCheckStatus()
       {
       _versionCheckStatus = PASSED;
+      // The server runs a compatible version, so it can interpret the compression
+      // flags; it starts compressing its responses once it sees our advertisement
+      if (useCompression())
+         enableCompression();
       }
 
    /**
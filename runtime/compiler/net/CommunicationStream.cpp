@@ -20,10 +20,13 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include <string.h>
 #include "control/CompilationRuntime.hpp"
 #include "control/Options.hpp" // TR::Options::useCompressedPointers()
 #include "env/CompilerEnv.hpp" // for TR::Compiler->target.is64Bit()
 #include "net/CommunicationStream.hpp"
+#include "runtime/JITServerMetrics.hpp"
+#include "zlib.h"
 
 
 namespace JITServer
@@ -31,6 +34,7 @@ namespace JITServer
 uint32_t CommunicationStream::CONFIGURATION_FLAGS = 0;
 #ifdef MESSAGE_SIZE_STATS
 TR_Stats JITServer::CommunicationStream::collectMsgStat[];
+TR_Stats JITServer::CommunicationStream::collectMsgCompressionRatio[];
 #endif
 
 void
@@ -51,6 +55,11 @@ bool CommunicationStream::useSSL()
            compInfo->getJITServerSslRootCerts().size());
    }
 
+bool CommunicationStream::useCompression()
+   {
+   return TR::CompilationInfo::get()->getPersistentInfo()->getJITServerUseCompression();
+   }
+
 void CommunicationStream::initSSL()
    {
    (*OSSL_load_error_strings)();
@@ -66,22 +75,40 @@ CommunicationStream::readMessage2(Message &msg)
    msg.clearForRead();
 
    // read message size
-   uint32_t serializedSize;
-   readBlocking(serializedSize);
+   uint32_t sizeWord;
+   readBlocking(sizeWord);
+   _peerAcceptsCompression = (sizeWord & MessageAcceptsCompression) != 0;
+   uint32_t wireSize = sizeWord & MessageSizeMask;
+   uint32_t serializedSize = wireSize;
 
-   msg.expandBufferIfNeeded(serializedSize);
-   msg.setSerializedSize(serializedSize);
+   if (sizeWord & MessageCompressed)
+      {
+      // read the compressed message into the scratch buffer and inflate it into msg
+      expandCompressionBufferIfNeeded(wireSize);
+      *(uint32_t *)_compressionBuffer = sizeWord;
+      readBlocking(_compressionBuffer + sizeof(uint32_t), wireSize - sizeof(uint32_t));
+      serializedSize = decompressMessage(msg, _compressionBuffer, wireSize);
+      msg.setSerializedSize(serializedSize);
+      }
+   else
+      {
+      msg.expandBufferIfNeeded(serializedSize);
+      msg.setSerializedSize(serializedSize);
 
-   // read the rest of the message
-   uint32_t messageSize = serializedSize - sizeof(uint32_t);
-   readBlocking(msg.getBufferStartForRead() + sizeof(uint32_t), messageSize);
+      // read the rest of the message
+      uint32_t messageSize = serializedSize - sizeof(uint32_t);
+      readBlocking(msg.getBufferStartForRead() + sizeof(uint32_t), messageSize);
+      }
 
    // rebuild the message
    msg.deserialize();
+   recordMessageReceived(msg.type(), wireSize);
 
    // collect message size
 #ifdef MESSAGE_SIZE_STATS
    collectMsgStat[int(msg.type())].update(serializedSize);
+   if (sizeWord & MessageCompressed)
+      collectMsgCompressionRatio[int(msg.type())].update((double)serializedSize / wireSize);
 #endif
    }
 
@@ -105,7 +132,9 @@ CommunicationStream::readMessage(Message &msg)
       }
 
    // bytesRead >= sizeof(uint32_t)
-   uint32_t serializedSize = ((uint32_t *)buffer)[0];
+   uint32_t sizeWord = ((uint32_t *)buffer)[0];
+   _peerAcceptsCompression = (sizeWord & MessageAcceptsCompression) != 0;
+   uint32_t serializedSize = sizeWord & MessageSizeMask;
    if (bytesRead > serializedSize)
       {
       throw JITServer::StreamFailure("JITServer I/O error: read more than the message size");
@@ -128,13 +157,26 @@ CommunicationStream::readMessage(Message &msg)
       readBlocking(buffer + bytesRead, bytesLeftToRead);
       }
 
+   uint32_t wireSize = serializedSize;
+   if (sizeWord & MessageCompressed)
+      {
+      // The compressed message was read into the message buffer; move it
+      // out of the way so that it can be inflated in place of itself
+      expandCompressionBufferIfNeeded(wireSize);
+      memcpy(_compressionBuffer, buffer, wireSize);
+      serializedSize = decompressMessage(msg, _compressionBuffer, wireSize);
+      }
+
    msg.setSerializedSize(serializedSize);
 
    // rebuild the message
    msg.deserialize();
+   recordMessageReceived(msg.type(), wireSize);
 
 #ifdef MESSAGE_SIZE_STATS
    collectMsgStat[int(msg.type())].update(serializedSize);
+   if (sizeWord & MessageCompressed)
+      collectMsgCompressionRatio[int(msg.type())].update((double)serializedSize / wireSize);
 #endif
    }
 
@@ -142,8 +184,118 @@ void
 CommunicationStream::writeMessage(Message &msg)
    {
    char *serialMsg = msg.serialize();
+   uint32_t serializedSize = msg.serializedSize();
+   // The upper bits of the size word are flags; a larger message cannot be represented
+   // on the wire, so reject it before anything is written instead of corrupting the stream
+   if (serializedSize & ~MessageSizeMask)
+      {
+      msg.clearForWrite();
+      throw JITServer::StreamFailure("JITServer I/O error: message is too large to be sent");
+      }
+   if (_compressionEnabled)
+      {
+      // Compress only if the peer can process compressed messages and the message
+      // is large enough for the savings on the wire to outweigh the CPU cost
+      if (_peerAcceptsCompression &&
+          serializedSize >= TR::CompilationInfo::get()->getPersistentInfo()->getJITServerCompressionThreshold())
+         {
+         uint32_t compressedSize = compressMessage(serialMsg, serializedSize);
+         if (compressedSize)
+            {
+            *(uint32_t *)_compressionBuffer = compressedSize | MessageCompressed | MessageAcceptsCompression;
+            writeBlocking(_compressionBuffer, compressedSize);
+            recordMessageSent(msg.type(), compressedSize);
+            msg.clearForWrite();
+            return;
+            }
+         }
+      *(uint32_t *)serialMsg |= MessageAcceptsCompression;
+      }
    // write serialized message to the socket
-   writeBlocking(serialMsg, msg.serializedSize());
+   writeBlocking(serialMsg, serializedSize);
+   recordMessageSent(msg.type(), serializedSize);
    msg.clearForWrite();
    }
+
+void
+CommunicationStream::recordMessageSent(MessageType type, uint32_t wireSize)
+   {
+   JITServerMetrics *metrics = TR::CompilationInfo::get()->getJITServerMetrics();
+   if (metrics)
+      {
+      metrics->recordBytesSent(type, wireSize);
+      _lastWrittenType = type;
+      _lastWriteTimeUs = JITServerMetrics::getTimeUs();
+      }
+   }
+
+void
+CommunicationStream::recordMessageReceived(MessageType type, uint32_t wireSize)
+   {
+   JITServerMetrics *metrics = TR::CompilationInfo::get()->getJITServerMetrics();
+   if (metrics)
+      {
+      metrics->recordBytesReceived(type, wireSize);
+      // A response carries the type of the message it answers
+      if (type == _lastWrittenType)
+         metrics->recordRoundTrip(type, JITServerMetrics::getTimeUs() - _lastWriteTimeUs);
+      _lastWrittenType = MessageType_MAXTYPE;
+      }
+   }
+
+void
+CommunicationStream::expandCompressionBufferIfNeeded(uint32_t requiredSize)
+   {
+   if (requiredSize > _compressionBufferCapacity)
+      {
+      // The content of the scratch buffer never needs to be preserved
+      if (_compressionBuffer)
+         TR_Memory::jitPersistentFree(_compressionBuffer);
+      _compressionBufferCapacity = requiredSize * 2;
+      _compressionBuffer = static_cast<char *>(TR_Memory::jitPersistentAlloc(_compressionBufferCapacity));
+      if (!_compressionBuffer)
+         {
+         _compressionBufferCapacity = 0;
+         throw std::bad_alloc();
+         }
+      }
+   }
+
+uint32_t
+CommunicationStream::compressMessage(const char *serialMsg, uint32_t serializedSize)
+   {
+   // The size word is rewritten after compression, so only the rest of the message is compressed.
+   // The output buffer is limited to the original size so that deflating stops early
+   // for messages that do not compress well; these are sent uncompressed.
+   if (serializedSize <= COMPRESSED_HEADER_SIZE)
+      return 0;
+   uint32_t payloadSize = serializedSize - sizeof(uint32_t);
+   expandCompressionBufferIfNeeded(serializedSize);
+   uLongf compressedPayloadSize = serializedSize - COMPRESSED_HEADER_SIZE;
+   int ret = compress2((Bytef *)_compressionBuffer + COMPRESSED_HEADER_SIZE, &compressedPayloadSize,
+                       (const Bytef *)serialMsg + sizeof(uint32_t), payloadSize, Z_BEST_SPEED);
+   if (ret != Z_OK)
+      return 0;
+   ((uint32_t *)_compressionBuffer)[1] = serializedSize;
+   return COMPRESSED_HEADER_SIZE + compressedPayloadSize;
+   }
+
+uint32_t
+CommunicationStream::decompressMessage(Message &msg, const char *compressedMsg, uint32_t compressedSize)
+   {
+   if (compressedSize < COMPRESSED_HEADER_SIZE)
+      throw JITServer::StreamFailure("JITServer I/O error: compressed message is too small");
+
+   uint32_t serializedSize = ((const uint32_t *)compressedMsg)[1];
+   if ((serializedSize & ~MessageSizeMask) || serializedSize < sizeof(uint32_t))
+      throw JITServer::StreamFailure("JITServer I/O error: invalid size of compressed message");
+
+   msg.expandBufferIfNeeded(serializedSize);
+   uLongf payloadSize = serializedSize - sizeof(uint32_t);
+   int ret = uncompress((Bytef *)msg.getBufferStartForRead() + sizeof(uint32_t), &payloadSize,
+                        (const Bytef *)compressedMsg + COMPRESSED_HEADER_SIZE, compressedSize - COMPRESSED_HEADER_SIZE);
+   if ((ret != Z_OK) || (payloadSize != serializedSize - sizeof(uint32_t)))
+      throw JITServer::StreamFailure("JITServer I/O error: fail to decompress the message");
+   return serializedSize;
+   }
 }
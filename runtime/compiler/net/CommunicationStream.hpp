@@ -40,6 +40,16 @@ enum JITServerCompatibilityFlags
    JITServerCompressedRef      = 0x00001000,
    };
 
+// The upper bits of the size word that starts every message on the wire
+// are used as flags, the rest encodes the size of the message in bytes.
+// Messages are therefore limited to 1 GB; writeMessage() rejects larger ones.
+enum JITServerMessageSizeFlags
+   {
+   MessageSizeMask             = 0x3FFFFFFF,
+   MessageCompressed           = 0x40000000, // payload after the size word is compressed
+   MessageAcceptsCompression   = 0x80000000, // sender can process compressed messages
+   };
+
 class CommunicationStream
    {
 public:
@@ -48,10 +58,17 @@ public:
 
 #ifdef MESSAGE_SIZE_STATS
    static TR_Stats collectMsgStat[JITServer::MessageType_ARRAYSIZE];
+   // Ratio between the serialized and the wire size of received compressed messages
+   static TR_Stats collectMsgCompressionRatio[JITServer::MessageType_ARRAYSIZE];
 #endif
 
    static void initConfigurationFlags();
 
+   /**
+      @brief Whether message compression was enabled with -XX:+JITServerUseCompression
+   */
+   static bool useCompression();
+
    static uint32_t getJITServerVersion()
       {
       return (MAJOR_NUMBER << 24) | (MINOR_NUMBER << 8); // PATCH_NUMBER is ignored
@@ -71,7 +88,13 @@ public:
 protected:
    CommunicationStream() :
       _ssl(NULL),
-      _connfd(-1)
+      _connfd(-1),
+      _compressionEnabled(false),
+      _peerAcceptsCompression(false),
+      _compressionBuffer(NULL),
+      _compressionBufferCapacity(0),
+      _lastWrittenType(MessageType_MAXTYPE),
+      _lastWriteTimeUs(0)
       {
       static_assert(
          sizeof(messageNames) / sizeof(messageNames[0]) == MessageType_ARRAYSIZE,
@@ -85,6 +108,9 @@ protected:
 
       if (_ssl)
          (*OBIO_free_all)(_ssl);
+
+      if (_compressionBuffer)
+         TR_Memory::jitPersistentFree(_compressionBuffer);
       }
 
    void initStream(int connfd, BIO *ssl)
@@ -102,6 +128,17 @@ protected:
    void writeMessage(Message &msg);
 
    int getConnFD() const { return _connfd; }
+
+   /**
+      @brief Allow this stream to advertise that it can process compressed messages
+      and to compress outgoing messages once the peer advertised the same.
+
+      Must only be called once the peer is known to run a compatible version,
+      because older versions cannot interpret the flags in the size word.
+   */
+   void enableCompression() { _compressionEnabled = true; }
+   bool isCompressionEnabled() const { return _compressionEnabled; }
+   bool peerAcceptsCompression() const { return _peerAcceptsCompression; }
    
    BIO *_ssl; // SSL connection, null if not using SSL
    int _connfd;
@@ -109,11 +146,46 @@ protected:
    ClientMessage _cMsg;
 
    static const uint8_t MAJOR_NUMBER = 1;
-   static const uint16_t MINOR_NUMBER = 14;
+   static const uint16_t MINOR_NUMBER = 18;
    static const uint8_t PATCH_NUMBER = 0;
    static uint32_t CONFIGURATION_FLAGS;
 
 private:
+   // A compressed message starts with the size word (including flags) followed by
+   // the serialized size of the message before compression
+   static const uint32_t COMPRESSED_HEADER_SIZE = 2 * sizeof(uint32_t);
+
+   /**
+      @brief Compress a serialized message into _compressionBuffer
+
+      @return The size of the compressed message including its header, or 0
+      if compression failed or did not make the message smaller
+   */
+   uint32_t compressMessage(const char *serialMsg, uint32_t serializedSize);
+
+   /**
+      @brief Inflate a compressed message into the buffer of msg
+
+      @param compressedMsg Pointer to the start of the compressed message (the size word)
+      @param compressedSize Size of the compressed message including its header
+
+      @return The serialized size of the inflated message
+   */
+   uint32_t decompressMessage(Message &msg, const char *compressedMsg, uint32_t compressedSize);
+
+   void expandCompressionBufferIfNeeded(uint32_t requiredSize);
+
+   // Update the JITServer metrics, if enabled, with a message that was just sent or received
+   void recordMessageSent(MessageType type, uint32_t wireSize);
+   void recordMessageReceived(MessageType type, uint32_t wireSize);
+
+   bool _compressionEnabled; // this side accepts compressed messages and advertises it
+   bool _peerAcceptsCompression; // flag carried by the last message received from the peer
+   char *_compressionBuffer; // scratch space for compressed messages, allocated on first use
+   uint32_t _compressionBufferCapacity;
+   MessageType _lastWrittenType; // used to match responses with requests for latency metrics
+   uint64_t _lastWriteTimeUs;
+
    // readBlocking and writeBlocking are functions that directly read/write
    // passed object from/to the socket. For the object to be correctly written,
    // it needs to be contiguous.
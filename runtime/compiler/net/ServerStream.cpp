@@ -32,6 +32,8 @@ ServerStream::ServerStream(int connfd, BIO *ssl)
    {
    initStream(connfd, ssl);
    _numConnectionsOpened++;
+   _clientId = 0;
    _pClientSessionData = NULL;
+   _requestReceivedTimeUs = 0;
    }
 }
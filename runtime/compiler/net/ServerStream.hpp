@@ -163,6 +163,10 @@ public:
          throw StreamVersionIncompatible(getJITServerFullVersion(), _cMsg.fullVersion());
          }
 
+      // Only clients that passed the version check advertise support for compressed messages
+      if (!isCompressionEnabled() && peerAcceptsCompression() && useCompression())
+         enableCompression();
+
       switch (_cMsg.type())
          {
          case MessageType::connectionTerminate:
@@ -257,6 +261,13 @@ public:
       return (_pClientSessionData) ? _pClientSessionData->isClassUnloadingAttempted() : false;
       }
 
+   // Used by the listener to watch idle connections for new requests
+   using CommunicationStream::getConnFD;
+
+   // Time (usec) the listener saw the next compilation request arrive; 0 if unknown
+   uint64_t getRequestReceivedTimeUs() const { return _requestReceivedTimeUs; }
+   void setRequestReceivedTimeUs(uint64_t timeUs) { _requestReceivedTimeUs = timeUs; }
+
    // Statistics
    static int getNumConnectionsOpened() { return _numConnectionsOpened; }
    static int getNumConnectionsClosed() { return _numConnectionsClosed; }
@@ -266,6 +277,7 @@ private:
    static int _numConnectionsClosed;
    uint64_t _clientId;  // UID of client connected to this communication stream
    ClientSessionData *_pClientSessionData;
+   uint64_t _requestReceivedTimeUs;
    };
 
 
@@ -99,6 +99,11 @@
 #define MAX_SIZE_FOR_ALL_OBJECTS             3000 // Increased from 500
 #define MAX_SNIFF_BYTECODE_SIZE              1600
 
+// With profiled block frequencies, an escape point that runs at most once for
+// every PROFILED_COLD_ESCAPE_RATIO executions of the allocation is compensated
+// for by heapifying the candidate there rather than failing it
+#define PROFILED_COLD_ESCAPE_RATIO           20
+
 #define LOCAL_OBJECTS_COLLECTABLE 1
 
 extern void createGuardSiteForRemovedGuard(TR::Compilation *comp, TR::Node* ifNode);
@@ -142,6 +147,8 @@ TR_EscapeAnalysis::TR_EscapeAnalysis(TR::OptimizationManager *manager)
 
    static char *disableLoopAliasAllocationChecking = feGetEnv("TR_disableEALoopAliasAllocationChecking");
    _doLoopAllocationAliasChecking = (disableLoopAliasAllocationChecking == NULL);
+
+   _useProfiledColdEscapes = false;
    }
 
 char *TR_EscapeAnalysis::getClassName(TR::Node *classNode)
@@ -267,6 +274,12 @@ int32_t TR_EscapeAnalysis::perform()
    if (getLastRun())
       _maxPassNumber = 0; // Notwithstanding our heuristics, if this is the last run, our max "pass number" is zero (which is the first pass)
 
+   // Block frequencies only say which escape points are rarely executed if
+   // they come from JProfiling or from interpreter branch profiles
+   static char *disableProfiledColdEscapes = feGetEnv("TR_disableEAProfiledColdEscapes");
+   _useProfiledColdEscapes = !disableProfiledColdEscapes &&
+                             (comp()->hasBlockFrequencyInfo() || comp()->getFlowGraph()->hasBranchProfilingData());
+
    _maxPeekedBytecodeSize  = comp()->getMaxPeekedBytecodeSize();
 
    // Escape analysis is organized so that it may decide another pass of
@@ -1878,13 +1891,50 @@ Candidate *TR_EscapeAnalysis::createCandidateIfValid(TR::Node *node, TR_OpaqueCl
 bool TR_EscapeAnalysis::isEscapePointCold(Candidate *candidate, TR::Node *node)
    {
    static const char *disableColdEsc = feGetEnv("TR_DisableColdEscape");
-   if (!disableColdEsc &&
-       (_inColdBlock ||
+   if (disableColdEsc)
+      return false;
+
+   if ((_inColdBlock ||
         (candidate->isInsideALoop() &&
          (candidate->_block->getFrequency() > 4*_curBlock->getFrequency()))) &&
        (candidate->_origKind == TR::New))
       return true;
 
+   return isEscapePointProfiledCold(candidate);
+   }
+
+
+// Partial escape analysis: using profiled block frequencies, decide whether the
+// current escape point is rare enough relative to the allocation that the
+// candidate should stay local on the hot paths and only be materialized on the
+// heap here.  Besides objects, this covers primitive arrays, whose contents can
+// be copied to the heap with int shadows; reference arrays are excluded because
+// that copy would bypass the write barrier.
+//
+bool TR_EscapeAnalysis::isEscapePointProfiledCold(Candidate *candidate)
+   {
+   if (!_useProfiledColdEscapes)
+      return false;
+
+   if (candidate->_origKind != TR::New && candidate->_origKind != TR::newarray)
+      return false;
+
+   if (candidate->_origKind != TR::New && comp()->generateArraylets())
+      return false;
+
+   int32_t allocationFrequency = candidate->_block->getFrequency();
+   int32_t escapeFrequency = _curBlock->getFrequency();
+   if (allocationFrequency <= MAX_COLD_BLOCK_COUNT+1 || escapeFrequency < 0)
+      return false;
+
+   if (_inColdBlock || (int64_t)escapeFrequency*PROFILED_COLD_ESCAPE_RATIO <= allocationFrequency)
+      {
+      if (trace())
+         traceMsg(comp(), "   Escape of candidate [%p] in block_%d (frequency %d) is cold relative to its allocation (frequency %d)\n",
+                  candidate->_node, _curBlock->getNumber(), escapeFrequency, allocationFrequency);
+      return true;
+      }
+
    return false;
    }
 
@@ -3644,7 +3694,10 @@ bool TR_EscapeAnalysis::checkIfEscapePointIsCold(Candidate *candidate, TR::Node
          {
          candidate->setObjectIsReferenced();
 
-         if (!isImmutableObject(candidate) && (_parms || !node->getOpCode().isReturn()))
+         // Arrays are only heapified from a contiguous stack allocation
+         //
+         if (!isImmutableObject(candidate) &&
+             (_parms || !node->getOpCode().isReturn() || candidate->_origKind != TR::New))
             {
             //candidate->setObjectIsReferenced();
             if (trace())
@@ -5332,11 +5385,29 @@ void TR_EscapeAnalysis::checkObjectSizes()
       int32_t    largestNonContiguousObjectSize = -1;
       Candidate *largestNonContiguousObject     = NULL;
 
+      // With profiled block frequencies, only candidates from the least
+      // frequently executed allocation blocks are considered, so that the
+      // stack space goes to the hottest allocations
+      //
+      int32_t coldestFrequency = -1;
+      if (_useProfiledColdEscapes)
+         {
+         for (candidate = _candidates.getFirst(); candidate; candidate = candidate->getNext())
+            {
+            if (candidate->isLocalAllocation() &&
+                (coldestFrequency < 0 || candidate->_block->getFrequency() < coldestFrequency))
+               coldestFrequency = candidate->_block->getFrequency();
+            }
+         }
+
       for (candidate = _candidates.getFirst(); candidate; candidate = candidate->getNext())
          {
          if (!candidate->isLocalAllocation())
             continue;
 
+         if (coldestFrequency >= 0 && candidate->_block->getFrequency() > coldestFrequency)
+            continue;
+
          if (candidate->isContiguousAllocation())
             {
             if (candidate->_size > largestContiguousObjectSize)
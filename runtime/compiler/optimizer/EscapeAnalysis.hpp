@@ -555,6 +555,7 @@ class TR_EscapeAnalysis : public TR::Optimization
    bool     checkIfUseIsInSameLoopAsDef(TR::TreeTop *defTree, TR::Node *useNode);
 
    bool     isEscapePointCold(Candidate *candidate, TR::Node *node);
+   bool     isEscapePointProfiledCold(Candidate *candidate);
    bool     checkIfEscapePointIsCold(Candidate *candidate, TR::Node *node);
    void     forceEscape(TR::Node *node, TR::Node *reason, bool forceFail = false);
    bool     restrictCandidates(TR::Node *node, TR::Node *reason, restrictionType);
@@ -725,6 +726,7 @@ class TR_EscapeAnalysis : public TR::Optimization
    bool                       _repeatAnalysis;
    bool                       _somethingChanged;
    bool                       _doLoopAllocationAliasChecking;
+   bool                       _useProfiledColdEscapes;
    TR_ScratchList<TR_DependentAllocations> _dependentAllocations;
    TR_BitVector *             _vnTemp;
    TR_BitVector *             _vnTemp2;
@@ -63,6 +63,7 @@
 #include "ras/DebugCounter.hpp"
 #include "j9consts.h"
 #include "optimizer/TransformUtil.hpp"
+#include "optimizer/VectorAPIExpansion.hpp"
 
 namespace TR { class SimpleRegex; }
 
@@ -2421,6 +2422,32 @@ TR_J9InlinerPolicy::willBeInlinedInCodeGen(TR::RecognizedMethod method)
       }
 #endif
 
+   // Left as calls so that VectorAPIExpansion can replace them with vector IL;
+   // the pass inlines the ones it does not expand once it has run
+   if (TR_VectorAPIExpansion::isVectorAPIMethod(method) &&
+       !comp()->getVectorAPICallsInlineable() &&
+       TR_VectorAPIExpansion::isEnabled(comp()))
+      {
+      return true;
+      }
+
+   // Left as calls so that RecognizedCallTransformer can hand them to the code generator
+   switch (method)
+      {
+      case TR::java_util_zip_CRC32C_updateBytes:
+      case TR::java_util_zip_CRC32C_updateDirectByteBuffer:
+         return comp()->cg()->getSupportsInlineCRC32C();
+      case TR::java_util_Base64_Encoder_encodeBlock:
+         return comp()->cg()->getSupportsInlineBase64Encode();
+      case TR::com_sun_crypto_provider_AESCrypt_implEncryptBlock:
+      case TR::com_sun_crypto_provider_AESCrypt_implDecryptBlock:
+         return comp()->cg()->getSupportsInlineAESBlock();
+      case TR::com_sun_crypto_provider_GHASH_processBlocks:
+         return comp()->cg()->getSupportsInlineGHASH();
+      default:
+         break;
+      }
+
    return false;
    }
 
@@ -2489,7 +2516,11 @@ int32_t TR_Inliner::perform()
   //and it's temporary anyways
   static const char* enableMT4Testing = feGetEnv("TR_EnableMT4Testing");
 
-  if (!enableMT4Testing)
+  // Hot compilations build a polymorphic inline cache at bimorphic and trimorphic
+  // sites: each profiled receiver type gets its own guard and inlined body, and the
+  // original virtual or interface call remains as the fallthrough
+  if (!enableMT4Testing &&
+      (comp()->getMethodHotness() < hot || TR::Options::getMaxPolymorphicInlinedTargets() <= 1))
       comp()->setOption(TR_DisableMultiTargetInlining);
 
 
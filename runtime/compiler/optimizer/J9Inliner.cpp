@@ -855,6 +855,7 @@ void TR_ProfileableCallSite::findSingleProfiledReceiver(ListIterator<TR_ExtraAdd
 
    bool firstInstanceOfCheckFailed = false;
    int32_t totalFrequency = valueInfo->getTotalFrequency();
+   int32_t maxTargets = comp()->getOption(TR_DisableMultiTargetInlining) ? 1 : std::max(TR::Options::getMaxPolymorphicInlinedTargets(), 1);
 
 
    for (TR_ExtraAddressInfo *profiledInfo = sortedValuesIt.getFirst(); profiledInfo != NULL; profiledInfo = sortedValuesIt.getNext())
@@ -888,7 +889,8 @@ void TR_ProfileableCallSite::findSingleProfiledReceiver(ListIterator<TR_ExtraAdd
 
 
       static const char* userMinProfiledCallFreq = feGetEnv("TR_MinProfiledCallFrequency");
-      static const float minProfiledCallFrequency = userMinProfiledCallFreq ? atof (userMinProfiledCallFreq) :
+      // TR_DisableMultiTargetInlining is set per compilation by the inliner, so the default cannot be cached
+      const float minProfiledCallFrequency = userMinProfiledCallFreq ? atof (userMinProfiledCallFreq) :
          comp()->getOption(TR_DisableMultiTargetInlining) ? MIN_PROFILED_CALL_FREQUENCY : .10f;
 
       if ((val >= minProfiledCallFrequency ||
@@ -972,8 +974,11 @@ void TR_ProfileableCallSite::findSingleProfiledReceiver(ListIterator<TR_ExtraAdd
          heuristicTrace(inliner->tracer(),"Creating a profiled call. callee Symbol %p frequencyadjustment %f",_initialCalleeSymbol, val);
          addTarget(comp()->trMemory(),inliner,guard,targetMethod,tempreceiverClass,heapAlloc,val);
 
-         if (comp()->getOption(TR_DisableMultiTargetInlining))
+         if (numTargets() >= maxTargets)
+            {
+            heuristicTrace(inliner->tracer(),"Reached the limit of %d profiled targets for call site %p", maxTargets, this);
             return;
+            }
          }
       else  // if we're below the above threshold, lets stop considering call targets
          {
@@ -116,6 +116,130 @@ void J9::RecognizedCallTransformer::process_java_lang_StrictMath_and_Math_sqrt(T
 
    TR::TransformUtil::removeTree(comp(), treetop);
    }
+TR::Node* J9::RecognizedCallTransformer::createArrayElementAddress(TR::Node* array, TR::Node* offset)
+   {
+   TR::Node* displacement = TR::Node::lconst(array, TR::Compiler->om.contiguousArrayHeaderSizeInBytes());
+   if (offset)
+      displacement = TR::Node::create(array, TR::ladd, 2, TR::Node::create(array, TR::i2l, 1, offset), displacement);
+
+   return TR::Node::create(array, TR::aladd, 2, array, displacement);
+   }
+
+void J9::RecognizedCallTransformer::splitReceiverNullCheck(TR::TreeTop* treetop, TR::Node* node)
+   {
+   TR::Node* ttNode = treetop->getNode();
+   if (ttNode->getOpCode().isNullCheck())
+      {
+      TR::Node* passThrough = TR::Node::create(node, TR::PassThrough, 1, ttNode->getNullCheckReference());
+      treetop->insertBefore(TR::TreeTop::create(comp(), TR::Node::createWithSymRef(ttNode->getOpCodeValue(), 1, 1, passThrough, ttNode->getSymbolReference())));
+      TR::Node::recreate(ttNode, TR::treetop);
+      }
+   }
+
+void J9::RecognizedCallTransformer::replaceCallArguments(TR::TreeTop* treetop, TR::Node* node, int32_t numArgs, TR::Node** args)
+   {
+   // The receiver is dropped from instance methods, so a null check on it has to be kept separately
+   splitReceiverNullCheck(treetop, node);
+
+   for (int32_t i = 0; i < numArgs; i++)
+      args[i]->incReferenceCount();
+
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      node->getChild(i)->recursivelyDecReferenceCount();
+
+   node->setNumChildren(numArgs);
+   for (int32_t i = 0; i < numArgs; i++)
+      node->setChild(i, args[i]);
+   }
+
+void J9::RecognizedCallTransformer::process_java_util_zip_CRC32C_update(TR::TreeTop* treetop, TR::Node* node)
+   {
+   TR::Node* crc = node->getChild(0);
+   TR::Node* buffer = node->getChild(1);
+   TR::Node* off = node->getChild(2);
+   TR::Node* end = node->getChild(3);
+
+   TR::Node* address = NULL;
+   if (node->getSymbol()->castToMethodSymbol()->getMandatoryRecognizedMethod() == TR::java_util_zip_CRC32C_updateBytes)
+      address = createArrayElementAddress(buffer, off);
+   else
+      address = TR::Node::create(node, TR::l2a, 1, TR::Node::create(node, TR::ladd, 2, buffer, TR::Node::create(node, TR::i2l, 1, off)));
+
+   TR::Node* args[] = { crc, address, TR::Node::create(node, TR::isub, 2, end, off) };
+   replaceCallArguments(treetop, node, 3, args);
+   }
+
+void J9::RecognizedCallTransformer::process_java_util_Base64_Encoder_encodeBlock(TR::TreeTop* treetop, TR::Node* node)
+   {
+   TR::Node* src = node->getChild(1);
+   TR::Node* sp = node->getChild(2);
+   TR::Node* sl = node->getChild(3);
+   TR::Node* dst = node->getChild(4);
+   TR::Node* dp = node->getChild(5);
+   TR::Node* isURL = node->getChild(6);
+
+   TR::Node* args[] =
+      {
+      createArrayElementAddress(src, sp),
+      TR::Node::create(node, TR::isub, 2, sl, sp),
+      createArrayElementAddress(dst, dp),
+      isURL
+      };
+   replaceCallArguments(treetop, node, 4, args);
+   }
+
+TR::SymbolReference* J9::RecognizedCallTransformer::findAESCryptKeySymbolReference(TR::Node* node)
+   {
+   TR_J9VMBase* fej9 = static_cast<TR_J9VMBase*>(comp()->fe());
+   TR_OpaqueClassBlock* aesCryptClass = node->getSymbol()->castToResolvedMethodSymbol()->getResolvedMethod()->containingClass();
+   uint32_t keyOffset = fej9->getInstanceFieldOffset(aesCryptClass, "K", "[I");
+   if (keyOffset == ~0)
+      return NULL;
+
+   return comp()->getSymRefTab()->findOrFabricateShadowSymbol(aesCryptClass,
+                                                             TR::Address,
+                                                             keyOffset + fej9->getObjectHeaderSizeInBytes(),
+                                                             false /* isVolatile */,
+                                                             true /* isPrivate */,
+                                                             false /* isFinal */,
+                                                             "K",
+                                                             "[I");
+   }
+
+void J9::RecognizedCallTransformer::process_com_sun_crypto_provider_AESCrypt_cryptBlock(TR::TreeTop* treetop, TR::Node* node)
+   {
+   TR::SymbolReference* keySymRef = findAESCryptKeySymbolReference(node);
+
+   // The key is loaded from the receiver ahead of the call, so the receiver must be checked first
+   splitReceiverNullCheck(treetop, node);
+
+   TR::Node* receiver = node->getChild(0);
+   TR::Node* key = TR::Node::createWithSymRef(node, comp()->il.opCodeForIndirectLoad(TR::Address), 1, receiver, keySymRef);
+   if (comp()->useCompressedPointers())
+      treetop->insertBefore(TR::TreeTop::create(comp(), TR::Node::createCompressedRefsAnchor(key)));
+
+   TR::Node* args[] =
+      {
+      createArrayElementAddress(node->getChild(1), node->getChild(2)),
+      createArrayElementAddress(node->getChild(3), node->getChild(4)),
+      createArrayElementAddress(key, NULL),
+      TR::Node::create(node, TR::arraylength, 1, key)
+      };
+   replaceCallArguments(treetop, node, 4, args);
+   }
+
+void J9::RecognizedCallTransformer::process_com_sun_crypto_provider_GHASH_processBlocks(TR::TreeTop* treetop, TR::Node* node)
+   {
+   TR::Node* args[] =
+      {
+      createArrayElementAddress(node->getChild(0), node->getChild(1)),
+      node->getChild(2),
+      createArrayElementAddress(node->getChild(3), NULL),
+      createArrayElementAddress(node->getChild(4), NULL)
+      };
+   replaceCallArguments(treetop, node, 4, args);
+   }
+
 /*
 Transform an Unsafe atomic call to diamonds with equivalent semantics
 
@@ -387,6 +511,16 @@ bool J9::RecognizedCallTransformer::isInlineable(TR::TreeTop* treetop)
       case TR::java_lang_StrictMath_sqrt:
       case TR::java_lang_Math_sqrt:
          return comp()->target().cpu.getSupportsHardwareSQRT();
+      case TR::java_util_zip_CRC32C_updateBytes:
+      case TR::java_util_zip_CRC32C_updateDirectByteBuffer:
+         return cg()->getSupportsInlineCRC32C();
+      case TR::java_util_Base64_Encoder_encodeBlock:
+         return cg()->getSupportsInlineBase64Encode();
+      case TR::com_sun_crypto_provider_AESCrypt_implEncryptBlock:
+      case TR::com_sun_crypto_provider_AESCrypt_implDecryptBlock:
+         return cg()->getSupportsInlineAESBlock() && findAESCryptKeySymbolReference(node) != NULL;
+      case TR::com_sun_crypto_provider_GHASH_processBlocks:
+         return cg()->getSupportsInlineGHASH();
       default:
          return false;
       }
@@ -467,6 +601,20 @@ void J9::RecognizedCallTransformer::transform(TR::TreeTop* treetop)
       case TR::java_lang_Math_sqrt:
          process_java_lang_StrictMath_and_Math_sqrt(treetop, node);
          break;
+      case TR::java_util_zip_CRC32C_updateBytes:
+      case TR::java_util_zip_CRC32C_updateDirectByteBuffer:
+         process_java_util_zip_CRC32C_update(treetop, node);
+         break;
+      case TR::java_util_Base64_Encoder_encodeBlock:
+         process_java_util_Base64_Encoder_encodeBlock(treetop, node);
+         break;
+      case TR::com_sun_crypto_provider_AESCrypt_implEncryptBlock:
+      case TR::com_sun_crypto_provider_AESCrypt_implDecryptBlock:
+         process_com_sun_crypto_provider_AESCrypt_cryptBlock(treetop, node);
+         break;
+      case TR::com_sun_crypto_provider_GHASH_processBlocks:
+         process_com_sun_crypto_provider_GHASH_processBlocks(treetop, node);
+         break;
       default:
          break;
       }
@@ -106,6 +106,175 @@ class RecognizedCallTransformer : public OMR::RecognizedCallTransformer
     *     Flag indicating if null check is needed on the first argument of the unsafe call
     */
    void processUnsafeAtomicCall(TR::TreeTop* treetop, TR::SymbolReferenceTable::CommonNonhelperSymbol helper, bool needsNullCheck = false);
+   /** \brief
+    *     Creates the address of an element of a contiguous primitive array.
+    *
+    *  \param array
+    *     The array object.
+    *
+    *  \param offset
+    *     The element index in bytes, or NULL for the first element.
+    *
+    *  \return
+    *     An aladd node addressing the element.
+    */
+   TR::Node* createArrayElementAddress(TR::Node* array, TR::Node* offset);
+   /** \brief
+    *     Moves a null check on the receiver of the call anchored by \p treetop into its own treetop so that the
+    *     receiver can be removed from the call.
+    *
+    *  \param treetop
+    *     The treetop which anchors the call node.
+    *
+    *  \param node
+    *     The call node.
+    */
+   void splitReceiverNullCheck(TR::TreeTop* treetop, TR::Node* node);
+   /** \brief
+    *     Replaces the arguments of a call with the given nodes, keeping any null check on the original receiver.
+    *
+    *  \param treetop
+    *     The treetop which anchors the call node.
+    *
+    *  \param node
+    *     The call node.
+    *
+    *  \param numArgs
+    *     The number of new arguments.
+    *
+    *  \param args
+    *     The new arguments.
+    */
+   void replaceCallArguments(TR::TreeTop* treetop, TR::Node* node, int32_t numArgs, TR::Node** args);
+   /** \brief
+    *     Transforms java/util/zip/CRC32C.updateBytes(I[BII)I and java/util/zip/CRC32C.updateDirectByteBuffer(IJII)I
+    *     into a CodeGen inlined call with equivalent semantics.
+    *
+    *  \param treetop
+    *     The treetop which anchors the call node.
+    *
+    *  \param node
+    *     The call node representing a call to java/util/zip/CRC32C.updateBytes(I[BII)I which has the following shape:
+    *
+    *     \code
+    *     icall <java/util/zip/CRC32C.updateBytes(I[BII)I>
+    *       <crc>
+    *       <b>
+    *       <off>
+    *       <end>
+    *     \endcode
+    *
+    *     or java/util/zip/CRC32C.updateDirectByteBuffer(IJII)I, which has an address in place of the array. The
+    *     transformed call has the following shape:
+    *
+    *     \code
+    *     icall <java/util/zip/CRC32C.updateBytes(I[BII)I>
+    *       <crc>
+    *       <address of the first byte>
+    *       <length>
+    *     \endcode
+    */
+   void process_java_util_zip_CRC32C_update(TR::TreeTop* treetop, TR::Node* node);
+   /** \brief
+    *     Transforms java/util/Base64$Encoder.encodeBlock([BII[BIZ)V into a CodeGen inlined call with equivalent semantics.
+    *
+    *  \param treetop
+    *     The treetop which anchors the call node.
+    *
+    *  \param node
+    *     The call node representing a call to java/util/Base64$Encoder.encodeBlock([BII[BIZ)V which has the following shape:
+    *
+    *     \code
+    *     call <java/util/Base64$Encoder.encodeBlock([BII[BIZ)V>
+    *       <this>
+    *       <src>
+    *       <sp>
+    *       <sl>
+    *       <dst>
+    *       <dp>
+    *       <isURL>
+    *     \endcode
+    *
+    *     The transformed call has the following shape:
+    *
+    *     \code
+    *     call <java/util/Base64$Encoder.encodeBlock([BII[BIZ)V>
+    *       <address of src[sp]>
+    *       <sl - sp>
+    *       <address of dst[dp]>
+    *       <isURL>
+    *     \endcode
+    */
+   void process_java_util_Base64_Encoder_encodeBlock(TR::TreeTop* treetop, TR::Node* node);
+   /** \brief
+    *     Finds the symbol reference of the round key field com/sun/crypto/provider/AESCrypt.K.
+    *
+    *  \param node
+    *     A call node to an AESCrypt method.
+    *
+    *  \return
+    *     The symbol reference, or NULL if the field offset is not known.
+    */
+   TR::SymbolReference* findAESCryptKeySymbolReference(TR::Node* node);
+   /** \brief
+    *     Transforms com/sun/crypto/provider/AESCrypt.implEncryptBlock([BI[BI)V and
+    *     com/sun/crypto/provider/AESCrypt.implDecryptBlock([BI[BI)V into a CodeGen inlined call with equivalent semantics.
+    *
+    *  \param treetop
+    *     The treetop which anchors the call node.
+    *
+    *  \param node
+    *     The call node representing a call to one of the block methods which has the following shape:
+    *
+    *     \code
+    *     call <com/sun/crypto/provider/AESCrypt.implEncryptBlock([BI[BI)V>
+    *       <this>
+    *       <in>
+    *       <inOffset>
+    *       <out>
+    *       <outOffset>
+    *     \endcode
+    *
+    *     The transformed call has the following shape:
+    *
+    *     \code
+    *     call <com/sun/crypto/provider/AESCrypt.implEncryptBlock([BI[BI)V>
+    *       <address of in[inOffset]>
+    *       <address of out[outOffset]>
+    *       <address of this.K[0]>
+    *       <this.K.length>
+    *     \endcode
+    */
+   void process_com_sun_crypto_provider_AESCrypt_cryptBlock(TR::TreeTop* treetop, TR::Node* node);
+   /** \brief
+    *     Transforms com/sun/crypto/provider/GHASH.processBlocks([BII[J[J)V into a CodeGen inlined call with equivalent semantics.
+    *
+    *  \param treetop
+    *     The treetop which anchors the call node.
+    *
+    *  \param node
+    *     The call node representing a call to com/sun/crypto/provider/GHASH.processBlocks([BII[J[J)V which has the following shape:
+    *
+    *     \code
+    *     call <com/sun/crypto/provider/GHASH.processBlocks([BII[J[J)V>
+    *       <data>
+    *       <inOfs>
+    *       <blocks>
+    *       <st>
+    *       <subH>
+    *     \endcode
+    *
+    *     The transformed call has the following shape:
+    *
+    *     \code
+    *     call <com/sun/crypto/provider/GHASH.processBlocks([BII[J[J)V>
+    *       <address of data[inOfs]>
+    *       <blocks>
+    *       <address of st[0]>
+    *       <address of subH[0]>
+    *     \endcode
+    */
+   void process_com_sun_crypto_provider_GHASH_processBlocks(TR::TreeTop* treetop, TR::Node* node);
    };
 
 }
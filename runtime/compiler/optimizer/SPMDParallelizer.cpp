@@ -3938,17 +3938,31 @@ bool TR_SPMDKernelParallelizer::checkLoopIteration(TR_RegionStructure *loop,TR::
       if (storeNode->getOpCodeValue() == TR::istore &&
           storeNode->getSymbolReference() == piv->getSymRef() &&
           piv->getIncrement() == 1 &&
-          storeNode->getFirstChild()->getOpCodeValue() == TR::isub &&
-          (storeNode->getFirstChild() == branch->getFirstChild() ||
-          storeNode->getFirstChild() == branch->getSecondChild()))
+          (storeNode->getFirstChild()->getOpCodeValue() == TR::isub ||
+           storeNode->getFirstChild()->getOpCodeValue() == TR::iadd))
          {
-         TR::Node *indexChild = storeNode->getFirstChild()->getFirstChild();
-         TR::Node *incrementNode = storeNode->getFirstChild()->getSecondChild();
+         TR::Node *incrementedIndex = storeNode->getFirstChild();
+         TR::Node *indexChild = incrementedIndex->getFirstChild();
+         TR::Node *incrementNode = incrementedIndex->getSecondChild();
+
+         // The loop test either commons the incremented value or reloads the
+         // induction variable after the store; both compare the next index
+         bool testsIncrementedIndex = false;
+         for (int32_t i = 0; i < 2; i++)
+            {
+            TR::Node *comparand = branch->getChild(i);
+            if (comparand == incrementedIndex ||
+                (comparand->getOpCodeValue() == TR::iload &&
+                 comparand->getReferenceCount() == 1 &&
+                 comparand->getSymbolReference() == piv->getSymRef()))
+               testsIncrementedIndex = true;
+            }
 
-         if (indexChild->getOpCode().isLoadVarDirect() &&
+         if (testsIncrementedIndex &&
+             indexChild->getOpCode().isLoadVarDirect() &&
              indexChild->getSymbolReference() == piv->getSymRef() &&
              incrementNode->getOpCode().isLoadConst() &&
-             incrementNode->getInt() == -1)
+             incrementNode->getInt() == (incrementedIndex->getOpCode().isSub() ? -1 : 1))
             goodLoopBounds = true;
          }
       }
@@ -0,0 +1,725 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "optimizer/VectorAPIExpansion.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "codegen/CodeGenerator.hpp"
+#include "env/FrontEnd.hpp"
+#include "compile/Compilation.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/KnownObjectTable.hpp"
+#include "env/VMAccessCriticalSection.hpp"
+#include "env/VMJ9.h"
+#include "il/ILOpCodes.hpp"
+#include "il/ILOps.hpp"
+#include "il/MethodSymbol.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/ResolvedMethodSymbol.hpp"
+#include "il/StaticSymbol.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "infra/Assert.hpp"
+#include "optimizer/Inliner.hpp"
+#include "optimizer/Optimization.hpp"
+#include "optimizer/Optimization_inlines.hpp"
+#include "optimizer/Optimizer.hpp"
+
+// Shapes of the VectorSupport entry points that are expanded: the number of
+// arguments and the position of the vector class, lane count and vector operands
+#define VECTOR_LOAD_NUM_ARGS        9
+#define VECTOR_STORE_NUM_ARGS       9
+#define VECTOR_BINARYOP_NUM_ARGS    7
+
+#define VECTOR_LOAD_BASE_ARG        3
+#define VECTOR_LOAD_OFFSET_ARG      4
+#define VECTOR_STORE_VALUE_ARG      5
+#define VECTOR_BINARYOP_OPR_ARG     0
+#define VECTOR_BINARYOP_FIRST_ARG   4
+#define VECTOR_BINARYOP_SECOND_ARG  5
+
+struct VectorClassInfo
+   {
+   const char *_className;
+   TR::DataTypes _vectorType;
+   int32_t _numLanes;
+   };
+
+// Only species that fit the 128-bit vector types of the IL are expanded
+static const VectorClassInfo vectorClasses[] =
+   {
+   { "jdk/incubator/vector/Byte128Vector",   TR::VectorInt8,   16 },
+   { "jdk/incubator/vector/Short128Vector",  TR::VectorInt16,   8 },
+   { "jdk/incubator/vector/Int128Vector",    TR::VectorInt32,   4 },
+   { "jdk/incubator/vector/Long128Vector",   TR::VectorInt64,   2 },
+   { "jdk/incubator/vector/Float128Vector",  TR::VectorFloat,   4 },
+   { "jdk/incubator/vector/Double128Vector", TR::VectorDouble,  2 },
+   };
+
+TR_VectorAPIExpansion::TR_VectorAPIExpansion(TR::OptimizationManager *manager)
+   : TR::Optimization(manager),
+     _numSymRefs(0),
+     _callIds(std::less<TR::Node *>(), comp()->trMemory()->heapMemoryRegion()),
+     _parent(comp()->trMemory()->heapMemoryRegion()),
+     _invalid(comp()->trMemory()->heapMemoryRegion()),
+     _callTypes(comp()->trMemory()->heapMemoryRegion()),
+     _webTypes(comp()->trMemory()->heapMemoryRegion()),
+     _callClasses(comp()->trMemory()->heapMemoryRegion()),
+     _webClasses(comp()->trMemory()->heapMemoryRegion()),
+     _checkCasts(comp()->trMemory()->heapMemoryRegion()),
+     _checkCastIds(comp()->trMemory()->heapMemoryRegion()),
+     _calls(comp()->trMemory()->heapMemoryRegion()),
+     _anchors(comp()->trMemory()->heapMemoryRegion()),
+     _callTrees(comp()->trMemory()->heapMemoryRegion()),
+     _vectorTemps(comp()->trMemory()->heapMemoryRegion())
+   {}
+
+bool
+TR_VectorAPIExpansion::isVectorAPIMethod(TR::RecognizedMethod method)
+   {
+   switch (method)
+      {
+      case TR::jdk_internal_vm_vector_VectorSupport_load:
+      case TR::jdk_internal_vm_vector_VectorSupport_store:
+      case TR::jdk_internal_vm_vector_VectorSupport_binaryOp:
+         return true;
+      default:
+         return false;
+      }
+   }
+
+bool
+TR_VectorAPIExpansion::isEnabled(TR::Compilation *comp)
+   {
+   static bool disabled = feGetEnv("TR_disableVectorAPIExpansion") != NULL;
+   if (disabled ||
+       !comp->cg()->getSupportsInlineVectorAPI() ||
+       comp->getOptions()->isDisabled(OMR::vectorAPIExpansion))
+      return false;
+
+   // Only the warm and hotter strategies run the pass
+   if (comp->getMethodHotness() < warm)
+      return false;
+
+   // The temps that carry boxes can be bytecode locals, and an OSR transition
+   // could not rebuild the interpreter frame from a vector. With voluntary OSR
+   // a transition only happens in an OSR induce block, where every local the
+   // interpreter may need is an argument of the prepareForOSR call. That is a
+   // use like any other, so the webs it reaches are not expanded. With
+   // involuntary OSR any OSR point can transition, so leave such compilations alone.
+   if (comp->supportsInduceOSR() && comp->getOSRMode() == TR::involuntaryOSR)
+      return false;
+
+   return true;
+   }
+
+bool
+TR_VectorAPIExpansion::isVectorOperand(TR::Node *call, int32_t childIndex)
+   {
+   switch (call->getSymbol()->castToMethodSymbol()->getRecognizedMethod())
+      {
+      case TR::jdk_internal_vm_vector_VectorSupport_store:
+         return childIndex == VECTOR_STORE_VALUE_ARG;
+      case TR::jdk_internal_vm_vector_VectorSupport_binaryOp:
+         return childIndex == VECTOR_BINARYOP_FIRST_ARG || childIndex == VECTOR_BINARYOP_SECOND_ARG;
+      default:
+         return false;
+      }
+   }
+
+TR_OpaqueClassBlock *
+TR_VectorAPIExpansion::getSpeciesClass(TR::Node *classNode)
+   {
+   // A class literal: aloadi <javaLangClassFromClass> (loadaddr <class>)
+   if (classNode->getOpCodeValue() == TR::aloadi &&
+       classNode->getSymbolReference() == getSymRefTab()->findOrCreateJavaLangClassFromClassSymbolRef())
+      {
+      TR::Node *classObject = classNode->getFirstChild();
+      if (classObject->getOpCodeValue() != TR::loadaddr ||
+          !classObject->getSymbol()->isClassObject() ||
+          classObject->getSymbolReference()->isUnresolved())
+         return NULL;
+
+      return (TR_OpaqueClassBlock *)classObject->getSymbol()->castToStaticSymbol()->getStaticAddress();
+      }
+
+   // A java/lang/Class object known to the compilation, e.g. from a static final field
+   // such as the species of a vector class. The server cannot dereference the object.
+   if (classNode->getOpCode().hasSymbolReference() &&
+       classNode->getSymbolReference()->hasKnownObjectIndex() &&
+       !comp()->isOutOfProcessCompilation())
+      {
+      TR::KnownObjectTable *knot = comp()->getKnownObjectTable();
+      TR::KnownObjectTable::Index index = classNode->getSymbolReference()->getKnownObjectIndex();
+      if (!knot || knot->isNull(index))
+         return NULL;
+
+      TR::VMAccessCriticalSection getSpeciesClassCS(comp()->fej9());
+      uintptr_t object = knot->getPointer(index);
+      if (comp()->fej9()->getObjectClass(object) != comp()->getClassClassPointer())
+         return NULL;
+      return comp()->fej9()->getClassFromJavaLangClass(object);
+      }
+
+   return NULL;
+   }
+
+TR::DataType
+TR_VectorAPIExpansion::getVectorType(TR::Node *call, TR_OpaqueClassBlock *&vectorClass)
+   {
+   bool isBinaryOp = call->getSymbol()->castToMethodSymbol()->getRecognizedMethod() == TR::jdk_internal_vm_vector_VectorSupport_binaryOp;
+   TR::Node *classNode = call->getChild(isBinaryOp ? 1 : 0);
+   TR::Node *lengthNode = call->getChild(isBinaryOp ? 3 : 2);
+
+   TR_OpaqueClassBlock *clazz = getSpeciesClass(classNode);
+   if (!clazz)
+      return TR::NoType;
+
+   int32_t length = 0;
+   char *className = comp()->fej9()->getClassNameChars(clazz, length);
+
+   for (size_t i = 0; i < sizeof(vectorClasses) / sizeof(vectorClasses[0]); i++)
+      {
+      const VectorClassInfo &info = vectorClasses[i];
+      if ((size_t)length != strlen(info._className) || strncmp(className, info._className, length))
+         continue;
+
+      if (lengthNode->getOpCodeValue() == TR::iconst && lengthNode->getInt() != info._numLanes)
+         return TR::NoType;
+
+      vectorClass = clazz;
+      return info._vectorType;
+      }
+
+   return TR::NoType;
+   }
+
+TR::ILOpCodes
+TR_VectorAPIExpansion::getBinaryOpCode(TR::Node *call, TR::DataType vectorType)
+   {
+   TR::Node *oprNode = call->getChild(VECTOR_BINARYOP_OPR_ARG);
+   if (oprNode->getOpCodeValue() != TR::iconst)
+      return TR::BadILOp;
+
+   bool isIntegral = vectorType != TR::VectorFloat && vectorType != TR::VectorDouble;
+   TR::ILOpCodes op = TR::BadILOp;
+   switch (oprNode->getInt())
+      {
+      case VECTOR_OP_ADD: op = TR::vadd; break;
+      case VECTOR_OP_SUB: op = TR::vsub; break;
+      case VECTOR_OP_MUL: op = TR::vmul; break;
+      // Integer division has to throw on a zero divisor and there is no SIMD divide for integral lanes
+      case VECTOR_OP_DIV: op = isIntegral ? TR::BadILOp : TR::vdiv; break;
+      case VECTOR_OP_AND: op = isIntegral ? TR::vand : TR::BadILOp; break;
+      case VECTOR_OP_OR:  op = isIntegral ? TR::vor  : TR::BadILOp; break;
+      case VECTOR_OP_XOR: op = isIntegral ? TR::vxor : TR::BadILOp; break;
+      default: break;
+      }
+
+   if (op != TR::BadILOp && !cg()->getSupportsOpCodeForAutoSIMD(op, vectorType))
+      return TR::BadILOp;
+
+   return op;
+   }
+
+// The vector type whose lanes have the element type of the primitive array that a
+// load or store is based on, or NoType if the base is not known to be a primitive
+// array. Direct ByteBuffers have a null base and an absolute address as the offset.
+TR::DataType
+TR_VectorAPIExpansion::getBaseVectorType(TR::Node *call)
+   {
+   int32_t length = 0;
+   const char *signature = call->getChild(VECTOR_LOAD_BASE_ARG)->getTypeSignature(length);
+   if (!signature || length != 2 || signature[0] != '[')
+      return TR::NoType;
+
+   switch (signature[1])
+      {
+      case 'Z':
+      case 'B': return TR::VectorInt8;
+      case 'C':
+      case 'S': return TR::VectorInt16;
+      case 'I': return TR::VectorInt32;
+      case 'J': return TR::VectorInt64;
+      case 'F': return TR::VectorFloat;
+      case 'D': return TR::VectorDouble;
+      default:  return TR::NoType;
+      }
+   }
+
+TR::DataType
+TR_VectorAPIExpansion::getCandidateType(TR::Node *node, TR_OpaqueClassBlock *&vectorClass)
+   {
+   if (!node->getOpCode().isCallDirect() || !node->getSymbol()->isResolvedMethod())
+      return TR::NoType;
+
+   TR::RecognizedMethod method = node->getSymbol()->castToMethodSymbol()->getRecognizedMethod();
+   int32_t expectedNumArgs = 0;
+   switch (method)
+      {
+      case TR::jdk_internal_vm_vector_VectorSupport_load:
+         expectedNumArgs = VECTOR_LOAD_NUM_ARGS;
+         break;
+      case TR::jdk_internal_vm_vector_VectorSupport_store:
+         expectedNumArgs = VECTOR_STORE_NUM_ARGS;
+         break;
+      case TR::jdk_internal_vm_vector_VectorSupport_binaryOp:
+         expectedNumArgs = VECTOR_BINARYOP_NUM_ARGS;
+         break;
+      default:
+         return TR::NoType;
+      }
+
+   // The signatures have changed between incubator releases; only expand the ones we know
+   if (node->getNumChildren() != expectedNumArgs)
+      return TR::NoType;
+
+   TR::DataType vectorType = getVectorType(node, vectorClass);
+   if (vectorType == TR::NoType)
+      return vectorType;
+
+   bool supported = false;
+   switch (method)
+      {
+      case TR::jdk_internal_vm_vector_VectorSupport_load:
+         supported = getBaseVectorType(node) != TR::NoType &&
+                     cg()->getSupportsOpCodeForAutoSIMD(TR::vloadi, vectorType);
+         break;
+      case TR::jdk_internal_vm_vector_VectorSupport_store:
+         supported = getBaseVectorType(node) != TR::NoType &&
+                     cg()->getSupportsOpCodeForAutoSIMD(TR::vstorei, vectorType);
+         break;
+      default:
+         supported = getBinaryOpCode(node, vectorType) != TR::BadILOp;
+         break;
+      }
+
+   return supported ? vectorType : TR::DataType(TR::NoType);
+   }
+
+int32_t
+TR_VectorAPIExpansion::getCallId(TR::Node *node)
+   {
+   if (!node->getOpCode().isCall())
+      return -1;
+
+   NodeIdMap::iterator it = _callIds.find(node);
+   if (it != _callIds.end())
+      return it->second;
+
+   int32_t id = -1;
+   TR_OpaqueClassBlock *vectorClass = NULL;
+   TR::DataType vectorType = getCandidateType(node, vectorClass);
+   if (vectorType != TR::NoType)
+      {
+      id = (int32_t)_parent.size();
+      _parent.push_back(id);
+      _invalid.push_back(0);
+      _calls.push_back(node);
+      _anchors.push_back(NULL);
+      _callTrees.push_back(NULL);
+      _callTypes.push_back(vectorType);
+      _callClasses.push_back(vectorClass);
+      }
+   _callIds.insert(std::make_pair(node, id));
+   return id;
+   }
+
+int32_t
+TR_VectorAPIExpansion::find(int32_t id)
+   {
+   while (_parent[id] != id)
+      {
+      _parent[id] = _parent[_parent[id]];
+      id = _parent[id];
+      }
+   return id;
+   }
+
+void
+TR_VectorAPIExpansion::merge(int32_t a, int32_t b)
+   {
+   a = find(a);
+   b = find(b);
+   if (a != b)
+      _parent[b] = a;
+   }
+
+bool
+TR_VectorAPIExpansion::isVectorAuto(TR::SymbolReference *symRef)
+   {
+   TR::Symbol *symbol = symRef->getSymbol();
+   return symbol->isAuto() &&
+          symbol->getDataType() == TR::Address &&
+          !symbol->castToAutoSymbol()->isInternalPointer() &&
+          symRef->getReferenceNumber() < _numSymRefs;
+   }
+
+void
+TR_VectorAPIExpansion::analyzeNode(TR::Node *node, TR::TreeTop *treeTop, vcount_t visitCount)
+   {
+   if (node->getVisitCount() == visitCount)
+      return;
+   node->setVisitCount(visitCount);
+
+   int32_t nodeId = getCallId(node);
+   if (nodeId >= 0 && !_callTrees[nodeId - _numSymRefs])
+      _callTrees[nodeId - _numSymRefs] = treeTop;
+   bool isVectorStore = node->getOpCodeValue() == TR::astore && isVectorAuto(node->getSymbolReference());
+
+   if (node->getOpCodeValue() == TR::loadaddr && node->getSymbol()->isAuto())
+      invalidate(node->getSymbolReference()->getReferenceNumber());
+
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      {
+      TR::Node *child = node->getChild(i);
+      analyzeNode(child, treeTop, visitCount);
+
+      int32_t childId = getCallId(child);
+      if (childId >= 0 && _calls[childId - _numSymRefs]->getSymbol()->castToMethodSymbol()->getRecognizedMethod() == TR::jdk_internal_vm_vector_VectorSupport_store)
+         childId = -1;
+      int32_t childAuto = (child->getOpCodeValue() == TR::aload && isVectorAuto(child->getSymbolReference())) ?
+         child->getSymbolReference()->getReferenceNumber() : -1;
+
+      if (nodeId >= 0 && isVectorOperand(node, i))
+         {
+         // A box consumed by another intrinsic
+         if (childId >= 0)
+            merge(childId, nodeId);
+         else if (childAuto >= 0)
+            merge(childAuto, nodeId);
+         else
+            invalidate(nodeId);
+         }
+      else if (isVectorStore)
+         {
+         // A box carried in a temp
+         int32_t storeAuto = node->getSymbolReference()->getReferenceNumber();
+         if (childId >= 0)
+            merge(childId, storeAuto);
+         else if (childAuto >= 0)
+            merge(childAuto, storeAuto);
+         else
+            invalidate(storeAuto);
+         }
+      else if (node->getOpCode().isCheckCast() && i == 0 && node == treeTop->getNode())
+         {
+         // The cast that follows a call returning a generic vector. It is
+         // checked against the species of the web once that is known.
+         int32_t valueId = childId >= 0 ? childId : childAuto;
+         if (valueId >= 0)
+            {
+            _checkCasts.push_back(treeTop);
+            _checkCastIds.push_back(valueId);
+            }
+         }
+      else if (node->getOpCodeValue() != TR::treetop)
+         {
+         // Anything else lets the box escape; anchoring it under a treetop does not
+         if (childId >= 0)
+            invalidate(childId);
+         if (childAuto >= 0)
+            invalidate(childAuto);
+         }
+      }
+   }
+
+TR::Node *
+TR_VectorAPIExpansion::generateAddress(TR::Node *call)
+   {
+   TR::Node *base = call->getChild(VECTOR_LOAD_BASE_ARG);
+   TR::Node *offset = call->getChild(VECTOR_LOAD_OFFSET_ARG);
+
+   // The base is a primitive array, which the Java implementation dereferences
+   TR::TreeTop *callTree = _callTrees[getCallId(call) - _numSymRefs];
+   TR::Node *nullCheck = TR::Node::createWithSymRef(call, TR::NULLCHK, 1,
+      TR::Node::create(call, TR::PassThrough, 1, base),
+      getSymRefTab()->findOrCreateNullCheckSymbolRef(comp()->getMethodSymbol()));
+   callTree->insertBefore(TR::TreeTop::create(comp(), nullCheck));
+
+   if (comp()->target().is64Bit())
+      return TR::Node::create(call, TR::aladd, 2, base, offset);
+   return TR::Node::create(call, TR::aiadd, 2, base, TR::Node::create(call, TR::l2i, 1, offset));
+   }
+
+void
+TR_VectorAPIExpansion::expandCall(TR::Node *call, TR::DataType vectorType)
+   {
+   // The array shadow only describes arrays whose elements are the lanes; any other
+   // view of an array, such as an int vector loaded from a byte[], gets the generic
+   // shadow that aliases with every array element
+   TR::RecognizedMethod method = call->getSymbol()->castToMethodSymbol()->getRecognizedMethod();
+   TR::SymbolReference *shadow = NULL;
+   if (method != TR::jdk_internal_vm_vector_VectorSupport_binaryOp)
+      shadow = getBaseVectorType(call) == vectorType ?
+         getSymRefTab()->findOrCreateArrayShadowSymbolRef(vectorType, NULL) :
+         getSymRefTab()->findOrCreateGenericIntShadowSymbolReference(0);
+
+   switch (method)
+      {
+      case TR::jdk_internal_vm_vector_VectorSupport_load:
+         {
+         TR::Node *address = generateAddress(call);
+         prepareToReplaceNode(call);
+         TR::Node::recreateWithoutProperties(call, TR::vloadi, 1, address, shadow);
+         break;
+         }
+      case TR::jdk_internal_vm_vector_VectorSupport_store:
+         {
+         TR::TreeTop *anchor = _anchors[getCallId(call) - _numSymRefs];
+         TR::Node *address = generateAddress(call);
+         TR::Node *value = call->getChild(VECTOR_STORE_VALUE_ARG);
+         TR::Node *store = TR::Node::createWithSymRef(call, TR::vstorei, 2, address, value, shadow);
+         anchor->setNode(store);
+         call->recursivelyDecReferenceCount();
+         break;
+         }
+      case TR::jdk_internal_vm_vector_VectorSupport_binaryOp:
+         {
+         TR::ILOpCodes op = getBinaryOpCode(call, vectorType);
+         TR::Node *first = call->getChild(VECTOR_BINARYOP_FIRST_ARG);
+         TR::Node *second = call->getChild(VECTOR_BINARYOP_SECOND_ARG);
+         first->incReferenceCount();
+         second->incReferenceCount();
+         prepareToReplaceNode(call);
+         // Recreated without properties so that the method symbol reference does not stay on the vector node
+         TR::Node::recreateWithoutProperties(call, op, 2, first, second);
+         first->decReferenceCount();
+         second->decReferenceCount();
+         break;
+         }
+      default:
+         TR_ASSERT_FATAL(false, "Unexpected VectorSupport call n%dn [%p]", call->getGlobalIndex(), call);
+      }
+   }
+
+void
+TR_VectorAPIExpansion::removeCheckCast(TR::TreeTop *treeTop)
+   {
+   // The vector is still anchored so that it is evaluated where the box was tested
+   TR::Node *checkCast = treeTop->getNode();
+   treeTop->setNode(TR::Node::create(checkCast, TR::treetop, 1, checkCast->getFirstChild()));
+   checkCast->recursivelyDecReferenceCount();
+   }
+
+void
+TR_VectorAPIExpansion::retypeTemps(TR::Node *node, vcount_t visitCount)
+   {
+   if (node->getVisitCount() == visitCount)
+      return;
+   node->setVisitCount(visitCount);
+
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      retypeTemps(node->getChild(i), visitCount);
+
+   if (node->getOpCodeValue() != TR::aload && node->getOpCodeValue() != TR::astore)
+      return;
+
+   int32_t refNum = node->getSymbolReference()->getReferenceNumber();
+   if (refNum >= _numSymRefs || !_vectorTemps[refNum])
+      return;
+
+   TR::Node::recreate(node, node->getOpCodeValue() == TR::aload ? TR::vload : TR::vstore);
+   node->setSymbolReference(_vectorTemps[refNum]);
+   }
+
+void
+TR_VectorAPIExpansion::inlineRemainingCalls()
+   {
+   comp()->setVectorAPICallsInlineable(true);
+
+   // Collected first because inlining rewrites the trees around each call
+   std::vector<TR::TreeTop *, TR::typed_allocator<TR::TreeTop *, TR::Region&> > callTrees(comp()->trMemory()->heapMemoryRegion());
+   for (TR::TreeTop *tt = comp()->getStartTree(); tt; tt = tt->getNextTreeTop())
+      {
+      TR::Node *node = tt->getNode();
+      if (node->getOpCodeValue() != TR::treetop)
+         continue;
+
+      TR::Node *call = node->getFirstChild();
+      if (call->getOpCode().isCallDirect() &&
+          call->getSymbol()->isResolvedMethod() &&
+          isVectorAPIMethod(call->getSymbol()->castToMethodSymbol()->getRecognizedMethod()))
+         callTrees.push_back(tt);
+      }
+
+   for (size_t i = 0; i < callTrees.size(); i++)
+      {
+      TR::Node *call = callTrees[i]->getNode()->getFirstChild();
+      // Removed with an unreachable block by an earlier inlining
+      if (call->getReferenceCount() == 0)
+         continue;
+
+      if (!performTransformation(comp(), "%sInlining VectorSupport call n%dn [%p] that was not expanded\n", optDetailString(), call->getGlobalIndex(), call))
+         continue;
+
+      TR_InlineCall newInlineCall(optimizer(), this);
+      if (newInlineCall.inlineCall(callTrees[i], 0, true))
+         {
+         optimizer()->setUseDefInfo(NULL);
+         optimizer()->setValueNumberInfo(NULL);
+         optimizer()->setAliasSetsAreValid(false);
+         }
+      }
+   }
+
+int32_t
+TR_VectorAPIExpansion::perform()
+   {
+   // The inliner has left VectorSupport calls alone only if the pass is enabled
+   if (!isEnabled(comp()))
+      return 0;
+
+   int32_t numExpanded = expandWebs();
+   inlineRemainingCalls();
+   return numExpanded;
+   }
+
+int32_t
+TR_VectorAPIExpansion::expandWebs()
+   {
+   _numSymRefs = comp()->getSymRefTab()->getNumSymRefs();
+   _parent.resize(_numSymRefs);
+   _invalid.assign(_numSymRefs, 0);
+   for (int32_t i = 0; i < _numSymRefs; i++)
+      _parent[i] = i;
+
+   vcount_t visitCount = comp()->incVisitCount();
+   for (TR::TreeTop *tt = comp()->getStartTree(); tt; tt = tt->getNextTreeTop())
+      {
+      TR::Node *node = tt->getNode();
+      analyzeNode(node, tt, visitCount);
+
+      if (node->getOpCodeValue() == TR::treetop)
+         {
+         int32_t callId = getCallId(node->getFirstChild());
+         if (callId >= 0 && !_anchors[callId - _numSymRefs])
+            _anchors[callId - _numSymRefs] = tt;
+         }
+      }
+
+   if (_calls.empty())
+      return 0;
+
+   // Every call in a web has to agree on the species, and stores can only be
+   // replaced where they are anchored
+   _webTypes.assign(_parent.size(), TR::DataType(TR::NoType));
+   _webClasses.assign(_parent.size(), NULL);
+   for (size_t i = 0; i < _calls.size(); i++)
+      {
+      int32_t id = _numSymRefs + (int32_t)i;
+      int32_t root = find(id);
+      if (_webTypes[root] == TR::NoType)
+         {
+         _webTypes[root] = _callTypes[i];
+         _webClasses[root] = _callClasses[i];
+         }
+      else if (_webTypes[root] != _callTypes[i] || _webClasses[root] != _callClasses[i])
+         invalidate(root);
+
+      if (_calls[i]->getSymbol()->castToMethodSymbol()->getRecognizedMethod() == TR::jdk_internal_vm_vector_VectorSupport_store &&
+          (!_anchors[i] || _anchors[i]->getNode()->getFirstChild() != _calls[i]))
+         invalidate(id);
+      }
+
+   // A checkcast can only be dropped if the species always passes it
+   for (size_t i = 0; i < _checkCasts.size(); i++)
+      {
+      int32_t root = find(_checkCastIds[i]);
+      TR::Node *castClass = _checkCasts[i]->getNode()->getSecondChild();
+      if (!_webClasses[root] ||
+          castClass->getOpCodeValue() != TR::loadaddr ||
+          castClass->getSymbolReference()->isUnresolved() ||
+          comp()->fej9()->isInstanceOf(_webClasses[root], (TR_OpaqueClassBlock *)castClass->getSymbol()->castToStaticSymbol()->getStaticAddress(), true, true) != TR_yes)
+         invalidate(root);
+      }
+
+   for (size_t id = 0; id < _parent.size(); id++)
+      {
+      if (_invalid[id])
+         _invalid[find((int32_t)id)] = 1;
+      }
+
+   for (size_t i = 0; i < _calls.size(); i++)
+      {
+      int32_t root = find(_numSymRefs + (int32_t)i);
+      // A web has to be expanded as a whole or not at all
+      if (!_invalid[root] &&
+          !performTransformation(comp(), "%sExpanding VectorSupport call n%dn [%p]\n", optDetailString(), _calls[i]->getGlobalIndex(), _calls[i]))
+         _invalid[root] = 1;
+      }
+
+   int32_t numExpanded = 0;
+   for (size_t i = 0; i < _calls.size(); i++)
+      {
+      if (_invalid[find(_numSymRefs + (int32_t)i)])
+         continue;
+      expandCall(_calls[i], _callTypes[i]);
+      numExpanded++;
+      }
+
+   for (size_t i = 0; i < _checkCasts.size(); i++)
+      {
+      if (!_invalid[find(_checkCastIds[i])])
+         removeCheckCast(_checkCasts[i]);
+      }
+
+   if (numExpanded == 0)
+      return 0;
+
+   _vectorTemps.assign(_numSymRefs, NULL);
+   bool hasVectorTemps = false;
+   for (int32_t refNum = 0; refNum < _numSymRefs; refNum++)
+      {
+      int32_t root = find(refNum);
+      if (_invalid[root] || _webTypes[root] == TR::NoType)
+         continue;
+
+      _vectorTemps[refNum] = getSymRefTab()->createTemporary(comp()->getMethodSymbol(), _webTypes[root]);
+      hasVectorTemps = true;
+      if (trace())
+         traceMsg(comp(), "Boxes in #%d now carried in vector temp #%d\n", refNum, _vectorTemps[refNum]->getReferenceNumber());
+      }
+
+   if (hasVectorTemps)
+      {
+      visitCount = comp()->incVisitCount();
+      for (TR::TreeTop *tt = comp()->getStartTree(); tt; tt = tt->getNextTreeTop())
+         retypeTemps(tt->getNode(), visitCount);
+      }
+
+   return numExpanded;
+   }
+
+const char *
+TR_VectorAPIExpansion::optDetailString() const throw()
+   {
+   return "O^O VECTOR API EXPANSION: ";
+   }
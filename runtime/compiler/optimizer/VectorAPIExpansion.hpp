@@ -0,0 +1,145 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef VECTORAPIEXPANSION_INCL
+#define VECTORAPIEXPANSION_INCL
+
+#include <stdint.h>
+#include <map>
+#include <vector>
+#include "codegen/RecognizedMethods.hpp"
+#include "il/DataTypes.hpp"
+#include "il/ILOpCodes.hpp"
+#include "optimizer/Optimization.hpp"
+#include "optimizer/OptimizationManager.hpp"
+
+namespace TR { class Compilation; class Node; class SymbolReference; class TreeTop; }
+class TR_OpaqueClassBlock;
+
+/**
+ * @class TR_VectorAPIExpansion
+ *
+ * @brief Lowers calls to the jdk.internal.vm.vector.VectorSupport intrinsics into
+ *        vector IL and removes the vector boxes that flow between them.
+ *
+ * The Vector API implementation funnels every vector operation through a small
+ * set of static VectorSupport entry points that take and return boxed vector
+ * objects. After inlining, the calls and the temps that carry their results
+ * form webs. A web is expanded only if every value in it is produced by a
+ * supported intrinsic and consumed as a vector operand of another one. In that
+ * case no box can escape, so the temps are retyped to vector temps and the calls
+ * become vloadi/vstorei and vector arithmetic. Checkcasts of a box to its own
+ * species, or to a supertype of it, are removed. Loads and stores are only
+ * expanded when their base is known to be a primitive array.
+ *
+ * The inliner leaves VectorSupport calls alone only in compilations where this
+ * pass runs. Calls in webs that cannot be expanded (other species, masked or
+ * escaping vectors, unknown bases) are then inlined by the pass itself, so
+ * they run the Java implementation without the call overhead. The pass is
+ * platform neutral: a code generator opts in through getSupportsInlineVectorAPI()
+ * and getSupportsOpCodeForAutoSIMD().
+ */
+class TR_VectorAPIExpansion : public TR::Optimization
+   {
+   public:
+   TR_VectorAPIExpansion(TR::OptimizationManager *manager);
+   static TR::Optimization *create(TR::OptimizationManager *manager)
+      {
+      return new (manager->allocator()) TR_VectorAPIExpansion(manager);
+      }
+
+   virtual int32_t perform();
+   virtual const char * optDetailString() const throw();
+
+   /**
+    * @brief Whether \p method is a VectorSupport entry point this pass can expand
+    */
+   static bool isVectorAPIMethod(TR::RecognizedMethod method);
+
+   /**
+    * @brief Whether the pass runs in \p comp, i.e. whether the inliner should leave VectorSupport calls for it
+    */
+   static bool isEnabled(TR::Compilation *comp);
+
+   private:
+
+   // Operation ids passed to VectorSupport.binaryOp, from jdk.internal.vm.vector.VectorSupport
+   enum
+      {
+      VECTOR_OP_ADD = 4,
+      VECTOR_OP_SUB = 5,
+      VECTOR_OP_MUL = 6,
+      VECTOR_OP_DIV = 7,
+      VECTOR_OP_AND = 10,
+      VECTOR_OP_OR  = 11,
+      VECTOR_OP_XOR = 12
+      };
+
+   typedef TR::typed_allocator<std::pair<TR::Node * const, int32_t>, TR::Region&> NodeIdMapAllocator;
+   typedef std::map<TR::Node *, int32_t, std::less<TR::Node *>, NodeIdMapAllocator> NodeIdMap;
+   typedef TR::typed_allocator<int32_t, TR::Region&> IntVectorAllocator;
+   typedef std::vector<int32_t, IntVectorAllocator> IntVector;
+   typedef TR::typed_allocator<TR::DataType, TR::Region&> TypeVectorAllocator;
+   typedef std::vector<TR::DataType, TypeVectorAllocator> TypeVector;
+
+   TR::DataType getCandidateType(TR::Node *node, TR_OpaqueClassBlock *&vectorClass);
+   TR::DataType getVectorType(TR::Node *call, TR_OpaqueClassBlock *&vectorClass);
+   TR_OpaqueClassBlock *getSpeciesClass(TR::Node *classNode);
+   TR::ILOpCodes getBinaryOpCode(TR::Node *call, TR::DataType vectorType);
+   TR::DataType getBaseVectorType(TR::Node *call);
+   static bool isVectorOperand(TR::Node *call, int32_t childIndex);
+
+   int32_t getCallId(TR::Node *call);
+   int32_t find(int32_t id);
+   void merge(int32_t a, int32_t b);
+   void invalidate(int32_t id) { _invalid[id] = 1; }
+   bool isVectorAuto(TR::SymbolReference *symRef);
+
+   void analyzeNode(TR::Node *node, TR::TreeTop *treeTop, vcount_t visitCount);
+   void expandCall(TR::Node *call, TR::DataType vectorType);
+   void removeCheckCast(TR::TreeTop *treeTop);
+   void retypeTemps(TR::Node *node, vcount_t visitCount);
+   TR::Node *generateAddress(TR::Node *call);
+   int32_t expandWebs();
+   void inlineRemainingCalls();
+
+   // Web elements are numbered with auto symbol reference numbers first,
+   // followed by one id per candidate call in the order they are found
+   int32_t _numSymRefs;
+   NodeIdMap _callIds;
+   IntVector _parent;
+   IntVector _invalid;
+   TypeVector _callTypes;
+   TypeVector _webTypes;
+   std::vector<TR_OpaqueClassBlock *, TR::typed_allocator<TR_OpaqueClassBlock *, TR::Region&> > _callClasses;
+   std::vector<TR_OpaqueClassBlock *, TR::typed_allocator<TR_OpaqueClassBlock *, TR::Region&> > _webClasses;
+   // Checkcasts of boxes, with the web element of the box they test
+   std::vector<TR::TreeTop *, TR::typed_allocator<TR::TreeTop *, TR::Region&> > _checkCasts;
+   IntVector _checkCastIds;
+   std::vector<TR::Node *, TR::typed_allocator<TR::Node *, TR::Region&> > _calls;
+   std::vector<TR::TreeTop *, TR::typed_allocator<TR::TreeTop *, TR::Region&> > _anchors;
+   // The tree in which each call is first evaluated
+   std::vector<TR::TreeTop *, TR::typed_allocator<TR::TreeTop *, TR::Region&> > _callTrees;
+   std::vector<TR::SymbolReference *, TR::typed_allocator<TR::SymbolReference *, TR::Region&> > _vectorTemps;
+   };
+
+#endif
@@ -38,6 +38,7 @@
 #include "rommeth.h"
 #include "vmaccess.h"
 #include "VMHelpers.hpp"
+#include "AtomicSupport.hpp"
 #include "control/Options.hpp"
 #include "control/Options_inlines.hpp"
 #include "compile/Compilation.hpp"
@@ -105,7 +106,7 @@ extern "C" int32_t getCount(J9ROMMethod *romMethod, TR::Options *optionsJIT, TR:
 
 
 static J9PortLibrary *staticPortLib = NULL;
-static uint32_t memoryConsumed = 0;
+static volatile uint32_t memoryConsumed = 0;
 
 
 
@@ -568,7 +569,7 @@ TR_IProfiler::allocate(J9JITConfig *jitConfig)
 
 TR_IProfiler::TR_IProfiler(J9JITConfig *jitConfig)
    : _isIProfilingEnabled(true),
-     _valueProfileMethod(NULL), _lightHashTableMonitor(0), _allowedToGiveInlinedInformation(true),
+     _valueProfileMethod(NULL), _allowedToGiveInlinedInformation(true),
      _globalAllocationCount (0), _maxCallFrequency(0), _iprofilerThread(0), _iprofilerOSThread(NULL),
      _workingBufferTail(NULL), _numOutstandingBuffers(0), _numRequests(1), _numRequestsSkipped(0),
      _numRequestsHandedToIProfilerThread(0), _iprofilerThreadExitFlag(0), _iprofilerMonitor(NULL),
@@ -589,6 +590,7 @@ TR_IProfiler::TR_IProfiler(J9JITConfig *jitConfig)
 
    // initialize the monitors
    _hashTableMonitor = TR::Monitor::create("JIT-InterpreterProfilingMonitor");
+   memset(_bcHashTableShardLocks, 0, sizeof(_bcHashTableShardLocks));
 
    // bytecode hashtable
    _bcHashTable = (TR_IPBytecodeHashTableEntry**)jitPersistentAlloc(BC_HASH_TABLE_SIZE*sizeof(TR_IPBytecodeHashTableEntry*));
@@ -1062,24 +1064,33 @@ TR_IProfiler::findOrCreateEntry(int32_t bucket, uintptr_t pc, bool addIt)
    if (entry)
       return entry;
 
-   // Create a new hash table entry
-   U_8 byteCode = *(U_8*) pc;
-   if (isCompact(byteCode))
-      entry = new TR_IPBCDataFourBytes(pc);
-   else
+   acquireHashTableWriteLock(bucket);
+
+   // Another thread may have added the same pc while we were waiting for the shard
+   entry = searchForSample (pc, bucket);
+   if (!entry)
       {
-      if (isSwitch(byteCode))
-         entry = new TR_IPBCDataEightWords(pc);
+      // Create a new hash table entry
+      U_8 byteCode = *(U_8*) pc;
+      if (isCompact(byteCode))
+         entry = new TR_IPBCDataFourBytes(pc);
       else
-         entry = new TR_IPBCDataCallGraph(pc);
-      }
+         {
+         if (isSwitch(byteCode))
+            entry = new TR_IPBCDataEightWords(pc);
+         else
+            entry = new TR_IPBCDataCallGraph(pc);
+         }
 
-   if (!entry)
-      return NULL;
+      if (entry)
+         {
+         entry->setNext(_bcHashTable[bucket]);
+         FLUSH_MEMORY(TR::Compiler->target.isSMP());
+         _bcHashTable[bucket] = entry;
+         }
+      }
 
-   entry->setNext(_bcHashTable[bucket]);
-   FLUSH_MEMORY(TR::Compiler->target.isSMP());
-   _bcHashTable[bucket] = entry;
+   releaseHashTableWriteLock(bucket);
 
    return entry;
    }
@@ -2550,16 +2561,22 @@ uint32_t platformTryLock(uint32_t *ptr);
 void platformUnlock(uint32_t *ptr);
 }
 
-bool
-TR_IProfiler::acquireHashTableWriteLock(bool forceFullLock)
+void
+TR_IProfiler::acquireHashTableWriteLock(int32_t bucket)
    {
-   return true;
+   volatile uint32_t *lock = &_bcHashTableShardLocks[bucket % BC_HASH_TABLE_SHARDS]._lock;
+   // Spin on a plain read and only attempt the CAS when the lock looks free;
+   // critical sections are a single entry allocation so waits are short
+   while (0 != *lock || 0 != VM_AtomicSupport::lockCompareExchangeU32(lock, 0, 1))
+      VM_AtomicSupport::yieldCPU();
+   VM_AtomicSupport::readBarrier();
    }
 
 void
-TR_IProfiler::releaseHashTableWriteLock()
+TR_IProfiler::releaseHashTableWriteLock(int32_t bucket)
    {
-   return;
+   VM_AtomicSupport::writeBarrier();
+   _bcHashTableShardLocks[bucket % BC_HASH_TABLE_SHARDS]._lock = 0;
    }
 
 void
@@ -2580,14 +2597,16 @@ TR_IProfiler::outputStats()
 void *
 TR_IPBytecodeHashTableEntry::alignedPersistentAlloc(size_t size)
    {
+   // Entries are created concurrently by the IProfiler thread and by application
+   // threads parsing their own buffers, so account for them atomically
 #if defined(TR_HOST_64BIT)
    size += 4;
-   memoryConsumed += (int32_t)size;
+   VM_AtomicSupport::addU32(&memoryConsumed, (uint32_t)size);
    void *address = (void *) jitPersistentAlloc(size);
 
    return (void *)(((uintptr_t)address + 4) & ~0x7);
 #else
-   memoryConsumed += (int32_t)size;
+   VM_AtomicSupport::addU32(&memoryConsumed, (uint32_t)size);
    return jitPersistentAlloc(size);
 #endif
    }
@@ -3663,7 +3682,9 @@ static int32_t J9THREAD_PROC iprofilerThreadProc(void * entryarg)
 
    j9thread_set_name(j9thread_self(), "JIT IProfiler");
 
+   TR::Compiler->persistentAllocator().enableThreadCache();
    iProfiler->processWorkingQueue();
+   TR::Compiler->persistentAllocator().releaseThreadCache();
 
    vm->internalVMFunctions->DetachCurrentThread((JavaVM *) vm);
    iProfiler->setIProfilerThread(NULL);
@@ -4008,6 +4029,12 @@ UDATA TR_IProfiler::parseBuffer(J9VMThread * vmThread, const U_8* dataStart, UDA
    int32_t numLoadedClasses = _compInfo->getPersistentInfo()->getNumLoadedClasses();
    int32_t numSamplesToBeSkipped = numUnloadedClasses >> 10;
    int32_t ratio = 0;
+   // Hot bytecodes show up many times in the same buffer; remember the entries
+   // touched while parsing it so repeated samples skip the hashtable walk
+   // (and, for new bytecodes, the shard lock) altogether
+   static const uint32_t RECENT_ENTRIES_CACHE_SIZE = 128;
+   TR_IPBytecodeHashTableEntry *recentEntries[RECENT_ENTRIES_CACHE_SIZE];
+   memset(recentEntries, 0, sizeof(recentEntries));
    static bool fanInDisabled = TR::Options::getCmdLineOptions()->getOption(TR_DisableInlinerFanIn) ||
                                TR::Options::getAOTCmdLineOptions()->getOption(TR_DisableInlinerFanIn);
 
@@ -4228,7 +4255,15 @@ UDATA TR_IProfiler::parseBuffer(J9VMThread * vmThread, const U_8* dataStart, UDA
 
       if (addSample && !verboseReparse)
          {
-         profilingSample ((uintptr_t)pc, (uintptr_t)data, true);
+         uint32_t slot = (uint32_t)(((uintptr_t)pc ^ ((uintptr_t)pc >> 7)) & (RECENT_ENTRIES_CACHE_SIZE - 1));
+         TR_IPBytecodeHashTableEntry *entry = recentEntries[slot];
+         if (!entry || entry->getPC() != (uintptr_t)pc)
+            {
+            entry = findOrCreateEntry(bcHash((uintptr_t)pc), (uintptr_t)pc, true);
+            recentEntries[slot] = entry;
+            }
+         if (entry && !invalidateEntryIfInconsistent(entry))
+            addSampleData(entry, (uintptr_t)data);
          records++;
          }
       }
@@ -640,8 +640,8 @@ private:
    static int32_t methodHash(uintptr_t pc);
 //   static int32_t pcHash(uintptr_t pc);
 
-   bool acquireHashTableWriteLock(bool forceFullLock);
-   void releaseHashTableWriteLock();
+   void acquireHashTableWriteLock(int32_t bucket);
+   void releaseHashTableWriteLock(int32_t bucket);
 
    TR_IPBCDataStorageHeader *searchForPersistentSample(TR_IPBCDataStorageHeader  *root, uintptr_t pc);
    TR_IPBCDataAllocation *searchForAllocSample(uintptr_t pc, int32_t bucket);
@@ -680,7 +680,19 @@ private:
    TR_J9VMBase                    *_vm;
    TR::CompilationInfo *            _compInfo;
    TR::Monitor *_hashTableMonitor;
-   uint32_t                        _lightHashTableMonitor;
+
+   // Insertions into the bytecode hashtable are serialized per shard of buckets
+   // so that threads adding samples for unrelated bytecodes do not contend.
+   // Lookups never take these locks: chains are append-at-head and entries are
+   // never freed. Each lock is padded to its own cache line.
+   static const int32_t BC_HASH_TABLE_SHARDS = 64;
+   static const int32_t BC_HASH_TABLE_SHARD_LOCK_SIZE = 64;
+   struct ShardLock
+      {
+      volatile uint32_t _lock;
+      uint8_t _padding[BC_HASH_TABLE_SHARD_LOCK_SIZE - sizeof(uint32_t)];
+      };
+   ShardLock                       _bcHashTableShardLocks[BC_HASH_TABLE_SHARDS];
 
    // value profiling
    TR_OpaqueMethodBlock           *_valueProfileMethod;
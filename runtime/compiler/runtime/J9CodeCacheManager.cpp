@@ -217,10 +217,22 @@ J9::CodeCacheManager::reserveCodeCache(bool compilationCodeAllocationsMustBeCont
                                       int32_t compThreadID,
                                       int32_t *numReserved)
    {
+   self()->parkHotCodeCache();
+
    TR::CodeCache *codeCache = self()->OMR::CodeCacheManager::reserveCodeCache(compilationCodeAllocationsMustBeContiguous,
                                                                             sizeEstimate,
                                                                             compThreadID,
                                                                             numReserved);
+   if (codeCache == NULL && _hotCodeCache != NULL)
+      {
+      // Rather than fail the compilation, let it use whatever is left in the hot code cache
+      self()->retireHotCodeCache();
+      codeCache = self()->OMR::CodeCacheManager::reserveCodeCache(compilationCodeAllocationsMustBeContiguous,
+                                                                 sizeEstimate,
+                                                                 compThreadID,
+                                                                 numReserved);
+      }
+
    if (codeCache == NULL)
       {
       J9JITConfig *jitConfig = self()->fej9()->getJ9JITConfig();
@@ -229,6 +241,79 @@ J9::CodeCacheManager::reserveCodeCache(bool compilationCodeAllocationsMustBeCont
    return codeCache;
    }
 
+TR::CodeCache*
+J9::CodeCacheManager::reserveHotCodeCache(size_t sizeEstimate,
+                                         int32_t compThreadID,
+                                         int32_t *numReserved)
+   {
+   TR::CodeCacheConfig &config = self()->codeCacheConfig();
+   size_t spaceNeeded = std::max(sizeEstimate, (size_t)config.lowCodeCacheThreshold());
+   TR::CodeCache *codeCache = NULL;
+
+   self()->parkHotCodeCache();
+
+      {
+      CacheListCriticalSection scanCacheList(self());
+      if (_hotCodeCache &&
+          _hotCodeCache->isReserved() &&
+          _hotCodeCache->getReservingCompThreadID() == HOT_CODE_CACHE_PARKED_ID &&
+          _hotCodeCache->getFreeContiguousSpace() >= spaceNeeded)
+         {
+         _hotCodeCache->reserve(compThreadID);
+         codeCache = _hotCodeCache;
+         }
+      }
+
+   // The first hot body, or the first one after the previous hot code cache
+   // filled up, starts a new hot code cache
+   if (!codeCache && !_hotCodeCache && self()->canAddNewCodeCache())
+      {
+      codeCache = TR::CodeCache::allocate(self(), config.codeCacheKB() << 10, compThreadID);
+      if (codeCache)
+         {
+         CacheListCriticalSection scanCacheList(self());
+         _hotCodeCache = codeCache;
+         if (config.verbosePerformance())
+            TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE, "Allocated hot code cache %p", codeCache);
+         }
+      }
+
+   if (codeCache)
+      {
+      *numReserved = 0;
+      return codeCache;
+      }
+
+   return self()->reserveCodeCache(false, sizeEstimate, compThreadID, numReserved);
+   }
+
+void
+J9::CodeCacheManager::parkHotCodeCache()
+   {
+   if (!_hotCodeCache)
+      return;
+
+   CacheListCriticalSection scanCacheList(self());
+   if (_hotCodeCache && !_hotCodeCache->isReserved())
+      {
+      if (_hotCodeCache->getFreeContiguousSpace() < self()->codeCacheConfig().lowCodeCacheThreshold())
+         _hotCodeCache = NULL;
+      else
+         _hotCodeCache->reserve(HOT_CODE_CACHE_PARKED_ID);
+      }
+   }
+
+void
+J9::CodeCacheManager::retireHotCodeCache()
+   {
+   CacheListCriticalSection scanCacheList(self());
+   if (_hotCodeCache &&
+       _hotCodeCache->isReserved() &&
+       _hotCodeCache->getReservingCompThreadID() == HOT_CODE_CACHE_PARKED_ID)
+      _hotCodeCache->unreserve();
+   _hotCodeCache = NULL;
+   }
+
 void
 J9::CodeCacheManager::reportCodeLoadEvents()
    {
@@ -53,7 +53,8 @@ class OMR_EXTENSIBLE CodeCacheManager : public OMR::CodeCacheManagerConnector
 public:
    CodeCacheManager(TR_FrontEnd *fe, TR::RawAllocator rawAllocator) :
       OMR::CodeCacheManagerConnector(rawAllocator),
-      _fe(fe)
+      _fe(fe),
+      _hotCodeCache(NULL)
       {
       _codeCacheManager = reinterpret_cast<TR::CodeCacheManager *>(this);
       }
@@ -89,6 +90,22 @@ public:
                                     int32_t compThreadID,
                                     int32_t *numReserved);
 
+   /**
+    * @brief Reserve a code cache for a method body that sampling has found to be hot.
+    *        Hot bodies are kept together in a dedicated hot code cache, which other
+    *        compilations do not allocate from while it has room.  Falls back to
+    *        reserveCodeCache when the hot code cache cannot be used.
+    *
+    * @param[in] sizeEstimate : estimated size of the method body
+    * @param[in] compThreadID : the reserving compilation thread
+    * @param[out] numReserved : if no cache is reserved, the number of caches reserved by others
+    *
+    * @return the reserved code cache; NULL if none is available
+    */
+   TR::CodeCache * reserveHotCodeCache(size_t sizeEstimate,
+                                       int32_t compThreadID,
+                                       int32_t *numReserved);
+
    TR::CodeCacheMemorySegment *setupMemorySegmentFromRepository(uint8_t *start,
                                                                 uint8_t *end,
                                                                 size_t & codeCacheSizeToAllocate);
@@ -152,7 +169,24 @@ public:
    void printOccupancyStats();
 
 private :
+   /**
+    * @brief Keep the hot code cache reserved while no hot compilation is using it,
+    *        so that other compilations allocate elsewhere.  A hot code cache that is
+    *        nearly full becomes an ordinary code cache.
+    */
+   void parkHotCodeCache();
+
+   /**
+    * @brief Make the hot code cache an ordinary code cache, so that all its space
+    *        can be used
+    */
+   void retireHotCodeCache();
+
+   // Reservation owner of the hot code cache while it is parked
+   static const int32_t HOT_CODE_CACHE_PARKED_ID = -2;
+
    TR_FrontEnd *_fe;
+   TR::CodeCache *_hotCodeCache;
    static TR::CodeCacheManager *_codeCacheManager;
    static J9JITConfig *_jitConfig;
    static J9JavaVM *_javaVM;
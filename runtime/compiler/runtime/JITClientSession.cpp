@@ -27,6 +27,8 @@
 #include "control/JITServerHelpers.hpp"
 #include "env/ut_j9jit.h"
 #include "net/ServerStream.hpp" // for JITServer::ServerStream
+#include "runtime/JITServerMetrics.hpp"
+#include "runtime/JITServerROMClassCache.hpp"
 #include "runtime/RuntimeAssumptions.hpp" // for TR_AddressSet
 #include "env/JITServerPersistentCHTable.hpp"
 #include "env/VerboseLog.hpp"
@@ -396,7 +398,7 @@ ClientSessionData::ClassInfo::ClassInfo() :
 void
 ClientSessionData::ClassInfo::freeClassInfo()
    {
-   TR_Memory::jitPersistentFree(_romClass);
+   JITServerHelpers::freeRemoteROMClass(_romClass);
 
    // free cached _interfaces
    _interfaces->~PersistentVector<TR_OpaqueClassBlock *>();
@@ -529,6 +531,9 @@ ClientSessionData::clearCaches()
 void
 ClientSessionData::destroy(ClientSessionData *clientSession)
    {
+   JITServerMetrics *metrics = TR::CompilationInfo::get()->getJITServerMetrics();
+   if (metrics)
+      metrics->removeClient(clientSession->getClientUID());
    clientSession->~ClientSessionData();
    TR_PersistentMemory::jitPersistentFree(clientSession);
    }
@@ -819,6 +824,13 @@ ClientSessionHT::findClientSession(uint64_t clientUID)
    return clientData;
    }
 
+ClientSessionData *
+ClientSessionHT::peekClientSession(uint64_t clientUID) const
+   {
+   auto clientDataIt = _clientSessionMap.find(clientUID);
+   return (clientDataIt != _clientSessionMap.end()) ? clientDataIt->second : NULL;
+   }
+
 
 // Purge the old client session data from the hashtable and
 // update the timeOfLastPurge.
@@ -848,6 +860,11 @@ ClientSessionHT::purgeOldDataIfNeeded()
          }
       _timeOfLastPurge = crtTime;
 
+      // ROM classes loaded from a snapshot that no client has asked for are as stale as old sessions
+      JITServerROMClassCache *romClassCache = TR::CompilationInfo::get()->getJITServerROMClassCache();
+      if (romClassCache)
+         romClassCache->purgeUnusedSnapshotEntries(crtTime, OLD_AGE);
+
       // JITServer TODO: keep stats on how many elements were purged
       }
    }
@@ -344,6 +344,7 @@ class ClientSessionData
       void *_helperAddresses[TR_numRuntimeHelpers];
 #endif
       bool _isHotReferenceFieldRequired;
+      uint64_t _sharedCacheUniqueId; // identifies the client's SCC, 0 if it cannot be identified
       }; // struct VMInfo
 
    /**
@@ -391,7 +392,7 @@ class ClientSessionData
 
    void incInUse() { _inUse++; }
    void decInUse() { _inUse--; TR_ASSERT(_inUse >= 0, "_inUse=%d must be positive\n", _inUse); }
-   bool getInUse() const { return _inUse; }
+   int8_t getInUse() const { return _inUse; }
 
    uint64_t getClientUID() const { return _clientUID; }
    void updateTimeOfLastAccess();
@@ -543,6 +544,8 @@ class ClientSessionHT
    ClientSessionData * findOrCreateClientSession(uint64_t clientUID, uint32_t seqNo, bool *newSessionWasCreated);
    bool deleteClientSession(uint64_t clientUID, bool forDeletion);
    ClientSessionData * findClientSession(uint64_t clientUID);
+   // Unlike findClientSession, does not mark the session as being in use
+   ClientSessionData * peekClientSession(uint64_t clientUID) const;
    void purgeOldDataIfNeeded();
    void printStats();
    uint32_t size() const { return _clientSessionMap.size(); }
@@ -0,0 +1,144 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "runtime/JITServerAOTCache.hpp"
+
+#include "j9.h"
+#include "control/JITServerHelpers.hpp"
+#include "env/CompilerEnv.hpp"
+
+
+JITServerAOTCache *
+JITServerAOTCache::allocate(size_t maxBytes)
+   {
+   return new (PERSISTENT_NEW) JITServerAOTCache(maxBytes);
+   }
+
+JITServerAOTCache::JITServerAOTCache(size_t maxBytes) :
+   _map(decltype(_map)::allocator_type(TR::Compiler->persistentAllocator())),
+   _monitor(TR::Monitor::create("JIT-JITServerAOTCacheMonitor")),
+   _maxBytes(maxBytes),
+   _numBytes(0),
+   _numHits(0),
+   _numMisses(0),
+   _numStores(0),
+   _numRejectedStores(0)
+   {
+   }
+
+// The destructor is currently never called because the server does not exit cleanly
+JITServerAOTCache::~JITServerAOTCache()
+   {
+   for (auto &it : _map)
+      {
+      it.second->~CachedMethod();
+      TR_Memory::jitPersistentFree(it.second);
+      }
+   _map.clear();
+   _monitor->destroy();
+   }
+
+JITServerAOTCacheKey
+JITServerAOTCache::computeKey(const J9ROMClass *romClass, uint32_t romMethodOffset, int32_t optLevel,
+                              uintptr_t classChainOffset, uintptr_t loaderChainOffset,
+                              const ClientSessionData::VMInfo *vmInfo, const std::string &clientOptStr)
+   {
+   JITServerAOTCacheKey key;
+   key._sharedCacheUniqueId = vmInfo->_sharedCacheUniqueId;
+   key._romClassHash = JITServerHelpers::hashBytes(romClass, romClass->romSize);
+   key._romMethodOffset = romMethodOffset;
+   key._optLevel = optLevel;
+   key._classChainOffset = classChainOffset;
+   key._loaderChainOffset = loaderChainOffset;
+
+   // Only VM properties that are baked into the generated code participate in the key;
+   // everything else is validated by the client when the body is relocated
+   uint64_t vmHash = JITServerHelpers::hashBytes(&vmInfo->_processorDescription, sizeof(vmInfo->_processorDescription));
+   vmHash = JITServerHelpers::hashBytes(&vmInfo->_compressObjectReferences, sizeof(vmInfo->_compressObjectReferences), vmHash);
+   vmHash = JITServerHelpers::hashBytes(&vmInfo->_compressedReferenceShift, sizeof(vmInfo->_compressedReferenceShift), vmHash);
+   vmHash = JITServerHelpers::hashBytes(&vmInfo->_usesDiscontiguousArraylets, sizeof(vmInfo->_usesDiscontiguousArraylets), vmHash);
+   vmHash = JITServerHelpers::hashBytes(&vmInfo->_arrayletLeafLogSize, sizeof(vmInfo->_arrayletLeafLogSize), vmHash);
+   vmHash = JITServerHelpers::hashBytes(&vmInfo->_readBarrierType, sizeof(vmInfo->_readBarrierType), vmHash);
+   vmHash = JITServerHelpers::hashBytes(&vmInfo->_writeBarrierType, sizeof(vmInfo->_writeBarrierType), vmHash);
+   vmHash = JITServerHelpers::hashBytes(&vmInfo->_stringCompressionEnabled, sizeof(vmInfo->_stringCompressionEnabled), vmHash);
+   vmHash = JITServerHelpers::hashBytes(&vmInfo->_reportByteCodeInfoAtCatchBlock, sizeof(vmInfo->_reportByteCodeInfoAtCatchBlock), vmHash);
+   vmHash = JITServerHelpers::hashBytes(&vmInfo->_isHotReferenceFieldRequired, sizeof(vmInfo->_isHotReferenceFieldRequired), vmHash);
+   key._vmCompatibilityHash = vmHash;
+
+   // The packed options are compared as a whole; this is conservative (any difference,
+   // even in options that don't affect the generated code, prevents sharing) but never
+   // serves a body compiled under different -Xjit options
+   key._clientOptionsHash = JITServerHelpers::hashBytes(clientOptStr.data(), clientOptStr.size());
+   return key;
+   }
+
+bool
+JITServerAOTCache::find(const JITServerAOTCacheKey &key, std::string &codeCacheStr, std::string &dataCacheStr)
+   {
+   OMR::CriticalSection aotCache(_monitor);
+   auto it = _map.find(key);
+   if (it == _map.end())
+      {
+      _numMisses++;
+      return false;
+      }
+   _numHits++;
+   it->second->_numHits++;
+   codeCacheStr = it->second->_codeCacheStr;
+   dataCacheStr = it->second->_dataCacheStr;
+   return true;
+   }
+
+bool
+JITServerAOTCache::store(const JITServerAOTCacheKey &key, const std::string &codeCacheStr, const std::string &dataCacheStr)
+   {
+   size_t bytes = codeCacheStr.size() + dataCacheStr.size();
+   OMR::CriticalSection aotCache(_monitor);
+   if (_map.find(key) != _map.end())
+      return false; // another client compiled the same method concurrently
+   if (_numBytes + bytes > _maxBytes)
+      {
+      _numRejectedStores++;
+      return false;
+      }
+
+   CachedMethod *method = new (PERSISTENT_NEW) CachedMethod(codeCacheStr, dataCacheStr);
+   if (!method)
+      return false;
+   _map.insert(std::make_pair(key, method));
+   _numBytes += bytes;
+   _numStores++;
+   return true;
+   }
+
+// to print these stats,
+// set the env var `TR_PrintJITServerAOTCacheStats=1`
+void
+JITServerAOTCache::printStats()
+   {
+   OMR::CriticalSection aotCache(_monitor);
+   PORT_ACCESS_FROM_PORT(TR::Compiler->portLib);
+   j9tty_printf(PORTLIB, "JITServer AOT cache:\n");
+   j9tty_printf(PORTLIB, "\tmethods = %zu bytes = %zu (max %zu)\n", _map.size(), _numBytes, _maxBytes);
+   j9tty_printf(PORTLIB, "\thits = %u misses = %u stores = %u rejected stores = %u\n",
+                _numHits, _numMisses, _numStores, _numRejectedStores);
+   }
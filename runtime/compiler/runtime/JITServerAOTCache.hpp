@@ -0,0 +1,168 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef JITSERVER_AOTCACHE_H
+#define JITSERVER_AOTCACHE_H
+
+#include <string>
+#include "infra/Monitor.hpp"  // TR::Monitor
+#include "env/PersistentCollections.hpp" // for PersistentUnorderedMap
+#include "runtime/JITClientSession.hpp" // for ClientSessionData::VMInfo
+
+class J9ROMClass;
+
+/**
+   @class JITServerAOTCacheKey
+   @brief Identifies an AOT method body that can be shared between JITClients
+
+   Remote AOT bodies reference classes and methods only through offsets into the
+   client's shared class cache (SCC), and the relocation records of a body hold more
+   such offsets. These offsets are only meaningful in the SCC they were taken from,
+   so bodies are shared only between clients using the same SCC, as identified by the
+   unique ID stored in its AOT header. Within one SCC, two clients can reuse the same
+   body when the ROM class of the method has identical content, the class chain of the
+   defining class lives at the same SCC offset, the client VMs agree on every
+   property that influences the generated code, and the clients compiled the method
+   with the same JIT options (e.g. -Xjit:disableXXX).
+ */
+struct JITServerAOTCacheKey
+   {
+   uint64_t _sharedCacheUniqueId; // unique ID of the client's SCC that all the offsets refer to
+   uint64_t _romClassHash;        // hash of the ROM class content
+   uint32_t _romMethodOffset;     // offset of the ROM method inside the ROM class
+   int32_t  _optLevel;            // TR_Hotness of the compilation
+   uintptr_t _classChainOffset;   // SCC offset of the class chain of the defining class
+   uintptr_t _loaderChainOffset;  // SCC offset of the class chain identifying the class loader
+   uint64_t _vmCompatibilityHash; // hash of client VM properties that affect code generation
+   uint64_t _clientOptionsHash;   // hash of the packed JIT options the client compiled the method with
+
+   bool operator==(const JITServerAOTCacheKey &other) const
+      {
+      return _sharedCacheUniqueId == other._sharedCacheUniqueId &&
+             _romClassHash == other._romClassHash &&
+             _romMethodOffset == other._romMethodOffset &&
+             _optLevel == other._optLevel &&
+             _classChainOffset == other._classChainOffset &&
+             _loaderChainOffset == other._loaderChainOffset &&
+             _vmCompatibilityHash == other._vmCompatibilityHash &&
+             _clientOptionsHash == other._clientOptionsHash;
+      }
+   };
+
+namespace std
+   {
+   template <> struct hash<JITServerAOTCacheKey>
+      {
+      std::size_t operator()(const JITServerAOTCacheKey &k) const noexcept
+         {
+         return std::hash<uint64_t>()(k._sharedCacheUniqueId) ^
+                std::hash<uint64_t>()(k._romClassHash) ^
+                std::hash<uint32_t>()(k._romMethodOffset) ^
+                std::hash<int32_t>()(k._optLevel) ^
+                std::hash<uintptr_t>()(k._classChainOffset) ^
+                std::hash<uintptr_t>()(k._loaderChainOffset) ^
+                std::hash<uint64_t>()(k._vmCompatibilityHash) ^
+                std::hash<uint64_t>()(k._clientOptionsHash);
+         }
+      };
+   }
+
+/**
+   @class JITServerAOTCache
+   @brief Server-wide cache of serialized AOT method bodies shared by all JITClients
+
+   When a JITClient requests an AOT compilation, the server looks up the cache
+   using a JITServerAOTCacheKey. On a hit the cached code and data sections are
+   sent back as if they were the product of a compilation, and the client stores
+   and relocates them through the regular remote AOT path. Successful AOT
+   compilations without client-specific runtime assumptions are added to the cache.
+
+   The cache is enabled with -XX:+JITServerUseAOTCache and is bounded in size by
+   -XX:JITServerAOTCacheMaxKB=<n>. Once full, no new bodies are added.
+   Access to the hashtable is protected by an internal monitor.
+ */
+class JITServerAOTCache
+   {
+   public:
+   TR_PERSISTENT_ALLOC(TR_Memory::PersistentInfo)
+
+   struct CachedMethod
+      {
+      TR_PERSISTENT_ALLOC(TR_Memory::PersistentInfo)
+      CachedMethod(const std::string &codeCacheStr, const std::string &dataCacheStr) :
+         _codeCacheStr(codeCacheStr), _dataCacheStr(dataCacheStr), _numHits(0) {}
+
+      const std::string _codeCacheStr;
+      const std::string _dataCacheStr;
+      uint32_t _numHits;
+      };
+
+   JITServerAOTCache(size_t maxBytes);
+   ~JITServerAOTCache();
+   static JITServerAOTCache *allocate(size_t maxBytes);
+
+   /**
+      @brief Build the key of an AOT compilation request
+
+      @param romClass The server-side copy of the ROM class of the method
+      @param romMethodOffset Offset of the ROM method in the ROM class
+      @param optLevel Optimization level requested by the client
+      @param classChainOffset SCC offset of the class chain of the defining class
+      @param loaderChainOffset SCC offset of the class chain identifying the class loader
+      @param vmInfo Information about the client VM, including the unique ID of its SCC
+      @param clientOptStr The packed TR::Options sent by the client with the compilation request
+   */
+   static JITServerAOTCacheKey computeKey(const J9ROMClass *romClass, uint32_t romMethodOffset, int32_t optLevel,
+                                          uintptr_t classChainOffset, uintptr_t loaderChainOffset,
+                                          const ClientSessionData::VMInfo *vmInfo, const std::string &clientOptStr);
+
+   /**
+      @brief Find a cached AOT body and copy its code and data sections
+
+      @return true on a cache hit, false otherwise
+   */
+   bool find(const JITServerAOTCacheKey &key, std::string &codeCacheStr, std::string &dataCacheStr);
+
+   /**
+      @brief Store an AOT body if the key is not already present and the size limit allows it
+
+      @return true if the body was added to the cache
+   */
+   bool store(const JITServerAOTCacheKey &key, const std::string &codeCacheStr, const std::string &dataCacheStr);
+
+   size_t size() const { return _map.size(); }
+   size_t getNumBytes() const { return _numBytes; }
+   void printStats();
+
+   private:
+   PersistentUnorderedMap<JITServerAOTCacheKey, CachedMethod *> _map;
+   TR::Monitor *_monitor;
+   const size_t _maxBytes;
+   size_t _numBytes;
+   // Statistics
+   uint32_t _numHits;
+   uint32_t _numMisses;
+   uint32_t _numStores;
+   uint32_t _numRejectedStores; // stores refused because the cache was full
+   }; // class JITServerAOTCache
+
+#endif /* defined(JITSERVER_AOTCACHE_H) */
@@ -0,0 +1,220 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "runtime/JITServerMetrics.hpp"
+
+#include <string>
+#include "j9.h"
+#include "omrformatconsts.h"
+#include "AtomicSupport.hpp"
+#include "control/CompilationRuntime.hpp"
+#include "env/CompilerEnv.hpp"
+#include "infra/CriticalSection.hpp"
+#include "runtime/JITClientSession.hpp"
+
+
+// Upper bounds of the latency buckets in microseconds
+const uint64_t JITServerMetrics::_latencyBucketBoundsUs[NUM_LATENCY_BUCKETS - 1] =
+   {
+   10, 25, 50, 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 1000000
+   };
+
+JITServerMetrics *
+JITServerMetrics::allocate()
+   {
+   return new (PERSISTENT_NEW) JITServerMetrics();
+   }
+
+JITServerMetrics::JITServerMetrics() :
+   _compThreadBusyUs(0),
+   _clientQueueWait(decltype(_clientQueueWait)::allocator_type(TR::Compiler->persistentAllocator())),
+   _monitor(TR::Monitor::create("JIT-JITServerMetricsMonitor"))
+   {
+   memset(_roundTrip, 0, sizeof(_roundTrip));
+   memset(_bytesSent, 0, sizeof(_bytesSent));
+   memset(_bytesReceived, 0, sizeof(_bytesReceived));
+   memset(_messagesReceived, 0, sizeof(_messagesReceived));
+   memset(&_queueWait, 0, sizeof(_queueWait));
+   }
+
+// The destructor is currently never called because the server does not exit cleanly
+JITServerMetrics::~JITServerMetrics()
+   {
+   _monitor->destroy();
+   }
+
+uint64_t
+JITServerMetrics::getTimeUs()
+   {
+   PORT_ACCESS_FROM_PORT(TR::Compiler->portLib);
+   return j9time_usec_clock();
+   }
+
+void
+JITServerMetrics::Histogram::add(uint64_t valueUs)
+   {
+   size_t bucket = 0;
+   while ((bucket < NUM_LATENCY_BUCKETS - 1) && (valueUs > _latencyBucketBoundsUs[bucket]))
+      bucket++;
+   VM_AtomicSupport::add(&_buckets[bucket], 1);
+   VM_AtomicSupport::add(&_count, 1);
+   VM_AtomicSupport::add(&_sumUs, valueUs);
+   }
+
+void
+JITServerMetrics::Histogram::print(FILE *file, const char *name, const char *labels) const
+   {
+   const char *separator = labels[0] ? "," : "";
+   uintptr_t cumulative = 0;
+   for (size_t i = 0; i < NUM_LATENCY_BUCKETS - 1; ++i)
+      {
+      cumulative += _buckets[i];
+      fprintf(file, "%s_bucket{%s%sle=\"%g\"} %" OMR_PRIuPTR "\n", name, labels, separator, _latencyBucketBoundsUs[i] / 1e6, cumulative);
+      }
+   fprintf(file, "%s_bucket{%s%sle=\"+Inf\"} %" OMR_PRIuPTR "\n", name, labels, separator, cumulative + _buckets[NUM_LATENCY_BUCKETS - 1]);
+   fprintf(file, "%s_sum{%s} %.6f\n", name, labels, _sumUs / 1e6);
+   fprintf(file, "%s_count{%s} %" OMR_PRIuPTR "\n", name, labels, _count);
+   }
+
+void
+JITServerMetrics::recordBytesSent(JITServer::MessageType type, uint32_t bytes)
+   {
+   VM_AtomicSupport::add(&_bytesSent[type], bytes);
+   }
+
+void
+JITServerMetrics::recordBytesReceived(JITServer::MessageType type, uint32_t bytes)
+   {
+   VM_AtomicSupport::add(&_bytesReceived[type], bytes);
+   VM_AtomicSupport::add(&_messagesReceived[type], 1);
+   }
+
+void
+JITServerMetrics::recordQueueWait(uint64_t clientUID, uint64_t waitUs)
+   {
+   _queueWait.add(waitUs);
+   OMR::CriticalSection metrics(_monitor);
+   ClientQueueWait &clientWait = _clientQueueWait[clientUID];
+   clientWait._count++;
+   clientWait._sumUs += waitUs;
+   if (waitUs > clientWait._maxUs)
+      clientWait._maxUs = waitUs;
+   }
+
+void
+JITServerMetrics::removeClient(uint64_t clientUID)
+   {
+   OMR::CriticalSection metrics(_monitor);
+   _clientQueueWait.erase(clientUID);
+   }
+
+void
+JITServerMetrics::recordCompThreadBusyTime(uint64_t busyUs)
+   {
+   VM_AtomicSupport::add(&_compThreadBusyUs, busyUs);
+   }
+
+bool
+JITServerMetrics::writeToFile(const char *fileName, TR::CompilationInfo *compInfo)
+   {
+   std::string tmpFileName = std::string(fileName) + ".tmp";
+   FILE *file = fopen(tmpFileName.c_str(), "w");
+   if (!file)
+      return false;
+
+   char labels[128];
+   fprintf(file, "# HELP jitserver_message_round_trip_seconds Time between sending a message to a client and receiving its response\n");
+   fprintf(file, "# TYPE jitserver_message_round_trip_seconds histogram\n");
+   for (int i = 0; i < JITServer::MessageType_ARRAYSIZE; ++i)
+      {
+      if (_roundTrip[i]._count)
+         {
+         snprintf(labels, sizeof(labels), "type=\"%s\"", JITServer::messageNames[i]);
+         _roundTrip[i].print(file, "jitserver_message_round_trip_seconds", labels);
+         }
+      }
+
+   fprintf(file, "# HELP jitserver_message_sent_bytes_total Bytes sent to clients, by message type\n");
+   fprintf(file, "# TYPE jitserver_message_sent_bytes_total counter\n");
+   for (int i = 0; i < JITServer::MessageType_ARRAYSIZE; ++i)
+      {
+      if (_bytesSent[i])
+         fprintf(file, "jitserver_message_sent_bytes_total{type=\"%s\"} %" OMR_PRIuPTR "\n", JITServer::messageNames[i], _bytesSent[i]);
+      }
+
+   fprintf(file, "# HELP jitserver_message_received_bytes_total Bytes received from clients, by message type\n");
+   fprintf(file, "# TYPE jitserver_message_received_bytes_total counter\n");
+   for (int i = 0; i < JITServer::MessageType_ARRAYSIZE; ++i)
+      {
+      if (_bytesReceived[i])
+         fprintf(file, "jitserver_message_received_bytes_total{type=\"%s\"} %" OMR_PRIuPTR "\n", JITServer::messageNames[i], _bytesReceived[i]);
+      }
+
+   fprintf(file, "# HELP jitserver_messages_received_total Messages received from clients, by message type\n");
+   fprintf(file, "# TYPE jitserver_messages_received_total counter\n");
+   for (int i = 0; i < JITServer::MessageType_ARRAYSIZE; ++i)
+      {
+      if (_messagesReceived[i])
+         fprintf(file, "jitserver_messages_received_total{type=\"%s\"} %" OMR_PRIuPTR "\n", JITServer::messageNames[i], _messagesReceived[i]);
+      }
+
+   fprintf(file, "# HELP jitserver_queue_wait_seconds Time received compilation requests wait for a compilation thread\n");
+   fprintf(file, "# TYPE jitserver_queue_wait_seconds histogram\n");
+   _queueWait.print(file, "jitserver_queue_wait_seconds", "");
+
+      {
+      OMR::CriticalSection metrics(_monitor);
+      fprintf(file, "# HELP jitserver_client_queue_wait_seconds Time received compilation requests wait for a compilation thread, by connected client\n");
+      fprintf(file, "# TYPE jitserver_client_queue_wait_seconds summary\n");
+      for (auto &it : _clientQueueWait)
+         {
+         fprintf(file, "jitserver_client_queue_wait_seconds_sum{client=\"%llu\"} %.6f\n", (unsigned long long)it.first, it.second._sumUs / 1e6);
+         fprintf(file, "jitserver_client_queue_wait_seconds_count{client=\"%llu\"} %llu\n", (unsigned long long)it.first, (unsigned long long)it.second._count);
+         }
+      fprintf(file, "# HELP jitserver_client_queue_wait_max_seconds Longest time a received compilation request waited for a compilation thread, by connected client\n");
+      fprintf(file, "# TYPE jitserver_client_queue_wait_max_seconds gauge\n");
+      for (auto &it : _clientQueueWait)
+         fprintf(file, "jitserver_client_queue_wait_max_seconds{client=\"%llu\"} %.6f\n", (unsigned long long)it.first, it.second._maxUs / 1e6);
+      }
+
+   // Utilization is rate(jitserver_compilation_thread_busy_seconds_total) / jitserver_compilation_threads
+   fprintf(file, "# HELP jitserver_compilation_thread_busy_seconds_total Time compilation threads spent processing requests\n");
+   fprintf(file, "# TYPE jitserver_compilation_thread_busy_seconds_total counter\n");
+   fprintf(file, "jitserver_compilation_thread_busy_seconds_total %.6f\n", _compThreadBusyUs / 1e6);
+   fprintf(file, "# HELP jitserver_compilation_threads Number of usable compilation threads\n");
+   fprintf(file, "# TYPE jitserver_compilation_threads gauge\n");
+   fprintf(file, "jitserver_compilation_threads %d\n", compInfo->getNumUsableCompilationThreads());
+   fprintf(file, "# HELP jitserver_compilation_threads_active Number of active compilation threads\n");
+   fprintf(file, "# TYPE jitserver_compilation_threads_active gauge\n");
+   fprintf(file, "jitserver_compilation_threads_active %d\n", compInfo->getNumCompThreadsActive());
+   fprintf(file, "# HELP jitserver_clients Number of connected clients\n");
+   fprintf(file, "# TYPE jitserver_clients gauge\n");
+   fprintf(file, "jitserver_clients %u\n", (uint32_t)compInfo->getClientSessionHT()->size());
+
+   bool ok = !ferror(file);
+   ok = (fclose(file) == 0) && ok;
+   if (ok)
+      ok = rename(tmpFileName.c_str(), fileName) == 0;
+   else
+      remove(tmpFileName.c_str());
+   return ok;
+   }
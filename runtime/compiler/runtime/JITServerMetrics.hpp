@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef JITSERVER_METRICS_H
+#define JITSERVER_METRICS_H
+
+#include <stdio.h>
+#include "infra/Monitor.hpp"  // TR::Monitor
+#include "env/PersistentCollections.hpp" // for PersistentUnorderedMap
+#include "net/MessageTypes.hpp" // for JITServer::MessageType
+
+namespace TR { class CompilationInfo; }
+
+/**
+   @class JITServerMetrics
+   @brief Server-wide counters and latency histograms describing where remote compilations spend time
+
+   The following metrics are collected:
+   1) For every MessageType, the round-trip latency between the server sending a query
+      to the client and receiving the response, and the number of bytes sent and received
+      on the wire (after compression)
+   2) The time compilation requests wait in the compilation queue after they were received,
+      in total and per connected client. The arrival of a request is only observed by the
+      listener with -XX:+JITServerUseEventDrivenIO; otherwise a compilation thread takes
+      the connection before the request arrives and no wait is recorded.
+      Per-client data is dropped when the client session is deleted.
+   3) The time compilation threads spend processing requests, from which their
+      utilization can be derived
+
+   Metrics are enabled with -XX:JITServerMetricsFile=<path>. The JITServer statistics thread
+   then periodically rewrites that file in the Prometheus text exposition format.
+   Counters are updated with atomic operations; only the per-client table is protected
+   by the internal monitor.
+ */
+class JITServerMetrics
+   {
+   public:
+   TR_PERSISTENT_ALLOC(TR_Memory::PersistentInfo)
+
+   JITServerMetrics();
+   ~JITServerMetrics();
+   static JITServerMetrics *allocate();
+
+   static uint64_t getTimeUs();
+
+   void recordRoundTrip(JITServer::MessageType type, uint64_t latencyUs) { _roundTrip[type].add(latencyUs); }
+   void recordBytesSent(JITServer::MessageType type, uint32_t bytes);
+   void recordBytesReceived(JITServer::MessageType type, uint32_t bytes);
+   void recordQueueWait(uint64_t clientUID, uint64_t waitUs);
+   void removeClient(uint64_t clientUID);
+   void recordCompThreadBusyTime(uint64_t busyUs);
+
+   /**
+      @brief Write all metrics to a file in the Prometheus text exposition format
+
+      The metrics are written to a temporary file that is then renamed,
+      so that readers never see a partially written file.
+
+      @return true if the file was written successfully
+   */
+   bool writeToFile(const char *fileName, TR::CompilationInfo *compInfo);
+
+   private:
+   static const size_t NUM_LATENCY_BUCKETS = 16;
+   static const uint64_t _latencyBucketBoundsUs[NUM_LATENCY_BUCKETS - 1]; // last bucket is +Inf
+
+   struct Histogram
+      {
+      void add(uint64_t valueUs);
+      void print(FILE *file, const char *name, const char *labels) const;
+
+      uintptr_t _buckets[NUM_LATENCY_BUCKETS]; // not cumulative; summed when printed
+      uintptr_t _count;
+      uintptr_t _sumUs;
+      };
+
+   struct ClientQueueWait
+      {
+      uint64_t _count;
+      uint64_t _sumUs;
+      uint64_t _maxUs;
+      };
+
+   Histogram _roundTrip[JITServer::MessageType_ARRAYSIZE];
+   uintptr_t _bytesSent[JITServer::MessageType_ARRAYSIZE];
+   uintptr_t _bytesReceived[JITServer::MessageType_ARRAYSIZE];
+   uintptr_t _messagesReceived[JITServer::MessageType_ARRAYSIZE];
+   Histogram _queueWait;
+   uintptr_t _compThreadBusyUs;
+   PersistentUnorderedMap<uint64_t, ClientQueueWait> _clientQueueWait;
+   TR::Monitor *_monitor;
+   }; // class JITServerMetrics
+
+#endif /* defined(JITSERVER_METRICS_H) */
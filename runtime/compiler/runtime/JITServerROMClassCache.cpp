@@ -0,0 +1,330 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "runtime/JITServerROMClassCache.hpp"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "j9.h"
+#include "control/JITServerHelpers.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/VerboseLog.hpp"
+#include "infra/CriticalSection.hpp"
+#include "net/CommunicationStream.hpp"
+
+
+JITServerROMClassCache *
+JITServerROMClassCache::allocate()
+   {
+   return new (PERSISTENT_NEW) JITServerROMClassCache();
+   }
+
+JITServerROMClassCache::JITServerROMClassCache() :
+   _map(decltype(_map)::allocator_type(TR::Compiler->persistentAllocator())),
+   _entriesByROMClass(decltype(_entriesByROMClass)::allocator_type(TR::Compiler->persistentAllocator())),
+   _monitor(TR::Monitor::create("JIT-JITServerROMClassCacheMonitor")),
+   _snapshotLoadTimeMs(0),
+   _numHits(0),
+   _numMisses(0),
+   _numHashCollisions(0),
+   _numLoadedFromSnapshot(0),
+   _numPurgedFromSnapshot(0)
+   {
+   }
+
+// The destructor is currently never called because the server does not exit cleanly
+JITServerROMClassCache::~JITServerROMClassCache()
+   {
+   for (auto &it : _map)
+      freeEntry(it.second);
+   _map.clear();
+   _entriesByROMClass.clear();
+   _monitor->destroy();
+   }
+
+J9ROMClass *
+JITServerROMClassCache::copyROMClass(const void *data, size_t size)
+   {
+   J9ROMClass *romClass = (J9ROMClass *)TR_Memory::jitPersistentAlloc(size, TR_Memory::ROMClass);
+   if (!romClass)
+      throw std::bad_alloc();
+   memcpy(romClass, data, size);
+   return romClass;
+   }
+
+void
+JITServerROMClassCache::freeEntry(Entry *entry)
+   {
+   TR_Memory::jitPersistentFree(entry->_romClass);
+   entry->~Entry();
+   TR_Memory::jitPersistentFree(entry);
+   }
+
+J9ROMClass *
+JITServerROMClassCache::getOrCreate(const std::string &romClassStr)
+   {
+   uint64_t hash = JITServerHelpers::hashBytes(&romClassStr[0], romClassStr.size());
+   OMR::CriticalSection romClassCache(_monitor);
+   auto it = _map.find(hash);
+   if (it != _map.end())
+      {
+      Entry *entry = it->second;
+      if ((entry->_size == romClassStr.size()) &&
+          !memcmp(entry->_romClass, &romClassStr[0], romClassStr.size()))
+         {
+         _numHits++;
+         entry->_refCount++;
+         entry->_fromSnapshot = false;
+         return entry->_romClass;
+         }
+      // Different content with the same hash; give the caller a private copy
+      // which release() will recognize because it is not a cached pointer
+      _numHashCollisions++;
+      return copyROMClass(&romClassStr[0], romClassStr.size());
+      }
+
+   _numMisses++;
+   J9ROMClass *romClass = copyROMClass(&romClassStr[0], romClassStr.size());
+   Entry *entry = new (PERSISTENT_NEW) Entry(romClass, romClassStr.size(), hash, false);
+   if (!entry)
+      {
+      TR_Memory::jitPersistentFree(romClass);
+      throw std::bad_alloc();
+      }
+   entry->_refCount = 1;
+   _map.insert(std::make_pair(hash, entry));
+   _entriesByROMClass.insert(std::make_pair(romClass, entry));
+   return romClass;
+   }
+
+void
+JITServerROMClassCache::release(J9ROMClass *romClass)
+   {
+   OMR::CriticalSection romClassCache(_monitor);
+   auto it = _entriesByROMClass.find(romClass);
+   if (it == _entriesByROMClass.end())
+      {
+      // Private copy handed out on a hash collision
+      TR_Memory::jitPersistentFree(romClass);
+      return;
+      }
+
+   Entry *entry = it->second;
+   TR_ASSERT(entry->_refCount > 0, "Releasing ROM class %p which is not referenced", romClass);
+   if (--entry->_refCount == 0)
+      {
+      _entriesByROMClass.erase(it);
+      _map.erase(entry->_hash);
+      freeEntry(entry);
+      }
+   }
+
+bool
+JITServerROMClassCache::copyIfPresent(uint64_t hash, uint32_t size, std::string &romClassStr)
+   {
+   OMR::CriticalSection romClassCache(_monitor);
+   auto it = _map.find(hash);
+   if ((it == _map.end()) || (it->second->_size != size))
+      return false;
+   romClassStr.assign((const char *)it->second->_romClass, size);
+   return true;
+   }
+
+void
+JITServerROMClassCache::purgeUnusedSnapshotEntries(int64_t crtTimeMs, int64_t maxAgeMs)
+   {
+   OMR::CriticalSection romClassCache(_monitor);
+   if ((_snapshotLoadTimeMs == 0) || (crtTimeMs - _snapshotLoadTimeMs <= maxAgeMs))
+      return;
+
+   uint32_t numPurged = 0;
+   for (auto it = _map.begin(); it != _map.end();)
+      {
+      Entry *entry = it->second;
+      if (entry->_fromSnapshot)
+         {
+         TR_ASSERT(entry->_refCount == 0, "Snapshot entry for ROM class %p is referenced", entry->_romClass);
+         _entriesByROMClass.erase(entry->_romClass);
+         it = _map.erase(it);
+         freeEntry(entry);
+         numPurged++;
+         }
+      else
+         {
+         ++it;
+         }
+      }
+   _numPurgedFromSnapshot += numPurged;
+   _snapshotLoadTimeMs = 0;
+
+   if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+      TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Purged %u ROM classes loaded from snapshot and not used by any client", numPurged);
+   }
+
+bool
+JITServerROMClassCache::load(const char *fileName)
+   {
+   int fd = open(fileName, O_RDONLY);
+   if (fd < 0)
+      return false;
+
+   struct stat st;
+   if ((fstat(fd, &st) < 0) || ((size_t)st.st_size < sizeof(SnapshotHeader)))
+      {
+      close(fd);
+      return false;
+      }
+   size_t fileSize = st.st_size;
+   void *mapping = mmap(NULL, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+   close(fd);
+   if (mapping == MAP_FAILED)
+      return false;
+
+   const uint8_t *start = (const uint8_t *)mapping;
+   const uint8_t *end = start + fileSize;
+   const SnapshotHeader *header = (const SnapshotHeader *)start;
+   bool valid = (header->_magic == SNAPSHOT_MAGIC) &&
+                (header->_fullVersion == JITServer::CommunicationStream::getJITServerFullVersion());
+   uint32_t numLoaded = 0;
+   if (valid)
+      {
+      OMR::CriticalSection romClassCache(_monitor);
+      const uint8_t *cursor = start + sizeof(SnapshotHeader);
+      for (uint32_t i = 0; i < header->_numEntries; ++i)
+         {
+         if ((size_t)(end - cursor) < sizeof(SnapshotEntryHeader))
+            break;
+         const SnapshotEntryHeader *entryHeader = (const SnapshotEntryHeader *)cursor;
+         const uint8_t *data = cursor + sizeof(SnapshotEntryHeader);
+         size_t paddedSize = paddedEntrySize(entryHeader->_size);
+         if ((size_t)(end - data) < paddedSize)
+            break;
+         // Skip corrupted entries and entries too small for the ROM class they contain
+         if ((entryHeader->_size < sizeof(J9ROMClass)) ||
+             (((const J9ROMClass *)data)->romSize > entryHeader->_size) ||
+             (JITServerHelpers::hashBytes(data, entryHeader->_size) != entryHeader->_hash))
+            {
+            cursor = data + paddedSize;
+            continue;
+            }
+         if (_map.find(entryHeader->_hash) == _map.end())
+            {
+            J9ROMClass *romClass = copyROMClass(data, entryHeader->_size);
+            Entry *entry = new (PERSISTENT_NEW) Entry(romClass, entryHeader->_size, entryHeader->_hash, true);
+            if (!entry)
+               {
+               TR_Memory::jitPersistentFree(romClass);
+               throw std::bad_alloc();
+               }
+            _map.insert(std::make_pair(entryHeader->_hash, entry));
+            _entriesByROMClass.insert(std::make_pair(romClass, entry));
+            numLoaded++;
+            }
+         cursor = data + paddedSize;
+         }
+      _numLoadedFromSnapshot += numLoaded;
+      if (numLoaded > 0)
+         {
+         PORT_ACCESS_FROM_PORT(TR::Compiler->portLib);
+         _snapshotLoadTimeMs = j9time_current_time_millis();
+         }
+      }
+   munmap(mapping, fileSize);
+
+   if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+      {
+      if (valid)
+         TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Loaded %u ROM classes from snapshot %s", numLoaded, fileName);
+      else
+         TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Ignoring incompatible ROM class snapshot %s", fileName);
+      }
+   return valid;
+   }
+
+bool
+JITServerROMClassCache::save(const char *fileName)
+   {
+   std::string tmpFileName = std::string(fileName) + ".tmp";
+   FILE *file = fopen(tmpFileName.c_str(), "wb");
+   if (!file)
+      return false;
+
+   static const uint8_t padding[sizeof(uint64_t)] = { 0 };
+   bool ok = true;
+   uint32_t numEntries = 0;
+      {
+      OMR::CriticalSection romClassCache(_monitor);
+      SnapshotHeader header;
+      header._magic = SNAPSHOT_MAGIC;
+      header._numEntries = _map.size();
+      header._fullVersion = JITServer::CommunicationStream::getJITServerFullVersion();
+      ok = fwrite(&header, sizeof(header), 1, file) == 1;
+
+      for (auto it = _map.begin(); ok && (it != _map.end()); ++it)
+         {
+         SnapshotEntryHeader entryHeader;
+         entryHeader._hash = it->first;
+         entryHeader._size = it->second->_size;
+         entryHeader._padding = 0;
+         size_t paddingSize = paddedEntrySize(entryHeader._size) - entryHeader._size;
+         ok = (fwrite(&entryHeader, sizeof(entryHeader), 1, file) == 1) &&
+              (fwrite(it->second->_romClass, entryHeader._size, 1, file) == 1) &&
+              ((paddingSize == 0) || (fwrite(padding, paddingSize, 1, file) == 1));
+         numEntries++;
+         }
+      }
+
+   ok = (fclose(file) == 0) && ok;
+   if (ok)
+      ok = rename(tmpFileName.c_str(), fileName) == 0;
+   else
+      remove(tmpFileName.c_str());
+
+   if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+      {
+      if (ok)
+         TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Saved %u ROM classes to snapshot %s", numEntries, fileName);
+      else
+         TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Failed to save ROM class snapshot %s", fileName);
+      }
+   return ok;
+   }
+
+// to print these stats,
+// set the env var `TR_PrintJITServerROMClassCacheStats=1`
+void
+JITServerROMClassCache::printStats()
+   {
+   OMR::CriticalSection romClassCache(_monitor);
+   size_t numBytes = 0;
+   for (auto &it : _map)
+      numBytes += it.second->_size;
+   PORT_ACCESS_FROM_PORT(TR::Compiler->portLib);
+   j9tty_printf(PORTLIB, "JITServer ROM class cache:\n");
+   j9tty_printf(PORTLIB, "\tROM classes = %zu bytes = %zu loaded from snapshot = %u purged unused from snapshot = %u\n",
+                _map.size(), numBytes, _numLoadedFromSnapshot, _numPurgedFromSnapshot);
+   j9tty_printf(PORTLIB, "\thits = %u misses = %u hash collisions = %u\n", _numHits, _numMisses, _numHashCollisions);
+   }
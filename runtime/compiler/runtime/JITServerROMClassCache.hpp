@@ -0,0 +1,159 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef JITSERVER_ROMCLASSCACHE_H
+#define JITSERVER_ROMCLASSCACHE_H
+
+#include <string>
+#include "infra/Monitor.hpp"  // TR::Monitor
+#include "env/PersistentCollections.hpp" // for PersistentUnorderedMap
+
+struct J9ROMClass;
+
+/**
+   @class JITServerROMClassCache
+   @brief Server-wide store of ROM classes received from JITClients, keyed by content hash
+
+   ROM classes are position independent and identical for all clients that load
+   the same class from the same class file, so a single copy can back the ClassInfo
+   of every ClientSessionData that refers to it. Entries are reference counted by
+   the client sessions that use them. The store is enabled with -XX:+JITServerShareROMClasses.
+
+   The store can be saved to a snapshot file when the server shuts down and reloaded
+   when it starts (-XX:JITServerROMClassCacheFile=<path>), so that a restarted server
+   does not have to rebuild its ROM class copies one client session at a time.
+   A snapshot is only accepted if it was written by the same JITServer version and
+   configuration, and every entry is validated against its content hash when loaded.
+   Entries loaded from a snapshot are released like the others once the last client
+   session using them goes away; those that no client uses within the age limit of
+   client sessions are dropped by purgeUnusedSnapshotEntries().
+
+   When the store is enabled, the server asks clients for the hash of a ROM class
+   before asking for its content (see JITServerHelpers::getRemoteROMClassInfo()),
+   so that classes it already holds, e.g. from a snapshot, are not sent again.
+ */
+class JITServerROMClassCache
+   {
+   public:
+   TR_PERSISTENT_ALLOC(TR_Memory::PersistentInfo)
+
+   JITServerROMClassCache();
+   ~JITServerROMClassCache();
+   static JITServerROMClassCache *allocate();
+
+   /**
+      @brief Return the cached copy of a serialized ROM class, creating it if needed
+
+      The reference count of the returned ROM class is incremented; the caller
+      must call release() when the ROM class is no longer needed.
+   */
+   J9ROMClass *getOrCreate(const std::string &romClassStr);
+
+   /**
+      @brief Drop a reference to a ROM class returned by getOrCreate()
+   */
+   void release(J9ROMClass *romClass);
+
+   /**
+      @brief Copy the content of a cached ROM class identified by its hash and size
+
+      @return true if the store has the ROM class, false otherwise
+   */
+   bool copyIfPresent(uint64_t hash, uint32_t size, std::string &romClassStr);
+
+   /**
+      @brief Drop the entries loaded from a snapshot that no client has used
+
+      Does nothing until maxAgeMs have passed since the snapshot was loaded,
+      and nothing after the first purge.
+   */
+   void purgeUnusedSnapshotEntries(int64_t crtTimeMs, int64_t maxAgeMs);
+
+   /**
+      @brief Load entries from a snapshot file written by save()
+
+      @return true if the snapshot was valid and its entries were loaded
+   */
+   bool load(const char *fileName);
+
+   /**
+      @brief Write all entries to a snapshot file
+
+      The snapshot is written to a temporary file that is then renamed,
+      so that a crash while saving does not destroy the previous snapshot.
+
+      @return true if the snapshot was written successfully
+   */
+   bool save(const char *fileName);
+
+   size_t size() const { return _map.size(); }
+   void printStats();
+
+   private:
+   struct Entry
+      {
+      TR_PERSISTENT_ALLOC(TR_Memory::PersistentInfo)
+      Entry(J9ROMClass *romClass, uint32_t size, uint64_t hash, bool fromSnapshot) :
+         _romClass(romClass), _size(size), _hash(hash), _refCount(0), _fromSnapshot(fromSnapshot) {}
+
+      J9ROMClass *_romClass;
+      uint32_t _size; // size of the packed ROM class, which is larger than romSize (see packROMClass())
+      uint64_t _hash;
+      uint32_t _refCount;
+      bool _fromSnapshot; // loaded from a snapshot and not referenced by any client yet
+      };
+
+   // Header of the snapshot file; entries follow, each as a SnapshotEntryHeader
+   // and the ROM class bytes padded to a multiple of 8 bytes
+   struct SnapshotHeader
+      {
+      uint32_t _magic;
+      uint32_t _numEntries;
+      uint64_t _fullVersion; // JITServer version and configuration flags of the writer
+      };
+
+   struct SnapshotEntryHeader
+      {
+      uint64_t _hash;
+      uint32_t _size;
+      uint32_t _padding;
+      };
+
+   static const uint32_t SNAPSHOT_MAGIC = 0x4A535243; // "JSRC"
+
+   static J9ROMClass *copyROMClass(const void *data, size_t size);
+   void freeEntry(Entry *entry);
+   static size_t paddedEntrySize(size_t size) { return (size + sizeof(uint64_t) - 1) & ~(sizeof(uint64_t) - 1); }
+
+   PersistentUnorderedMap<uint64_t, Entry *> _map;
+   PersistentUnorderedMap<J9ROMClass *, Entry *> _entriesByROMClass; // used by release()
+   TR::Monitor *_monitor;
+   int64_t _snapshotLoadTimeMs; // 0 if no snapshot is loaded or its unused entries were purged
+   // Statistics
+   uint32_t _numHits;
+   uint32_t _numMisses;
+   uint32_t _numHashCollisions;
+   uint32_t _numLoadedFromSnapshot;
+   uint32_t _numPurgedFromSnapshot;
+   }; // class JITServerROMClassCache
+
+#endif /* defined(JITSERVER_ROMCLASSCACHE_H) */
@@ -22,6 +22,7 @@
 
 #include "runtime/JITServerStatisticsThread.hpp"
 #include "runtime/JITClientSession.hpp" // for purgeOldDataIfNeeded()
+#include "runtime/JITServerMetrics.hpp"
 #include "env/VMJ9.h" // for TR_JitPrivateConfig
 #include "env/VerboseLog.hpp"
 #include "control/CompilationRuntime.hpp" // for CompilatonInfo
@@ -75,6 +76,8 @@ static int32_t J9THREAD_PROC statisticsThreadProc(void * entryarg)
    uint64_t crtTime = j9time_current_time_millis();
    uint64_t lastStatsTime = crtTime;
    uint64_t lastPurgeTime = crtTime;
+   uint64_t lastMetricsTime = crtTime;
+   JITServerMetrics *metrics = compInfo->getJITServerMetrics();
 
    persistentInfo->setStartTime(crtTime);
    persistentInfo->setElapsedTime(0);
@@ -98,6 +101,15 @@ static int32_t J9THREAD_PROC statisticsThreadProc(void * entryarg)
             compInfo->getClientSessionHT()->purgeOldDataIfNeeded();
             }
 
+         // Every 1000 ms refresh the metrics file if metrics are enabled
+         if (metrics && (crtTime - lastMetricsTime >= 1000))
+            {
+            lastMetricsTime = crtTime;
+            if (!metrics->writeToFile(persistentInfo->getJITServerMetricsFile().c_str(), compInfo) &&
+                TR::Options::getVerboseOption(TR_VerboseJITServer))
+               TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Failed to write metrics file %s", persistentInfo->getJITServerMetricsFile().c_str());
+            }
+
          // Print operational statistics to vlog if enabled
          if ((statsThreadObj->getStatisticsFrequency() != 0) && ((crtTime - lastStatsTime) > statsThreadObj->getStatisticsFrequency()))
             {
@@ -28,6 +28,7 @@
 #include <netinet/tcp.h>	/* for TCP_NODELAY option */
 #include <openssl/err.h>
 #include <poll.h>
+#include <sys/epoll.h>
 #include <sys/types.h>
 #include <sys/socket.h>
 #include <sys/un.h>
@@ -35,13 +36,16 @@
 #include <stdlib.h>
 #include <unistd.h> /// gethostname, read, write
 #include "control/CompilationRuntime.hpp"
+#include "env/CompilerEnv.hpp"
 #include "env/TRMemory.hpp"
 #include "env/VMJ9.h"
 #include "env/VerboseLog.hpp"
+#include "infra/CriticalSection.hpp"
 #include "net/CommunicationStream.hpp"
 #include "net/LoadSSLLibs.hpp"
 #include "net/ServerStream.hpp"
 #include "runtime/CompileService.hpp"
+#include "runtime/JITServerMetrics.hpp"
 #include "runtime/Listener.hpp"
 
 static SSL_CTX *
@@ -186,10 +190,127 @@ acceptOpenSSLConnection(SSL_CTX *sslCtx, int connfd, BIO *&bio)
 
 TR_Listener::TR_Listener()
    : _listenerThread(NULL), _listenerMonitor(NULL), _listenerOSThread(NULL),
-   _listenerThreadAttachAttempted(false), _listenerThreadExitFlag(false)
+   _listenerThreadAttachAttempted(false), _listenerThreadExitFlag(false), _epollfd(-1),
+   _idleStreamsMonitor(TR::Monitor::create("JITServer-ListenerIdleStreamsMonitor")),
+   _idleStreams(decltype(_idleStreams)::allocator_type(TR::Compiler->persistentAllocator()))
    {
    }
 
+uint64_t
+TR_Listener::getTimeMs()
+   {
+   return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+   }
+
+void
+TR_Listener::acceptConnections(int sockfd, SSL_CTX *sslCtx, uint32_t timeoutMs, BaseCompileDispatcher *compiler)
+   {
+   struct sockaddr_in cli_addr;
+   socklen_t clilen = sizeof(cli_addr);
+   int connfd = -1;
+   do
+      {
+      /* at this stage we should have a valid request for new connection */
+      connfd = accept(sockfd, (struct sockaddr *)&cli_addr, &clilen);
+      if (connfd < 0)
+         {
+         if ((EAGAIN != errno) && (EWOULDBLOCK != errno))
+            {
+            if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+               {
+               TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Error accepting connection: errno=%d", errno);
+               }
+            }
+         }
+      else
+         {
+         struct timeval timeoutMsForConnection = {(timeoutMs / 1000), ((timeoutMs % 1000) * 1000)};
+         if (setsockopt(connfd, SOL_SOCKET, SO_RCVTIMEO, (void *)&timeoutMsForConnection, sizeof(timeoutMsForConnection)) < 0)
+            {
+            perror("Can't set option SO_RCVTIMEO on connfd socket");
+            exit(-1);
+            }
+         if (setsockopt(connfd, SOL_SOCKET, SO_SNDTIMEO, (void *)&timeoutMsForConnection, sizeof(timeoutMsForConnection)) < 0)
+            {
+            perror("Can't set option SO_SNDTIMEO on connfd socket");
+            exit(-1);
+            }
+
+         BIO *bio = NULL;
+         if (sslCtx && !acceptOpenSSLConnection(sslCtx, connfd, bio))
+            continue;
+
+         JITServer::ServerStream *stream = new (PERSISTENT_NEW) JITServer::ServerStream(connfd, bio);
+         // A client that connected but did not send its request yet must not pin a compilation thread
+         if (!waitForNextRequest(stream))
+            compiler->compile(stream);
+         }
+      } while ((-1 != connfd) && !getListenerThreadExitFlag());
+   }
+
+bool
+TR_Listener::waitForNextRequest(JITServer::ServerStream *stream)
+   {
+   OMR::CriticalSection idleStreams(_idleStreamsMonitor);
+   if (_epollfd < 0) // event-driven I/O not used, or the listener is shutting down
+      return false;
+
+   // Insert before adding to the epoll set: the listener may receive an event for
+   // the stream as soon as epoll_ctl() returns, but it has to wait for the monitor
+   _idleStreams[stream] = getTimeMs();
+
+   // EPOLLONESHOT guarantees that the stream is dispatched only once; the listener
+   // removes it from the epoll set before handing it to a compilation thread
+   struct epoll_event event = {0};
+   event.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+   event.data.ptr = stream;
+   if (epoll_ctl(_epollfd, EPOLL_CTL_ADD, stream->getConnFD(), &event) < 0)
+      {
+      if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+         TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Error adding stream %p to the epoll set: errno=%d", stream, errno);
+      _idleStreams.erase(stream);
+      return false;
+      }
+   return true;
+   }
+
+bool
+TR_Listener::removeIdleStream(JITServer::ServerStream *stream)
+   {
+   if (_idleStreams.erase(stream) == 0)
+      return false;
+   epoll_ctl(_epollfd, EPOLL_CTL_DEL, stream->getConnFD(), NULL);
+   return true;
+   }
+
+void
+TR_Listener::closeStream(JITServer::ServerStream *stream)
+   {
+   stream->~ServerStream();
+   TR_Memory::jitPersistentFree(stream);
+   }
+
+void
+TR_Listener::closeIdleStreams(uint64_t idleTimeoutMs)
+   {
+   uint64_t now = getTimeMs();
+   OMR::CriticalSection idleStreams(_idleStreamsMonitor);
+   for (auto it = _idleStreams.begin(); it != _idleStreams.end();)
+      {
+      JITServer::ServerStream *stream = it->first;
+      if (now - it->second < idleTimeoutMs)
+         {
+         ++it;
+         continue;
+         }
+      if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+         TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Closing stream %p idle for %llu ms", stream, (unsigned long long)(now - it->second));
+      it = _idleStreams.erase(it);
+      epoll_ctl(_epollfd, EPOLL_CTL_DEL, stream->getConnFD(), NULL);
+      closeStream(stream);
+      }
+   }
+
 void
 TR_Listener::serveRemoteCompilationRequests(BaseCompileDispatcher *compiler)
    {
@@ -241,17 +362,88 @@ TR_Listener::serveRemoteCompilationRequests(BaseCompileDispatcher *compiler)
       exit(1);
       }
 
+   if (info->getJITServerUseEventDrivenIO())
+      {
+      _epollfd = epoll_create1(EPOLL_CLOEXEC);
+      if (_epollfd < 0)
+         {
+         perror("can't create epoll instance");
+         exit(1);
+         }
+      // The listening socket is identified by a NULL pointer, client streams by their address
+      struct epoll_event event = {0};
+      event.events = EPOLLIN;
+      event.data.ptr = NULL;
+      if (epoll_ctl(_epollfd, EPOLL_CTL_ADD, sockfd, &event) < 0)
+         {
+         perror("can't add server socket to the epoll set");
+         exit(1);
+         }
+      if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+         TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Using event-driven I/O for client connections");
+      }
+
    pfd.fd = sockfd;
    pfd.events = POLLIN;
+   uint64_t lastIdleCheckMs = getTimeMs();
+   JITServerMetrics *metrics = getCompilationInfo(jitConfig)->getJITServerMetrics();
 
    while (!getListenerThreadExitFlag())
       {
-      int32_t rc = 0;
-      struct sockaddr_in cli_addr;
-      socklen_t clilen = sizeof(cli_addr);
-      int connfd = -1;
+      if (_epollfd >= 0)
+         {
+         struct epoll_event events[OPENJ9_LISTENER_MAX_EPOLL_EVENTS];
+         int32_t numEvents = epoll_wait(_epollfd, events, OPENJ9_LISTENER_MAX_EPOLL_EVENTS, OPENJ9_LISTENER_POLL_TIMEOUT);
+         if (getListenerThreadExitFlag()) // if we are exiting, no need to check epoll_wait() status
+            break;
+         if (numEvents < 0)
+            {
+            if (errno == EINTR)
+               continue;
+            perror("error in epoll_wait");
+            exit(1);
+            }
+
+         for (int32_t i = 0; i < numEvents; ++i)
+            {
+            JITServer::ServerStream *stream = static_cast<JITServer::ServerStream *>(events[i].data.ptr);
+            if (!stream)
+               {
+               acceptConnections(sockfd, sslCtx, timeoutMs, compiler);
+               }
+            else
+               {
+               // The client sent its next request or closed the connection; either way a
+               // compilation thread must now process the stream. Errors surface as
+               // StreamFailure exceptions on the compilation thread, which closes the stream.
+               // A stream that was just closed for being idle is no longer in the set.
+               bool wasIdle = false;
+                  {
+                  OMR::CriticalSection idleStreams(_idleStreamsMonitor);
+                  wasIdle = removeIdleStream(stream);
+                  }
+               if (wasIdle)
+                  {
+                  if (metrics)
+                     stream->setRequestReceivedTimeUs(JITServerMetrics::getTimeUs());
+                  compiler->compile(stream);
+                  }
+               }
+            }
+
+         // Close connections whose clients went silent; without event-driven I/O the read
+         // of a compilation thread waiting for the next request times out after the same delay
+         // (a timeout of 0 means that reads never time out)
+         uint64_t now = getTimeMs();
+         if ((timeoutMs > 0) && (now - lastIdleCheckMs >= OPENJ9_LISTENER_IDLE_CHECK_INTERVAL))
+            {
+            closeIdleStreams(timeoutMs);
+            lastIdleCheckMs = now;
+            }
+         continue;
+         }
 
-      rc = poll(&pfd, 1, OPENJ9_LISTENER_POLL_TIMEOUT);
+      int32_t rc = poll(&pfd, 1, OPENJ9_LISTENER_POLL_TIMEOUT);
       if (getListenerThreadExitFlag()) // if we are exiting, no need to check poll() status
          {
          break;
@@ -277,45 +469,21 @@ TR_Listener::serveRemoteCompilationRequests(BaseCompileDispatcher *compiler)
          fprintf(stderr, "Unexpected event occurred during poll for new connection: revents=%d\n", pfd.revents);
          exit(1);
          }
-      do
-         {
-         /* at this stage we should have a valid request for new connection */
-         connfd = accept(sockfd, (struct sockaddr *)&cli_addr, &clilen);
-         if (connfd < 0)
-            {
-            if ((EAGAIN != errno) && (EWOULDBLOCK != errno))
-               {
-               if (TR::Options::getVerboseOption(TR_VerboseJITServer))
-                  {
-                  TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Error accepting connection: errno=%d", errno);
-                  }
-               }
-            }
-         else
-            {
-            struct timeval timeoutMsForConnection = {(timeoutMs / 1000), ((timeoutMs % 1000) * 1000)};
-            if (setsockopt(connfd, SOL_SOCKET, SO_RCVTIMEO, (void *)&timeoutMsForConnection, sizeof(timeoutMsForConnection)) < 0)
-               {
-               perror("Can't set option SO_RCVTIMEO on connfd socket");
-               exit(-1);
-               }
-            if (setsockopt(connfd, SOL_SOCKET, SO_SNDTIMEO, (void *)&timeoutMsForConnection, sizeof(timeoutMsForConnection)) < 0)
-               {
-               perror("Can't set option SO_SNDTIMEO on connfd socket");
-               exit(-1);
-               }
-
-            BIO *bio = NULL;
-            if (sslCtx && !acceptOpenSSLConnection(sslCtx, connfd, bio))
-               continue;
-
-            JITServer::ServerStream *stream = new (PERSISTENT_NEW) JITServer::ServerStream(connfd, bio);
-            compiler->compile(stream);
-            }
-         } while ((-1 != connfd) && !getListenerThreadExitFlag());
+      acceptConnections(sockfd, sslCtx, timeoutMs, compiler);
       }
 
    // The following piece of code will be executed only if the server shuts down properly
+   if (_epollfd >= 0)
+      {
+      // Close the connections of clients that are waiting between requests. After _epollfd
+      // is reset, compilation threads that finish a request queue their streams as usual.
+      OMR::CriticalSection idleStreams(_idleStreamsMonitor);
+      for (auto &it : _idleStreams)
+         closeStream(it.first);
+      _idleStreams.clear();
+      close(_epollfd);
+      _epollfd = -1;
+      }
    if (sslCtx)
       {
       (*OSSL_CTX_free)(sslCtx);
@@ -25,6 +25,7 @@
 
 #include "j9.h"
 #include "infra/Monitor.hpp"  // TR::Monitor
+#include "env/PersistentCollections.hpp" // for PersistentUnorderedMap
 #include "net/ServerStream.hpp"
 
  /**
@@ -38,6 +39,8 @@
  */
 
 #define OPENJ9_LISTENER_POLL_TIMEOUT 100 // in milliseconds
+#define OPENJ9_LISTENER_MAX_EPOLL_EVENTS 64
+#define OPENJ9_LISTENER_IDLE_CHECK_INTERVAL 1000 // in milliseconds
 
 class BaseCompileDispatcher;
 
@@ -62,9 +65,29 @@ public:
       returns immediately so that other connection requests can be accepted.
       Note: it must be executed on a separate thread as it needs to keep listening for new connections.
 
+      With -XX:+JITServerUseEventDrivenIO the listening socket and all idle client connections
+      are multiplexed with epoll, and a stream is handed to the compilation handler only
+      once its client has sent data (see waitForNextRequest()). Connections that stay idle
+      for longer than the socket timeout (-XX:JITServerTimeout) are closed, as they would be
+      if a compilation thread was blocked reading from them. Connections still idle when the
+      server shuts down are closed as well.
+
       @param [in] compiler Object that defines the behavior when a new connection is accepted
    */
    void serveRemoteCompilationRequests(BaseCompileDispatcher *compiler);
+
+   /**
+      @brief Ask the listener thread to watch an idle connection for the next compilation request
+
+      Called by a compilation thread that finished serving a request on this stream.
+      Instead of having a compilation thread block in a read until the client sends its next
+      request, the stream is added to the epoll set of the listener, which will pass it to the
+      compilation handler once data is available.
+
+      @return true if the stream is now owned by the listener, false if event-driven I/O
+      is not in use and the caller must queue the stream itself
+   */
+   bool waitForNextRequest(JITServer::ServerStream *stream);
    int32_t waitForListenerThreadExit(J9JavaVM *javaVM);
    void setAttachAttempted(bool b) { _listenerThreadAttachAttempted = b; }
    bool getAttachAttempted() const { return _listenerThreadAttachAttempted; }
@@ -78,11 +101,25 @@ public:
    void setListenerThreadExitFlag() { _listenerThreadExitFlag = true; }
 
 private:
+   void acceptConnections(int sockfd, SSL_CTX *sslCtx, uint32_t timeoutMs, BaseCompileDispatcher *compiler);
+   /**
+      @brief Remove a stream from the epoll set and from the idle streams
+      @return true if the stream was idle, false if it was already removed
+      Must be called with _idleStreamsMonitor held.
+   */
+   bool removeIdleStream(JITServer::ServerStream *stream);
+   static void closeStream(JITServer::ServerStream *stream);
+   void closeIdleStreams(uint64_t idleTimeoutMs);
+   static uint64_t getTimeMs();
+
    J9VMThread *_listenerThread;
    TR::Monitor *_listenerMonitor;
    j9thread_t _listenerOSThread;
    volatile bool _listenerThreadAttachAttempted;
    volatile bool _listenerThreadExitFlag;
+   int _epollfd; // -1 unless event-driven I/O is used
+   TR::Monitor *_idleStreamsMonitor; // protects _epollfd and _idleStreams
+   PersistentUnorderedMap<JITServer::ServerStream *, uint64_t> _idleStreams; // streams in the epoll set -> time (ms) they became idle
    };
 
 /**
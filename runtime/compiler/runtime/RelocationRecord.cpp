@@ -143,7 +143,7 @@ TR_RelocationRecordGroup::applyRelocations(TR_RelocationRuntime *reloRuntime,
       TR::SymbolValidationManager *svm =
          reloRuntime->comp()->getSymbolValidationManager();
 
-      if (!svm->validateWellKnownClasses(wkClassChainOffsets))
+      if (!svm->validateWellKnownClasses(wkClassChainOffsets, reloRuntime->validatedWellKnownClasses()))
          {
          if (aotStats)
             aotStats->numWellKnownClassesValidationsFailed++;
@@ -1027,6 +1027,24 @@ TR_SharedCacheRelocationRuntime::getProcessorDescriptionFromSCC(TR_FrontEnd *fe,
    return hdrInCache->processorDescription;
    }
 
+uint64_t
+TR_SharedCacheRelocationRuntime::getSharedCacheUniqueIdFromSCC(TR_FrontEnd *fe, J9VMThread *curThread)
+   {
+   J9SharedDataDescriptor firstDescriptor;
+   firstDescriptor.address = NULL;
+   javaVM()->sharedClassConfig->findSharedData(curThread,
+                                             aotHeaderKey,
+                                             aotHeaderKeyLength,
+                                             J9SHR_DATA_TYPE_AOTHEADER,
+                                             FALSE,
+                                             &firstDescriptor,
+                                             NULL);
+
+   // 0 means that the SCC cannot be identified
+   const void* result = firstDescriptor.address;
+   return result ? ((TR_AOTHeader *)result)->sharedCacheUniqueId : 0;
+   }
+
 static void setAOTHeaderInvalid(TR_JitPrivateConfig *privateConfig)
    {
    TR::Options::getAOTCmdLineOptions()->setOption(TR_NoStoreAOT);
@@ -1191,6 +1209,13 @@ TR_SharedCacheRelocationRuntime::createAOTHeader(TR_FrontEnd *fe)
 
       // Set ArrayLet Size if supported
       aotHeader->arrayLetLeafSize = TR::Compiler->om.arrayletLeafSize();
+
+      // The header is stored once per SCC, so an ID made unique in time and across
+      // processes identifies the SCC (e.g. for sharing AOT bodies between JITServer clients)
+      uint64_t uniqueId = ((uint64_t)j9time_current_time_millis() << 20) ^
+                          (uint64_t)j9time_nano_time() ^
+                          ((uint64_t)j9sysinfo_get_pid() << 44);
+      aotHeader->sharedCacheUniqueId = uniqueId ? uniqueId : 1;
       }
 
    return aotHeader;
@@ -31,6 +31,7 @@
 #include "runtime/HWProfiler.hpp"
 #include "env/VMJ9.h"
 #include "env/J9CPU.hpp"
+#include "runtime/SymbolValidationManager.hpp"
 
 namespace TR { class CompilationInfo; }
 class TR_RelocationRecord;
@@ -57,7 +58,7 @@ extern "C" {
  */
 
 #define TR_AOTHeaderMajorVersion 6
-#define TR_AOTHeaderMinorVersion 0
+#define TR_AOTHeaderMinorVersion 1
 #define TR_AOTHeaderEyeCatcher   0xA0757A27
 
 /* AOT Header Flags */
@@ -105,6 +106,7 @@ typedef struct TR_AOTHeader {
     uint32_t lockwordOptionHashValue;
     int32_t   arrayLetLeafSize;
     OMRProcessorDesc processorDescription;
+    uint64_t sharedCacheUniqueId; // generated when the header is created, identifies the SCC the header was stored in
 } TR_AOTHeader;
 
 typedef struct TR_AOTRuntimeInfo {
@@ -170,6 +172,8 @@ class TR_RelocationRuntime {
 
       TR::PersistentInfo *getPersistentInfo()                      { return comp()->getPersistentInfo(); }
 
+      TR::SymbolValidationManager::ValidatedWellKnownClasses *validatedWellKnownClasses() { return &_validatedWellKnownClasses; }
+
       // current main entry point
       J9JITExceptionTable *prepareRelocateAOTCodeAndData(J9VMThread* vmThread,
                                                          TR_FrontEnd *fe,
@@ -186,6 +190,7 @@ class TR_RelocationRuntime {
       virtual TR_AOTHeader *createAOTHeader(TR_FrontEnd *fe);
       virtual bool validateAOTHeader(TR_FrontEnd *fe, J9VMThread *curThread);
       virtual OMRProcessorDesc getProcessorDescriptionFromSCC(TR_FrontEnd *fe, J9VMThread *curThread) { TR_ASSERT_FATAL(0, "Error: getProcessorDescriptionFromSCC not supported in this relocation runtime"); return OMRProcessorDesc();}
+      virtual uint64_t getSharedCacheUniqueIdFromSCC(TR_FrontEnd *fe, J9VMThread *curThread) { TR_ASSERT_FATAL(0, "Error: getSharedCacheUniqueIdFromSCC not supported in this relocation runtime"); return 0;}
 
       static uintptr_t    getGlobalValue(uint32_t g)
          {
@@ -331,6 +336,10 @@ class TR_RelocationRuntime {
 
       bool _isLoading;
 
+      // Well-known classes found by the last AOT load on this thread; reused by
+      // the loads of other methods that were stored with the same set
+      TR::SymbolValidationManager::ValidatedWellKnownClasses _validatedWellKnownClasses;
+
 #if 1 // defined(DEBUG) || defined(PROD_WITH_ASSUMES)
       // Detect unexpected scenarios when build has assumes
       uint32_t _numValidations;
@@ -354,6 +363,7 @@ public:
       virtual TR_AOTHeader *createAOTHeader(TR_FrontEnd *fe);
       virtual bool validateAOTHeader(TR_FrontEnd *fe, J9VMThread *curThread);
       virtual OMRProcessorDesc getProcessorDescriptionFromSCC(TR_FrontEnd *fe, J9VMThread *curThread);
+      virtual uint64_t getSharedCacheUniqueIdFromSCC(TR_FrontEnd *fe, J9VMThread *curThread);
 
 private:
       uint32_t getCurrentLockwordOptionHashValue(J9JavaVM *vm) const;
@@ -387,6 +397,7 @@ public:
       virtual TR_AOTHeader *createAOTHeader(TR_FrontEnd *fe)  override { TR_ASSERT_FATAL(0, "Should not be called in this RelocationRuntime!"); return 0;}
       virtual bool validateAOTHeader(TR_FrontEnd *fe, J9VMThread *curThread)  override { TR_ASSERT_FATAL(0, "Should not be called in this RelocationRuntime!"); return 0;}
       virtual OMRProcessorDesc getProcessorDescriptionFromSCC(TR_FrontEnd *fe, J9VMThread *curThread) override { TR_ASSERT_FATAL(0, "Should not be called in this RelocationRuntime!"); return OMRProcessorDesc(); }
+      virtual uint64_t getSharedCacheUniqueIdFromSCC(TR_FrontEnd *fe, J9VMThread *curThread) override { TR_ASSERT_FATAL(0, "Should not be called in this RelocationRuntime!"); return 0; }
 
       static uint8_t *copyDataToCodeCache(const void *startAddress, size_t totalSize, TR_J9VMBase *fe);
 
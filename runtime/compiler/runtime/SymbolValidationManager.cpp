@@ -311,30 +311,54 @@ TR::SymbolValidationManager::populateWellKnownClasses()
    }
 
 bool
-TR::SymbolValidationManager::validateWellKnownClasses(const uintptr_t *wellKnownClassChainOffsets)
+TR::SymbolValidationManager::validateWellKnownClasses(const uintptr_t *wellKnownClassChainOffsets, ValidatedWellKnownClasses *validated)
    {
    // We may have already run populateWellKnownClasses on this
    // SymbolValidationManager, if there was no delay before processing the
    // relocations, in which case the Compilation is reused.
    bool assignNewIDs = _wellKnownClassChainOffsets == NULL;
    int classCount = static_cast<int>(wellKnownClassChainOffsets[0]);
+
+   // The well-known classes are loaded by the bootstrap loader and are never
+   // unloaded, so a previous validation of the same list holds until a class
+   // is redefined
+   int32_t classRedefinitionID = _comp->getPersistentInfo()->getGlobalClassRedefinitionID();
+   bool useValidated = validated
+      && validated->_classChainOffsets == wellKnownClassChainOffsets
+      && validated->_classRedefinitionID == classRedefinitionID
+      && validated->_classCount == classCount;
+   bool recordValidated = validated && !useValidated && classCount <= WELL_KNOWN_CLASS_COUNT;
+   if (recordValidated)
+      validated->_classChainOffsets = NULL;
+
    for (int i = 1; i <= classCount; i++)
       {
-      uintptr_t classChainOffset = wellKnownClassChainOffsets[i];
-      uintptr_t *classChain = reinterpret_cast<uintptr_t*>(
-         _fej9->sharedCache()->pointerFromOffsetInSharedCache(classChainOffset));
-      J9ROMClass *romClass = _fej9->sharedCache()->startingROMClassOfClassChain(classChain);
-      J9UTF8 * className = J9ROMCLASS_CLASSNAME(romClass);
+      TR_OpaqueClassBlock *clazz = NULL;
+      if (useValidated)
+         {
+         clazz = validated->_classes[i - 1];
+         }
+      else
+         {
+         uintptr_t classChainOffset = wellKnownClassChainOffsets[i];
+         uintptr_t *classChain = reinterpret_cast<uintptr_t*>(
+            _fej9->sharedCache()->pointerFromOffsetInSharedCache(classChainOffset));
+         J9ROMClass *romClass = _fej9->sharedCache()->startingROMClassOfClassChain(classChain);
+         J9UTF8 * className = J9ROMCLASS_CLASSNAME(romClass);
 
-      TR_OpaqueClassBlock *clazz = _fej9->getSystemClassFromClassName(
-         reinterpret_cast<const char *>(J9UTF8_DATA(className)),
-         J9UTF8_LENGTH(className));
+         clazz = _fej9->getSystemClassFromClassName(
+            reinterpret_cast<const char *>(J9UTF8_DATA(className)),
+            J9UTF8_LENGTH(className));
 
-      if (clazz == NULL)
-         return false;
+         if (clazz == NULL)
+            return false;
 
-      if (!_fej9->sharedCache()->classMatchesCachedVersion(clazz, classChain))
-         return false;
+         if (!_fej9->sharedCache()->classMatchesCachedVersion(clazz, classChain))
+            return false;
+
+         if (recordValidated)
+            validated->_classes[i - 1] = clazz;
+         }
 
       _seenSymbolsSet.insert(clazz);
       if (assignNewIDs)
@@ -345,6 +369,13 @@ TR::SymbolValidationManager::validateWellKnownClasses(const uintptr_t *wellKnown
          }
       }
 
+   if (recordValidated)
+      {
+      validated->_classCount = classCount;
+      validated->_classRedefinitionID = classRedefinitionID;
+      validated->_classChainOffsets = wellKnownClassChainOffsets;
+      }
+
    // These classes are definitely visible to any other class defined by the
    // bootstrap loader.
    _loadersOkForWellKnownClasses.push_back(TR::Compiler->javaVM->systemClassLoader);
@@ -648,8 +648,27 @@ public:
 
    #define WELL_KNOWN_CLASS_COUNT 9
 
+   /**
+    * @brief Well-known classes resolved by a previous successful validation
+    *
+    * AOT bodies stored with the same set of well-known classes share one list of
+    * class chain offsets in the SCC. A relocation runtime keeps the classes it found
+    * for the last list it validated, so that subsequent loads skip the lookups by
+    * name and the class chain comparisons. The entry is stale once any class has
+    * been redefined.
+    */
+   struct ValidatedWellKnownClasses
+      {
+      ValidatedWellKnownClasses() : _classChainOffsets(NULL), _classRedefinitionID(-1), _classCount(0) {}
+
+      const uintptr_t *_classChainOffsets;
+      int32_t _classRedefinitionID;
+      int32_t _classCount;
+      TR_OpaqueClassBlock *_classes[WELL_KNOWN_CLASS_COUNT];
+      };
+
    void populateWellKnownClasses();
-   bool validateWellKnownClasses(const uintptr_t *wellKnownClassChainOffsets);
+   bool validateWellKnownClasses(const uintptr_t *wellKnownClassChainOffsets, ValidatedWellKnownClasses *validated = NULL);
    bool isWellKnownClass(TR_OpaqueClassBlock *clazz);
    bool classCanSeeWellKnownClasses(TR_OpaqueClassBlock *clazz);
    const void *wellKnownClassChainOffsets() { return _wellKnownClassChainOffsets; }
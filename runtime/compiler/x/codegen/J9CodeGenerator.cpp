@@ -119,6 +119,66 @@ J9::X86::CodeGenerator::initialize()
       cg->setSupportsInlineStringHashCode();
       }
 
+   // Vector API expansion addresses array elements by raw offset, so it needs
+   // contiguous arrays. SSE4.1 provides the packed integer multiplies.
+   if (comp->target().cpu.supportsFeature(OMR_FEATURE_X86_SSE4_1) &&
+       !TR::Compiler->om.canGenerateArraylets())
+      {
+      cg->setSupportsInlineVectorAPI();
+      }
+
+   // Auto-vectorization of counted array loops by SPMDKernelParallelization.
+   // The vector IL is 128 bits wide and maps onto the SSE vector evaluators;
+   // which opcodes and element types are vectorized is further decided per
+   // opcode by getSupportsOpCodeForAutoSIMD.
+   static bool disableX86AutoSIMD = feGetEnv("TR_disableX86AutoSIMD") != NULL;
+   if (comp->target().cpu.supportsFeature(OMR_FEATURE_X86_SSE4_1) &&
+       !disableX86AutoSIMD &&
+       !comp->getOption(TR_DisableSIMD) &&
+       !TR::Compiler->om.canGenerateArraylets())
+      {
+      cg->setSupportsAutoSIMD();
+      }
+
+   // CRC32C, Base64 and the AES/GHASH block primitives are evaluated as calls
+   // to AMD64 routines that address array elements directly. The routines are
+   // called at their absolute address, so relocatable code cannot use them.
+   static bool disableCryptoIntrinsics = feGetEnv("TR_disableX86CryptoIntrinsics") != NULL;
+   if (comp->target().is64Bit() &&
+       !disableCryptoIntrinsics &&
+       !comp->compileRelocatableCode() &&
+       !comp->isOutOfProcessCompilation() &&
+       !TR::Compiler->om.canGenerateArraylets())
+      {
+      if (comp->target().cpu.supportsFeature(OMR_FEATURE_X86_SSE4_2))
+         cg->setSupportsInlineCRC32C();
+
+      if (comp->target().cpu.supportsFeature(OMR_FEATURE_X86_SSSE3))
+         cg->setSupportsInlineBase64Encode();
+
+      if (comp->target().cpu.supportsFeature(OMR_FEATURE_X86_AESNI) &&
+          comp->target().cpu.supportsFeature(OMR_FEATURE_X86_SSSE3))
+         cg->setSupportsInlineAESBlock();
+
+      if (comp->target().cpu.supportsFeature(OMR_FEATURE_X86_PCLMULQDQ) &&
+          comp->target().cpu.supportsFeature(OMR_FEATURE_X86_SSSE3))
+         cg->setSupportsInlineGHASH();
+      }
+
+   // String compare and hasNegatives are SSE2 routines called at their absolute address,
+   // so relocatable code cannot use them; substring indexOf shares the
+   // SupportsInlineStringIndexOf flag set above and checks this when it is evaluated
+   static bool disableStringCompare = feGetEnv("TR_disableInlineStringCompare") != NULL;
+   if (comp->target().is64Bit() &&
+       !disableStringCompare &&
+       !comp->compileRelocatableCode() &&
+       !comp->isOutOfProcessCompilation() &&
+       !TR::Compiler->om.canGenerateArraylets())
+      {
+      cg->setSupportsInlineStringCompare();
+      cg->setSupportsInlineHasNegatives();
+      }
+
    if (comp->generateArraylets() && !comp->getOptions()->realTimeGC())
       {
       cg->setSupportsStackAllocationOfArraylets();
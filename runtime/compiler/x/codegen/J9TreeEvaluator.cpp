@@ -11558,6 +11558,46 @@ J9::X86::TreeEvaluator::directCallEvaluator(TR::Node *node, TR::CodeGenerator *c
       case TR::com_ibm_jit_JITHelpers_transformedEncodeUTF16Little:
          return TR::TreeEvaluator::encodeUTF16Evaluator(node, cg);
 
+      // The following are only evaluated inline once RecognizedCallTransformer
+      // has rewritten their arguments, which changes the number of children
+      case TR::java_util_zip_CRC32C_updateBytes:
+      case TR::java_util_zip_CRC32C_updateDirectByteBuffer:
+         if (cg->getSupportsInlineCRC32C() && node->getNumChildren() == 3)
+            return TR::TreeEvaluator::crc32cEvaluator(node, cg);
+         break;
+      case TR::java_util_Base64_Encoder_encodeBlock:
+         if (cg->getSupportsInlineBase64Encode() && node->getNumChildren() == 4)
+            return TR::TreeEvaluator::base64EncodeEvaluator(node, cg);
+         break;
+      case TR::com_sun_crypto_provider_AESCrypt_implEncryptBlock:
+      case TR::com_sun_crypto_provider_AESCrypt_implDecryptBlock:
+         if (cg->getSupportsInlineAESBlock() && node->getNumChildren() == 4)
+            return TR::TreeEvaluator::aesCryptBlockEvaluator(node, cg);
+         break;
+      case TR::com_sun_crypto_provider_GHASH_processBlocks:
+         if (cg->getSupportsInlineGHASH() && node->getNumChildren() == 4)
+            return TR::TreeEvaluator::ghashProcessBlocksEvaluator(node, cg);
+         break;
+
+      case TR::java_lang_StringLatin1_indexOf:
+      case TR::java_lang_StringUTF16_indexOf:
+      case TR::com_ibm_jit_JITHelpers_intrinsicIndexOfStringLatin1:
+      case TR::com_ibm_jit_JITHelpers_intrinsicIndexOfStringUTF16:
+         // The helper routine is called at its absolute address, which relocatable code cannot use
+         if (cg->getSupportsInlineStringIndexOf() && cg->comp()->target().is64Bit() &&
+             !cg->comp()->compileRelocatableCode() && !cg->comp()->isOutOfProcessCompilation())
+            return TR::TreeEvaluator::stringIndexOfEvaluator(node, cg);
+         break;
+      case TR::com_ibm_jit_JITHelpers_intrinsicCompareLatin1:
+      case TR::com_ibm_jit_JITHelpers_intrinsicCompareUTF16:
+         if (cg->getSupportsInlineStringCompare())
+            return TR::TreeEvaluator::stringCompareEvaluator(node, cg);
+         break;
+      case TR::java_lang_StringCoding_hasNegatives:
+         if (cg->getSupportsInlineHasNegatives())
+            return TR::TreeEvaluator::hasNegativesEvaluator(node, cg);
+         break;
+
       case TR::java_lang_String_hashCodeImplDecompressed:
          returnRegister = inlineStringHashCode(node, false, cg);
          callInlined = (returnRegister != NULL);
@@ -11787,6 +11827,345 @@ J9::X86::TreeEvaluator::encodeUTF16Evaluator(TR::Node *node, TR::CodeGenerator *
    }
 
 
+#ifdef TR_TARGET_64BIT
+// AMD64 intrinsic routines from AMD64CryptoIntrinsics.nasm and AMD64StringIntrinsics.nasm.
+// They are not runtime helpers: the helper table has no entries for them, so they are
+// called directly.
+extern "C" void crc32cUpdate();
+extern "C" void base64EncodeBlock();
+extern "C" void aesEncryptBlock();
+extern "C" void aesDecryptBlock();
+extern "C" void ghashProcessBlocks();
+extern "C" void stringIndexOfLatin1();
+extern "C" void stringIndexOfUTF16();
+extern "C" void stringCompareLatin1();
+extern "C" void stringCompareUTF16();
+extern "C" void hasNegatives();
+#define AMD64_INTRINSIC_ROUTINE(name) ((void *)(name))
+#else
+// The intrinsics are only enabled on 64-bit targets
+#define AMD64_INTRINSIC_ROUTINE(name) NULL
+#endif
+
+static const TR::RealRegister::RegNum intrinsicHelperXMMRegs[] =
+   {
+   TR::RealRegister::xmm0, TR::RealRegister::xmm1, TR::RealRegister::xmm2,  TR::RealRegister::xmm3,
+   TR::RealRegister::xmm4, TR::RealRegister::xmm5, TR::RealRegister::xmm6,  TR::RealRegister::xmm7,
+   TR::RealRegister::xmm8, TR::RealRegister::xmm9, TR::RealRegister::xmm10, TR::RealRegister::xmm11
+   };
+
+/**
+ * \brief
+ *    Generates a call to an AMD64 intrinsic routine with the arguments already in registers
+ *
+ *    The routine is called through r11 at its absolute address, which cannot be relocated.
+ *    The intrinsics are therefore not enabled for AOT or JITServer compilations.
+ *
+ * \param routine
+ *    The entry point of the routine
+ *
+ * \param args
+ *    The argument registers; the helper may modify them
+ *
+ * \param argRegs
+ *    The real register of each argument, in order
+ *
+ * \param gprClobbers
+ *    Additional general purpose registers killed by the helper
+ *
+ * \param fprClobberCount
+ *    The helper kills xmm0 up to xmm(fprClobberCount-1)
+ *
+ * \return
+ *    The result register (eax), or NULL if \p node has no value
+ */
+static TR::Register *
+generateIntrinsicHelperCall(TR::Node *node,
+                            void *routine,
+                            TR::Register **args,
+                            const TR::RealRegister::RegNum *argRegs,
+                            int32_t argCount,
+                            const TR::RealRegister::RegNum *gprClobbers,
+                            int32_t gprClobberCount,
+                            int32_t fprClobberCount,
+                            TR::CodeGenerator *cg)
+   {
+   const int32_t maxGprClobberCount = 5;
+   const int32_t maxFprClobberCount = sizeof(intrinsicHelperXMMRegs) / sizeof(intrinsicHelperXMMRegs[0]);
+   TR_ASSERT_FATAL(gprClobberCount <= maxGprClobberCount && fprClobberCount <= maxFprClobberCount,
+                   "Too many registers for intrinsic helper call n%dn", node->getGlobalIndex());
+
+   TR_ASSERT_FATAL(routine && !cg->comp()->compileRelocatableCode() && !cg->comp()->isOutOfProcessCompilation(),
+                   "Intrinsic routine for n%dn cannot be called from relocatable code", node->getGlobalIndex());
+
+   TR::Register *resultReg = node->getDataType() != TR::NoType ? cg->allocateRegister() : NULL;
+   TR::Register *targetReg = cg->allocateRegister();
+   TR::Register *gprs[maxGprClobberCount];
+   TR::Register *fprs[maxFprClobberCount];
+   for (int32_t i = 0; i < gprClobberCount; i++)
+      gprs[i] = cg->allocateRegister();
+   for (int32_t i = 0; i < fprClobberCount; i++)
+      fprs[i] = cg->allocateRegister(TR_FPR);
+
+   int32_t depCount = argCount + (resultReg ? 1 : 0) + 1 + gprClobberCount + fprClobberCount;
+   TR::RegisterDependencyConditions *deps = generateRegisterDependencyConditions((uint8_t)0, depCount, cg);
+   for (int32_t i = 0; i < argCount; i++)
+      deps->addPostCondition(args[i], argRegs[i], cg);
+   deps->addPostCondition(targetReg, TR::RealRegister::r11, cg);
+   if (resultReg)
+      deps->addPostCondition(resultReg, TR::RealRegister::eax, cg);
+   for (int32_t i = 0; i < gprClobberCount; i++)
+      deps->addPostCondition(gprs[i], gprClobbers[i], cg);
+   for (int32_t i = 0; i < fprClobberCount; i++)
+      deps->addPostCondition(fprs[i], intrinsicHelperXMMRegs[i], cg);
+   deps->stopAddingConditions();
+
+   // The routine may not be reachable with a relative call from the code cache
+   generateRegImm64Instruction(MOV8RegImm64, node, targetReg, (uint64_t)(uintptr_t)routine, cg);
+   generateRegInstruction(CALLReg, node, targetReg, deps, cg);
+
+   cg->stopUsingRegister(targetReg);
+   for (int32_t i = 0; i < gprClobberCount; i++)
+      cg->stopUsingRegister(gprs[i]);
+   for (int32_t i = 0; i < fprClobberCount; i++)
+      cg->stopUsingRegister(fprs[i]);
+
+   node->setRegister(resultReg);
+   return resultReg;
+   }
+
+/**
+ * \brief
+ *    Generates a call to an AMD64 intrinsic routine whose arguments are the children of \p node
+ *
+ * \param argRegs
+ *    The real register of each child, in order
+ *
+ * \param gprClobbers
+ *    Additional general purpose registers killed by the helper
+ *
+ * \param fprClobberCount
+ *    The helper kills xmm0 up to xmm(fprClobberCount-1)
+ *
+ * \return
+ *    The result register (eax), or NULL if \p node has no value
+ */
+static TR::Register *
+generateIntrinsicHelperCall(TR::Node *node,
+                            void *routine,
+                            const TR::RealRegister::RegNum *argRegs,
+                            const TR::RealRegister::RegNum *gprClobbers,
+                            int32_t gprClobberCount,
+                            int32_t fprClobberCount,
+                            TR::CodeGenerator *cg)
+   {
+   const int32_t maxArgCount = 5;
+   int32_t argCount = node->getNumChildren();
+   TR_ASSERT_FATAL(argCount <= maxArgCount, "Too many arguments for intrinsic helper call n%dn", node->getGlobalIndex());
+
+   // The helper updates its argument registers in place, so each argument gets its own copy
+   TR::Register *args[maxArgCount];
+   bool killArgs[maxArgCount];
+   for (int32_t i = 0; i < argCount; i++)
+      {
+      TR::Node *child = node->getChild(i);
+      if (child->getDataType() == TR::Address)
+         killArgs[i] = TR::TreeEvaluator::stopUsingCopyRegAddr(child, args[i], cg);
+      else
+         killArgs[i] = TR::TreeEvaluator::stopUsingCopyRegInteger(child, args[i], cg);
+      }
+
+   TR::Register *resultReg = generateIntrinsicHelperCall(node, routine, args, argRegs, argCount, gprClobbers, gprClobberCount, fprClobberCount, cg);
+
+   for (int32_t i = 0; i < argCount; i++)
+      cg->decReferenceCount(node->getChild(i));
+
+   TR_LiveRegisters *liveRegs = cg->getLiveRegisters(TR_GPR);
+   for (int32_t i = 0; i < argCount; i++)
+      {
+      if (killArgs[i])
+         liveRegs->registerIsDead(args[i]);
+      }
+
+   return resultReg;
+   }
+
+/**
+ * \brief
+ *    Evaluates the address of the first element of a contiguous array into a new register
+ */
+static TR::Register *
+evaluateArrayDataAddress(TR::Node *array, TR::CodeGenerator *cg)
+   {
+   TR::Register *address = cg->allocateRegister();
+   generateRegMemInstruction(LEARegMem(), array, address, generateX86MemoryReference(cg->evaluate(array), TR::Compiler->om.contiguousArrayHeaderSizeInBytes(), cg), cg);
+   return address;
+   }
+
+/**
+ * \brief
+ *    Evaluates a 32 bit integer into a new register
+ */
+static TR::Register *
+evaluateIntegerCopy(TR::Node *value, TR::CodeGenerator *cg)
+   {
+   TR::Register *copy = cg->allocateRegister();
+   generateRegRegInstruction(MOV4RegReg, value, copy, cg->evaluate(value), cg);
+   return copy;
+   }
+
+/**
+ * \brief
+ *    Generates a call to an AMD64 string intrinsic routine. Array arguments are passed as the address of their
+ *    first element and the receiver of instance methods is dropped.
+ */
+static TR::Register *
+generateStringIntrinsicHelperCall(TR::Node *node,
+                                  void *routine,
+                                  const TR::RealRegister::RegNum *argRegs,
+                                  const TR::RealRegister::RegNum *gprClobbers,
+                                  int32_t gprClobberCount,
+                                  int32_t fprClobberCount,
+                                  TR::CodeGenerator *cg)
+   {
+   const int32_t maxArgCount = 5;
+   int32_t firstArg = node->getSymbol()->castToMethodSymbol()->isStatic() ? 0 : 1;
+   int32_t argCount = node->getNumChildren() - firstArg;
+   TR_ASSERT_FATAL(argCount <= maxArgCount, "Too many arguments for intrinsic helper call n%dn", node->getGlobalIndex());
+
+   TR::Register *args[maxArgCount];
+   for (int32_t i = 0; i < argCount; i++)
+      {
+      TR::Node *child = node->getChild(firstArg + i);
+      args[i] = child->getDataType() == TR::Address ? evaluateArrayDataAddress(child, cg) : evaluateIntegerCopy(child, cg);
+      }
+
+   TR::Register *resultReg = generateIntrinsicHelperCall(node, routine, args, argRegs, argCount, gprClobbers, gprClobberCount, fprClobberCount, cg);
+
+   for (int32_t i = 0; i < argCount; i++)
+      cg->stopUsingRegister(args[i]);
+   for (int32_t i = 0; i < firstArg; i++)
+      cg->recursivelyDecReferenceCount(node->getChild(i));
+   for (int32_t i = firstArg; i < node->getNumChildren(); i++)
+      cg->decReferenceCount(node->getChild(i));
+
+   return resultReg;
+   }
+
+
+TR::Register *
+J9::X86::TreeEvaluator::crc32cEvaluator(TR::Node *node, TR::CodeGenerator *cg)
+   {
+   // tree looks like:
+   // icall java/util/zip/CRC32C.updateBytes() or updateDirectByteBuffer()
+   //    crc
+   //    input ptr
+   //    input length (in bytes)
+   // The updated crc is returned
+   static const TR::RealRegister::RegNum argRegs[] = { TR::RealRegister::edx, TR::RealRegister::esi, TR::RealRegister::ecx };
+   return generateIntrinsicHelperCall(node, AMD64_INTRINSIC_ROUTINE(crc32cUpdate), argRegs, NULL, 0, 0, cg);
+   }
+
+
+TR::Register *
+J9::X86::TreeEvaluator::base64EncodeEvaluator(TR::Node *node, TR::CodeGenerator *cg)
+   {
+   // tree looks like:
+   // call java/util/Base64$Encoder.encodeBlock()
+   //    input ptr
+   //    input length (in bytes, a multiple of 3)
+   //    output ptr
+   //    isURL
+   static const TR::RealRegister::RegNum argRegs[] = { TR::RealRegister::esi, TR::RealRegister::ecx, TR::RealRegister::edi, TR::RealRegister::edx };
+   static const TR::RealRegister::RegNum gprClobbers[] = { TR::RealRegister::eax, TR::RealRegister::r8, TR::RealRegister::r9 };
+   return generateIntrinsicHelperCall(node, AMD64_INTRINSIC_ROUTINE(base64EncodeBlock), argRegs, gprClobbers, 3, 4, cg);
+   }
+
+
+TR::Register *
+J9::X86::TreeEvaluator::aesCryptBlockEvaluator(TR::Node *node, TR::CodeGenerator *cg)
+   {
+   // tree looks like:
+   // call com/sun/crypto/provider/AESCrypt.implEncryptBlock() or implDecryptBlock()
+   //    input ptr
+   //    output ptr
+   //    round key ptr
+   //    round key length (in ints)
+   static const TR::RealRegister::RegNum argRegs[] = { TR::RealRegister::esi, TR::RealRegister::edi, TR::RealRegister::edx, TR::RealRegister::ecx };
+   bool decrypt = node->getSymbol()->castToMethodSymbol()->getRecognizedMethod() == TR::com_sun_crypto_provider_AESCrypt_implDecryptBlock;
+   return generateIntrinsicHelperCall(node, decrypt ? AMD64_INTRINSIC_ROUTINE(aesDecryptBlock) : AMD64_INTRINSIC_ROUTINE(aesEncryptBlock), argRegs, NULL, 0, 3, cg);
+   }
+
+
+TR::Register *
+J9::X86::TreeEvaluator::ghashProcessBlocksEvaluator(TR::Node *node, TR::CodeGenerator *cg)
+   {
+   // tree looks like:
+   // call com/sun/crypto/provider/GHASH.processBlocks()
+   //    input ptr
+   //    number of 16 byte blocks
+   //    state ptr
+   //    subkey ptr
+   static const TR::RealRegister::RegNum argRegs[] = { TR::RealRegister::esi, TR::RealRegister::ecx, TR::RealRegister::edi, TR::RealRegister::edx };
+   return generateIntrinsicHelperCall(node, AMD64_INTRINSIC_ROUTINE(ghashProcessBlocks), argRegs, NULL, 0, 12, cg);
+   }
+
+
+TR::Register *
+J9::X86::TreeEvaluator::stringIndexOfEvaluator(TR::Node *node, TR::CodeGenerator *cg)
+   {
+   // tree looks like:
+   // icall java/lang/StringLatin1.indexOf() or java/lang/StringUTF16.indexOf()
+   //    source array
+   //    source length (in chars)
+   //    target array
+   //    target length (in chars, at least 1)
+   //    start index
+   // The JITHelpers intrinsicIndexOfString{Latin1,UTF16}() forms have the same
+   // arguments after the receiver. The index of the match or -1 is returned
+   static const TR::RealRegister::RegNum argRegs[] = { TR::RealRegister::edi, TR::RealRegister::edx, TR::RealRegister::esi, TR::RealRegister::ecx, TR::RealRegister::r8 };
+   // r11 is also trashed, but it holds the routine address and is dead after the call
+   static const TR::RealRegister::RegNum gprClobbers[] = { TR::RealRegister::r9, TR::RealRegister::r10, TR::RealRegister::r12, TR::RealRegister::r13 };
+
+   TR::RecognizedMethod method = node->getSymbol()->castToMethodSymbol()->getMandatoryRecognizedMethod();
+   bool isUTF16 = method == TR::java_lang_StringUTF16_indexOf || method == TR::com_ibm_jit_JITHelpers_intrinsicIndexOfStringUTF16;
+   return generateStringIntrinsicHelperCall(node, isUTF16 ? AMD64_INTRINSIC_ROUTINE(stringIndexOfUTF16) : AMD64_INTRINSIC_ROUTINE(stringIndexOfLatin1), argRegs, gprClobbers, 4, 6, cg);
+   }
+
+
+TR::Register *
+J9::X86::TreeEvaluator::stringCompareEvaluator(TR::Node *node, TR::CodeGenerator *cg)
+   {
+   // tree looks like:
+   // icall com/ibm/jit/JITHelpers.intrinsicCompare{Latin1,UTF16}()
+   //    receiver
+   //    first array
+   //    first start index
+   //    second array
+   //    second start index
+   //    length (in chars)
+   // The difference of the first mismatched chars or 0 is returned
+   static const TR::RealRegister::RegNum argRegs[] = { TR::RealRegister::esi, TR::RealRegister::edx, TR::RealRegister::edi, TR::RealRegister::ecx, TR::RealRegister::r8 };
+   static const TR::RealRegister::RegNum gprClobbers[] = { TR::RealRegister::r9 };
+
+   bool isUTF16 = node->getSymbol()->castToMethodSymbol()->getMandatoryRecognizedMethod() == TR::com_ibm_jit_JITHelpers_intrinsicCompareUTF16;
+   return generateStringIntrinsicHelperCall(node, isUTF16 ? AMD64_INTRINSIC_ROUTINE(stringCompareUTF16) : AMD64_INTRINSIC_ROUTINE(stringCompareLatin1), argRegs, gprClobbers, 1, 2, cg);
+   }
+
+
+TR::Register *
+J9::X86::TreeEvaluator::hasNegativesEvaluator(TR::Node *node, TR::CodeGenerator *cg)
+   {
+   // tree looks like:
+   // icall java/lang/StringCoding.hasNegatives()
+   //    byte array
+   //    offset
+   //    length
+   // 1 is returned if any byte in the range is negative, 0 otherwise
+   static const TR::RealRegister::RegNum argRegs[] = { TR::RealRegister::esi, TR::RealRegister::edx, TR::RealRegister::ecx };
+   return generateStringIntrinsicHelperCall(node, AMD64_INTRINSIC_ROUTINE(hasNegatives), argRegs, NULL, 0, 1, cg);
+   }
+
 TR::Register *
 J9::X86::TreeEvaluator::compressStringEvaluator(
       TR::Node *node,
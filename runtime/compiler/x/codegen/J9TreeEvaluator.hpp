@@ -133,6 +133,13 @@ class OMR_EXTENSIBLE TreeEvaluator: public J9::TreeEvaluator
    static void generateFillInDataBlockSequenceForUnresolvedField (TR::CodeGenerator *cg, TR::Node *node, TR::Snippet *dataSnippet, bool isWrite, TR::Register *sideEffectRegister, TR::Register *dataSnippetRegister);
    static TR::Register *directCallEvaluator(TR::Node *node, TR::CodeGenerator *cg);
    static TR::Register *encodeUTF16Evaluator(TR::Node *node, TR::CodeGenerator *cg);
+   static TR::Register *crc32cEvaluator(TR::Node *node, TR::CodeGenerator *cg);
+   static TR::Register *base64EncodeEvaluator(TR::Node *node, TR::CodeGenerator *cg);
+   static TR::Register *aesCryptBlockEvaluator(TR::Node *node, TR::CodeGenerator *cg);
+   static TR::Register *ghashProcessBlocksEvaluator(TR::Node *node, TR::CodeGenerator *cg);
+   static TR::Register *stringIndexOfEvaluator(TR::Node *node, TR::CodeGenerator *cg);
+   static TR::Register *stringCompareEvaluator(TR::Node *node, TR::CodeGenerator *cg);
+   static TR::Register *hasNegativesEvaluator(TR::Node *node, TR::CodeGenerator *cg);
    static TR::Register *compressStringEvaluator(TR::Node *node, TR::CodeGenerator *cg, bool japaneseMethod);
    static TR::Register *compressStringNoCheckEvaluator(TR::Node *node, TR::CodeGenerator *cg, bool japaneseMethod);
    static TR::Register *andORStringEvaluator(TR::Node *node, TR::CodeGenerator *cg);
@@ -57,6 +57,7 @@ class MM_HeapMap;
 class MM_MemorySubSpace;
 class MM_ObjectAccessBarrier;
 class MM_OwnableSynchronizerObjectList;
+class MM_StringDeduplicator;
 class MM_StringTable;
 class MM_UnfinalizedObjectList;
 class MM_Wildcard;
@@ -82,6 +83,7 @@ private:
 	MM_OwnableSynchronizerObjectList* ownableSynchronizerObjectLists; /**< The global linked list of ownable synchronizer object lists. */
 public:
 	MM_StringTable* stringTable; /**< top level String Table structure (internally organized as a set of hash sub-tables */
+	MM_StringDeduplicator* stringDeduplicator; /**< deduplicates String values during global marking, NULL unless stringDeduplication is enabled */
 
 	void* gcchkExtensions;
 
@@ -122,6 +124,13 @@ public:
 
 	U_32 _stringTableListToTreeThreshold; /**< Threshold at which we start using trees instead of lists for collision resolution in the String table */
 
+	bool stringDeduplication; /**< true if String values are deduplicated during global marking (-Xgc:stringDeduplication) */
+	UDATA stringDeduplicationTableSize; /**< Number of canonical String values remembered during one marking pass */
+	UDATA stringDeduplicationRegionAge; /**< Balanced only: minimum logical age of the region of a String for its value to be deduplicated */
+
+	bool tarokEnableHotFieldCopying; /**< Balanced only: copy-forward copies the JIT-reported hot fields of an object depth-first, right after the object itself */
+	UDATA tarokTargetMaxPauseTimeMillis; /**< Balanced only: Eden is sized so that the predicted copy-forward time stays below this many milliseconds (0 means no target) */
+
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 	bool fvtest_forceFinalizeClassLoaders;
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
@@ -281,6 +290,7 @@ public:
 		: MM_GCExtensionsBase()
 		, ownableSynchronizerObjectLists(NULL)
 		, stringTable(NULL)
+		, stringDeduplicator(NULL)
 		, gcchkExtensions(NULL)
 		, tgcExtensions(NULL)
 #if defined(J9VM_GC_FINALIZATION)
@@ -296,6 +306,11 @@ public:
 		, classUnloadingAnonymousClassWeight(1.0)
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 		, _stringTableListToTreeThreshold(1024)
+		, stringDeduplication(false)
+		, stringDeduplicationTableSize(64 * 1024)
+		, stringDeduplicationRegionAge(3)
+		, tarokEnableHotFieldCopying(false)
+		, tarokTargetMaxPauseTimeMillis(0)
 		, maxSoftReferenceAge(32)
 #if defined(J9VM_GC_FINALIZATION)
 		, finalizeMainPriority(J9THREAD_PRIORITY_NORMAL)
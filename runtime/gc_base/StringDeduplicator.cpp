@@ -0,0 +1,178 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "j9consts.h"
+#include "ModronAssertions.h"
+
+#include "StringDeduplicator.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensions.hpp"
+#include "SlotObject.hpp"
+
+MM_StringDeduplicator *
+MM_StringDeduplicator::newInstance(MM_EnvironmentBase *env, uintptr_t tableSize)
+{
+	/* round the table up to a power of two so probing can mask the hash */
+	uintptr_t roundedTableSize = 1;
+	while (roundedTableSize < tableSize) {
+		roundedTableSize <<= 1;
+	}
+
+	MM_StringDeduplicator *deduplicator = (MM_StringDeduplicator *)env->getForge()->allocate(sizeof(MM_StringDeduplicator), MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+	if (NULL != deduplicator) {
+		new(deduplicator) MM_StringDeduplicator(env, roundedTableSize);
+		if (!deduplicator->initialize(env)) {
+			deduplicator->kill(env);
+			deduplicator = NULL;
+		}
+	}
+	return deduplicator;
+}
+
+void
+MM_StringDeduplicator::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_StringDeduplicator::initialize(MM_EnvironmentBase *env)
+{
+	_extensions = MM_GCExtensions::getExtensions(env);
+	_javaVM = (J9JavaVM *)env->getOmrVM()->_language_vm;
+	/* only created for gencon and balanced, see j9gc_initialize_heap() */
+	Assert_MM_true(_extensions->scavengerEnabled || _extensions->isVLHGC());
+	_tenuredOnly = _extensions->scavengerEnabled;
+
+	uintptr_t tableBytes = _tableSize * sizeof(uintptr_t);
+	_table = (volatile uintptr_t *)env->getForge()->allocate(tableBytes, MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+	if (NULL == _table) {
+		return false;
+	}
+	memset((void *)_table, 0, tableBytes);
+
+	return true;
+}
+
+void
+MM_StringDeduplicator::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _table) {
+		env->getForge()->free((void *)_table);
+		_table = NULL;
+	}
+}
+
+void
+MM_StringDeduplicator::reset(MM_EnvironmentBase *env)
+{
+	if (0 != _occupiedSlots) {
+		memset((void *)_table, 0, _tableSize * sizeof(uintptr_t));
+		_occupiedSlots = 0;
+	}
+}
+
+bool
+MM_StringDeduplicator::deduplicate(MM_EnvironmentBase *env, j9object_t stringObject)
+{
+	J9VMThread *vmThread = (J9VMThread *)env->getLanguageVMThread();
+	GC_SlotObject valueSlot(env->getOmrVM(), (fomrobject_t *)((uintptr_t)stringObject + J9VMJAVALANGSTRING_VALUE_OFFSET(vmThread)));
+	J9IndexableObject *value = (J9IndexableObject *)valueSlot.readReferenceFromSlot();
+
+	if (!isCandidateValue(env, stringObject, value)) {
+		return false;
+	}
+
+	uintptr_t dataSize = _extensions->indexableObjectModel.getDataSizeInBytes(value);
+	void *data = _extensions->indexableObjectModel.getDataPointerForContiguous(value);
+	uintptr_t slotIndex = hashValue(data, dataSize) & (_tableSize - 1);
+
+	for (uintptr_t probes = 0; probes < MAX_PROBES; probes++) {
+		volatile uintptr_t *slot = &_table[slotIndex];
+		J9IndexableObject *canonical = (J9IndexableObject *)*slot;
+		if (NULL == canonical) {
+			canonical = (J9IndexableObject *)MM_AtomicOperations::lockCompareExchange(slot, 0, (uintptr_t)value);
+			if (NULL == canonical) {
+				/* the value of this String is now the canonical array for its content */
+				MM_AtomicOperations::add(&_occupiedSlots, 1);
+				return false;
+			}
+			/* another thread claimed the slot first; compare against its array */
+		}
+
+		if (canonical == value) {
+			return false;
+		}
+
+		if (isEqualValue(env, canonical, value, data, dataSize)) {
+			valueSlot.writeReferenceToSlot((omrobjectptr_t)canonical);
+			return true;
+		}
+
+		slotIndex = (slotIndex + 1) & (_tableSize - 1);
+	}
+
+	return false;
+}
+
+bool
+MM_StringDeduplicator::isCandidateValue(MM_EnvironmentBase *env, j9object_t stringObject, J9IndexableObject *value)
+{
+	if (NULL == value) {
+		return false;
+	}
+
+	/* A String in the nursery may still be filling in its value. Repointing a tenured String to a
+	 * nursery array would also need a remembered set entry, so both have to be tenured.
+	 */
+	if (_tenuredOnly && (!_extensions->isOld((omrobjectptr_t)stringObject) || !_extensions->isOld((omrobjectptr_t)value))) {
+		return false;
+	}
+
+	return _extensions->indexableObjectModel.isInlineContiguousArraylet(value) && (0 != _extensions->indexableObjectModel.getSizeInElements(value));
+}
+
+bool
+MM_StringDeduplicator::isEqualValue(MM_EnvironmentBase *env, J9IndexableObject *candidate, J9IndexableObject *value, void *data, uintptr_t dataSize)
+{
+	return (J9GC_J9OBJECT_CLAZZ(candidate, env) == J9GC_J9OBJECT_CLAZZ(value, env))
+		&& (_extensions->indexableObjectModel.getDataSizeInBytes(candidate) == dataSize)
+		&& (0 == memcmp(_extensions->indexableObjectModel.getDataPointerForContiguous(candidate), data, dataSize));
+}
+
+uintptr_t
+MM_StringDeduplicator::hashValue(void *data, uintptr_t dataSize)
+{
+	/* FNV-1a over the size and at most MAX_HASHED_BYTES of content */
+	uintptr_t hash = (uintptr_t)2166136261U ^ dataSize;
+	uintptr_t hashedBytes = (dataSize < MAX_HASHED_BYTES) ? dataSize : MAX_HASHED_BYTES;
+	U_8 *cursor = (U_8 *)data;
+	for (uintptr_t i = 0; i < hashedBytes; i++) {
+		hash = (hash ^ cursor[i]) * 16777619U;
+	}
+	return hash ^ (hash >> 16);
+}
@@ -0,0 +1,115 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(STRINGDEDUPLICATOR_HPP_)
+#define STRINGDEDUPLICATOR_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+
+#include "BaseVirtual.hpp"
+
+class MM_EnvironmentBase;
+class MM_GCExtensions;
+
+/**
+ * Deduplicates the value arrays of String objects found by global marking.
+ *
+ * While a String is scanned, its value array is looked up by content in a table of canonical
+ * arrays. If an equal array is already in the table, the value slot of the String is repointed
+ * to it before the slot is scanned, so the duplicate is no longer reachable through this String.
+ * Otherwise the value array itself becomes the canonical array for that content.
+ *
+ * Only Strings which have survived a collection are deduplicated, since a String is constructed
+ * by allocating its value array and then filling it in: with gencon the String and its value must
+ * be tenured, and balanced only passes Strings from regions of at least stringDeduplicationRegionAge.
+ * Collectors without a nursery or regions have no such age and do not create a deduplicator.
+ *
+ * The table is an open addressed array of object pointers, filled with compare-and-swap so any
+ * number of marking threads can use it at once. It only holds pointers for the duration of one
+ * marking pass (objects may move afterwards) and must be reset by the collector before objects move.
+ * @ingroup GC_Base
+ */
+class MM_StringDeduplicator : public MM_BaseVirtual
+{
+/* Data members / types */
+public:
+protected:
+private:
+	MM_GCExtensions *_extensions;
+	J9JavaVM *_javaVM;
+	volatile uintptr_t *_table; /**< canonical value arrays, 0 for an empty slot */
+	uintptr_t _tableSize; /**< number of slots in _table, a power of two */
+	volatile uintptr_t _occupiedSlots; /**< number of non-empty slots in _table */
+	bool _tenuredOnly; /**< only deduplicate tenured Strings with tenured values (gencon); balanced checks the region age before deduplicate() */
+
+	static const uintptr_t MAX_PROBES = 8; /**< slots examined for a value before giving up on it */
+	static const uintptr_t MAX_HASHED_BYTES = 256; /**< longer values are only hashed on their prefix and size */
+
+/* Methods */
+public:
+	static MM_StringDeduplicator *newInstance(MM_EnvironmentBase *env, uintptr_t tableSize);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Deduplicate the value of a String which is being scanned, before its slots are scanned.
+	 * @param env[in] the current thread
+	 * @param stringObject[in] a marked java.lang.String
+	 * @return true if the value slot of the String was repointed to a canonical array
+	 */
+	bool deduplicate(MM_EnvironmentBase *env, j9object_t stringObject);
+
+	/**
+	 * Forget all canonical arrays. Must be called when a marking pass completes and before any
+	 * collection which may move objects remembered in the table.
+	 * @param env[in] the current thread
+	 */
+	void reset(MM_EnvironmentBase *env);
+
+	MM_StringDeduplicator(MM_EnvironmentBase *env, uintptr_t tableSize)
+		: MM_BaseVirtual()
+		, _extensions(NULL)
+		, _javaVM(NULL)
+		, _table(NULL)
+		, _tableSize(tableSize)
+		, _occupiedSlots(0)
+		, _tenuredOnly(false)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+private:
+	bool isCandidateValue(MM_EnvironmentBase *env, j9object_t stringObject, J9IndexableObject *value);
+	bool isEqualValue(MM_EnvironmentBase *env, J9IndexableObject *candidate, J9IndexableObject *value, void *data, uintptr_t dataSize);
+	static uintptr_t hashValue(void *data, uintptr_t dataSize);
+};
+
+#endif /* STRINGDEDUPLICATOR_HPP_ */
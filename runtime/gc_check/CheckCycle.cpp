@@ -123,6 +123,7 @@ GC_CheckCycle::printHelp(J9PortLibrary *portLib)
 	j9tty_printf(PORTLIB, "  localinterval=X\n");
 #endif /* J9VM_GC_MODRON_SCAVENGER */
 	j9tty_printf(PORTLIB, "  startindex=x\n");
+	j9tty_printf(PORTLIB, "  samplepercent=X   check only X%% of the object heap (1-100, in units of 256KB) in each cycle\n");
 #if defined(J9VM_GC_MODRON_SCAVENGER)
 	j9tty_printf(PORTLIB, "  scavengerbackout\n");
 	j9tty_printf(PORTLIB, "  suppresslocal\n");
@@ -350,6 +351,16 @@ top:
 							continue;
 						}
 
+						char *optionStart = scan_start;
+						if (try_scan(&scan_start, "samplepercent=")) {
+							if ((0 != scan_udata(&scan_start, &_samplePercent)) || (0 == _samplePercent) || (_samplePercent > 100)) {
+								/* report the whole option as unrecognized */
+								scan_start = optionStart;
+								goto failure;
+							}
+							continue;
+						}
+
 #if defined(J9VM_GC_MODRON_SCAVENGER)
 						if (try_scan(&scan_start, "scavengerbackout")) {
 							miscFlags |= J9MODRON_GCCHK_SCAVENGER_BACKOUT;
@@ -57,6 +57,7 @@ private:
 	GCCheckInvokedBy _invokedBy; /**< What stage of GC invoked the check */
 	UDATA _manualCheckInvocation; /**< Allow user to identify which installed GCCheck triggered message */
 	UDATA _errorCount; /**< Number of errors encountered  */
+	UDATA _samplePercent; /**< Percentage of heap regions walked by the object heap check in each cycle (100 walks all of them) */
 	
 	GC_Check *_checks; /**< Pointer to head of linked list of checks to run in this cycle */
 	
@@ -84,6 +85,7 @@ public:
 	UDATA getMiscFlags() { return _miscFlags; };
 	GCCheckInvokedBy getInvoker() { return _invokedBy; };
 	UDATA getManualCheckNumber() { return _manualCheckInvocation; };
+	UDATA getSamplePercent() { return _samplePercent; };
 	
 	UDATA nextErrorCount() { return ++_errorCount; };
 	
@@ -105,6 +107,7 @@ public:
 		, _invokedBy(invocation_unknown)
 		, _manualCheckInvocation(manualCountInvocation)
 		, _errorCount(0)
+		, _samplePercent(100)
 		, _checks(NULL)
 		, _javaVM(javaVM)
 		, _portLibrary(javaVM->portLibrary)
@@ -43,6 +43,7 @@
 #include "CheckCycle.hpp"
 #include "CheckError.hpp"
 #include "CheckReporter.hpp"
+#include "CheckReporterBuffered.hpp"
 #include "CheckReporterTTY.hpp"
 #include "ClassModel.hpp"
 #include "GCExtensions.hpp"
@@ -699,7 +700,7 @@ GC_CheckEngine::checkClassHeap(J9JavaVM *javaVM, J9Class *clazz, J9MemorySegment
 	 */
 	result = checkJ9Class(javaVM, clazz, segment, _cycle->getCheckFlags());
 	if (J9MODRON_GCCHK_RC_OK != result) {
-		GC_CheckError error(clazz, _cycle, _currentCheck, "Class ", result, _cycle->nextErrorCount());
+		GC_CheckError error(clazz, _cycle, _currentCheck, "Class ", result, nextErrorCount());
 		_reporter->report(&error);
 	}
 
@@ -727,7 +728,7 @@ GC_CheckEngine::checkClassHeap(J9JavaVM *javaVM, J9Class *clazz, J9MemorySegment
 			case classiterator_state_callsites:
 				elementName = "callsite "; break;
 			}
-			GC_CheckError error(clazz, (void*)slotPtr, _cycle, _currentCheck, elementName, result, _cycle->nextErrorCount());
+			GC_CheckError error(clazz, (void*)slotPtr, _cycle, _currentCheck, elementName, result, nextErrorCount());
 			_reporter->report(&error);
 			return J9MODRON_SLOT_ITERATOR_OK;
 		}
@@ -736,7 +737,7 @@ GC_CheckEngine::checkClassHeap(J9JavaVM *javaVM, J9Class *clazz, J9MemorySegment
 			/* If the slot has its old bit OFF, the class's remembered bit should be ON */
 			if (objectPtr && !extensions->isOld(objectPtr)) {
 				if (!extensions->objectModel.isRemembered((J9Object*)clazz->classObject)) {
-					GC_CheckError error(clazz, (void*)slotPtr, _cycle, _currentCheck, "Class ", J9MODRON_GCCHK_RC_REMEMBERED_SET_OLD_OBJECT, _cycle->nextErrorCount());
+					GC_CheckError error(clazz, (void*)slotPtr, _cycle, _currentCheck, "Class ", J9MODRON_GCCHK_RC_REMEMBERED_SET_OLD_OBJECT, nextErrorCount());
 					_reporter->report(&error);
 					return J9MODRON_SLOT_ITERATOR_OK;
 				}
@@ -753,7 +754,7 @@ GC_CheckEngine::checkClassHeap(J9JavaVM *javaVM, J9Class *clazz, J9MemorySegment
 	if (NULL != replaced) {
 		/* if class replaces another class the replaced class must have J9AccClassHotSwappedOut flag set */
 		if (0 == (J9CLASS_FLAGS(replaced) & J9AccClassHotSwappedOut)) {
-			GC_CheckError error(clazz, (void*)&(clazz->replacedClass), _cycle, _currentCheck, "Class ", J9MODRON_GCCHK_RC_REPLACED_CLASS_HAS_NO_HOTSWAP_FLAG, _cycle->nextErrorCount());
+			GC_CheckError error(clazz, (void*)&(clazz->replacedClass), _cycle, _currentCheck, "Class ", J9MODRON_GCCHK_RC_REPLACED_CLASS_HAS_NO_HOTSWAP_FLAG, nextErrorCount());
 			_reporter->report(&error);
 			return J9MODRON_SLOT_ITERATOR_OK;
 		}
@@ -799,7 +800,7 @@ GC_CheckEngine::checkClassHeap(J9JavaVM *javaVM, J9Class *clazz, J9MemorySegment
 		}
 
 		if (J9MODRON_GCCHK_RC_OK != result) {
-			GC_CheckError error( clazz, classSlotPtr, _cycle, _currentCheck, elementName, result, _cycle->nextErrorCount());
+			GC_CheckError error( clazz, classSlotPtr, _cycle, _currentCheck, elementName, result, nextErrorCount());
 			_reporter->report(&error);
 			return J9MODRON_SLOT_ITERATOR_OK;
 		}
@@ -825,7 +826,7 @@ GC_CheckEngine::checkClassStatics(J9JavaVM* vm, J9Class* clazz)
 		if (J9GC_CLASS_IS_ARRAY(clazz)) {
 			/* j9arrayclass should not be hot swapped */
 			result = J9MODRON_GCCHK_RC_CLASS_HOT_SWAPPED_FOR_ARRAY;
-			GC_CheckError error(clazz, _cycle, _currentCheck, "Class ", result, _cycle->nextErrorCount());
+			GC_CheckError error(clazz, _cycle, _currentCheck, "Class ", result, nextErrorCount());
 			_reporter->report(&error);
 			validationRequired = false;
 		}
@@ -882,7 +883,7 @@ GC_CheckEngine::checkClassStatics(J9JavaVM* vm, J9Class* clazz)
 					/* an address must be in gc scan range */
 					if (!((address >= sectionStart) && (address < sectionEnd))) {
 						result = J9MODRON_GCCHK_RC_CLASS_STATICS_REFERENCE_IS_NOT_IN_SCANNING_RANGE;
-						GC_CheckError error(clazz, address, _cycle, _currentCheck, "Class ", result, _cycle->nextErrorCount());
+						GC_CheckError error(clazz, address, _cycle, _currentCheck, "Class ", result, nextErrorCount());
 						_reporter->report(&error);
 					}
 
@@ -909,7 +910,7 @@ GC_CheckEngine::checkClassStatics(J9JavaVM* vm, J9Class* clazz)
 						if (NULL != classToCast) {
 							if (0 == instanceOfOrCheckCast(J9GC_J9OBJECT_CLAZZ_VM(*address, vm), classToCast)) {
 								result = J9MODRON_GCCHK_RC_CLASS_STATICS_FIELD_POINTS_WRONG_OBJECT;
-								GC_CheckError error(clazz, address, _cycle, _currentCheck, "Class ", result, _cycle->nextErrorCount());
+								GC_CheckError error(clazz, address, _cycle, _currentCheck, "Class ", result, nextErrorCount());
 								_reporter->report(&error);
 							}
 						}
@@ -921,7 +922,7 @@ GC_CheckEngine::checkClassStatics(J9JavaVM* vm, J9Class* clazz)
 
 		if (numberOfReferences != romClazz->objectStaticCount) {
 			result = J9MODRON_GCCHK_RC_CLASS_STATICS_WRONG_NUMBER_OF_REFERENCES;
-			GC_CheckError error(clazz, _cycle, _currentCheck, "Class ", result, _cycle->nextErrorCount());
+			GC_CheckError error(clazz, _cycle, _currentCheck, "Class ", result, nextErrorCount());
 			_reporter->report(&error);
 		}
 	}
@@ -974,7 +975,7 @@ GC_CheckEngine::checkSlotObjectHeap(J9JavaVM *javaVM, J9Object *objectPtr, fj9ob
 	
 	if (J9MODRON_GCCHK_RC_OK != result) {
 		const char *elementName = extensions->objectModel.isIndexable(objectIndirectBase) ? "IObject " : "Object ";
-		GC_CheckError error(objectIndirectBase, objectIndirect, _cycle, _currentCheck, (char *)elementName, result, _cycle->nextErrorCount());
+		GC_CheckError error(objectIndirectBase, objectIndirect, _cycle, _currentCheck, (char *)elementName, result, nextErrorCount());
 		_reporter->report(&error);
 		return J9MODRON_SLOT_ITERATOR_OK;
 	}
@@ -987,7 +988,7 @@ GC_CheckEngine::checkSlotObjectHeap(J9JavaVM *javaVM, J9Object *objectPtr, fj9ob
 		if (!findRegionForPointer(javaVM, objectPtr, &objectRegion)) {
 			/* should be impossible, since checkObjectIndirect() already verified that the object exists */
 			const char *elementName = extensions->objectModel.isIndexable(objectIndirectBase) ? "IObject " : "Object ";
-			GC_CheckError error(objectIndirectBase, objectIndirect, _cycle, _currentCheck, (char *)elementName, J9MODRON_GCCHK_RC_NOT_FOUND, _cycle->nextErrorCount());
+			GC_CheckError error(objectIndirectBase, objectIndirect, _cycle, _currentCheck, (char *)elementName, J9MODRON_GCCHK_RC_NOT_FOUND, nextErrorCount());
 			_reporter->report(&error);
 			return J9MODRON_SLOT_ITERATOR_OK;
 		}
@@ -996,7 +997,7 @@ GC_CheckEngine::checkSlotObjectHeap(J9JavaVM *javaVM, J9Object *objectPtr, fj9ob
 
 		if (objectPtr && (regionType & MEMORY_TYPE_OLD) && (objectRegionType & MEMORY_TYPE_NEW) && !extensions->objectModel.isRemembered(objectIndirectBase)) {
 			const char *elementName = extensions->objectModel.isIndexable(objectIndirectBase) ? "IObject " : "Object ";
-			GC_CheckError error(objectIndirectBase, objectIndirect, _cycle, _currentCheck, (char *)elementName, J9MODRON_GCCHK_RC_NEW_POINTER_NOT_REMEMBERED, _cycle->nextErrorCount());
+			GC_CheckError error(objectIndirectBase, objectIndirect, _cycle, _currentCheck, (char *)elementName, J9MODRON_GCCHK_RC_NEW_POINTER_NOT_REMEMBERED, nextErrorCount());
 			_reporter->report(&error);
 			return J9MODRON_SLOT_ITERATOR_OK;
 		}
@@ -1004,7 +1005,7 @@ GC_CheckEngine::checkSlotObjectHeap(J9JavaVM *javaVM, J9Object *objectPtr, fj9ob
 		/* Old objects that point to objects with old bit OFF should have remembered bit ON */
 		if (objectPtr && (regionType & MEMORY_TYPE_OLD) && !extensions->isOld(objectPtr) && !extensions->objectModel.isRemembered(objectIndirectBase)) {
 			const char *elementName = extensions->objectModel.isIndexable(objectIndirectBase) ? "IObject " : "Object ";
-			GC_CheckError error(objectIndirectBase, objectIndirect, _cycle, _currentCheck, (char *)elementName, J9MODRON_GCCHK_RC_REMEMBERED_SET_OLD_OBJECT, _cycle->nextErrorCount());
+			GC_CheckError error(objectIndirectBase, objectIndirect, _cycle, _currentCheck, (char *)elementName, J9MODRON_GCCHK_RC_REMEMBERED_SET_OLD_OBJECT, nextErrorCount());
 			_reporter->report(&error);
 			return J9MODRON_SLOT_ITERATOR_OK;
 		}
@@ -1035,8 +1036,8 @@ GC_CheckEngine::checkObjectHeap(J9JavaVM *javaVM, J9MM_IterateObjectDescriptor *
 	/* If we encounter a hole with size 0, the heap walk will enter an infinite loop -- prevent this. */
 	/* Size of hole can not be larger then rest of the region */
 	if (FALSE == objectDesc->isObject) {
-		if ((0 == objectDesc->size) || (objectDesc->size > ((UDATA)regionDesc->regionStart +  regionDesc->regionSize - (UDATA)objectDesc->object))) {
-			GC_CheckError error(objectDesc->object, _cycle, _currentCheck, "Object ", J9MODRON_GCCHK_RC_DEAD_OBJECT_SIZE, _cycle->nextErrorCount());
+		if (!isHoleSizeValid(objectDesc, regionDesc)) {
+			GC_CheckError error(objectDesc->object, _cycle, _currentCheck, "Object ", J9MODRON_GCCHK_RC_DEAD_OBJECT_SIZE, nextErrorCount());
 			_reporter->report(&error);
 			_reporter->reportHeapWalkError(&error, _lastHeapObject1, _lastHeapObject2, _lastHeapObject3);
 			return J9MODRON_SLOT_ITERATOR_UNRECOVERABLE_ERROR;
@@ -1047,7 +1048,7 @@ GC_CheckEngine::checkObjectHeap(J9JavaVM *javaVM, J9MM_IterateObjectDescriptor *
 	result = checkJ9Object(javaVM, objectDesc->object, regionDesc, _cycle->getCheckFlags());
 	if (J9MODRON_GCCHK_RC_OK != result) {
 		const char *elementName = extensions->objectModel.isIndexable(objectDesc->object) ? "IObject " : "Object ";
-		GC_CheckError error(objectDesc->object, _cycle, _currentCheck, (char *)elementName, result, _cycle->nextErrorCount());
+		GC_CheckError error(objectDesc->object, _cycle, _currentCheck, (char *)elementName, result, nextErrorCount());
 		_reporter->report(&error);
 		_reporter->reportHeapWalkError(&error, _lastHeapObject1, _lastHeapObject2, _lastHeapObject3);
 		return J9MODRON_SLOT_ITERATOR_UNRECOVERABLE_ERROR;
@@ -1068,7 +1069,9 @@ GC_CheckEngine::checkObjectHeap(J9JavaVM *javaVM, J9MM_IterateObjectDescriptor *
 	if ((OBJECT_HEADER_SHAPE_MIXED == J9GC_CLASS_SHAPE(clazz)) && (0 != (J9CLASS_FLAGS(clazz) & J9AccClassOwnableSynchronizer))) {
 		if (NULL == extensions->accessBarrier->isObjectInOwnableSynchronizerList(objectDesc->object)) {
 			PORT_ACCESS_FROM_PORT(_portLibrary);
-			j9tty_printf(PORTLIB, "  <gc check: found Ownable SynchronizerObject %p is not on the list >\n", objectDesc->object);
+			char message[GC_CheckBufferedReport::MESSAGE_SIZE];
+			j9str_printf(PORTLIB, message, sizeof(message), "  <gc check: found Ownable SynchronizerObject %p is not on the list >\n", objectDesc->object);
+			_reporter->reportMessage(message);
 		} else {
 			_ownableSynchronizerObjectCountOnHeap += 1;
 		}
@@ -1083,6 +1086,18 @@ GC_CheckEngine::checkObjectHeap(J9JavaVM *javaVM, J9MM_IterateObjectDescriptor *
 	return result;
 }
 
+/**
+ * Determine whether the size of a hole lets a heap walk advance past it. A hole of size 0
+ * would make the walk loop forever, and a hole can't be larger than the rest of its region.
+ *
+ * @return true if the walk can step over the hole
+ */
+bool
+GC_CheckEngine::isHoleSizeValid(J9MM_IterateObjectDescriptor *objectDesc, J9MM_IterateRegionDescriptor *regionDesc)
+{
+	return (0 != objectDesc->size) && (objectDesc->size <= ((UDATA)regionDesc->regionStart + regionDesc->regionSize - (UDATA)objectDesc->object));
+}
+
 /**
  * Verify a slot (double-indirect object pointer).
  *
@@ -1099,11 +1114,11 @@ GC_CheckEngine::checkSlotVMThread(J9JavaVM *javaVM, J9Object **objectIndirect, v
 	UDATA result = checkObjectIndirect(javaVM, objectPtr);
 	if (J9MODRON_GCCHK_RC_STACK_OBJECT == result) {
 		if (vmthreaditerator_state_monitor_records != vmthreadIterator->getState()) {
-			GC_CheckError error(objectIndirectBase, objectIndirect, _cycle, _currentCheck, result, _cycle->nextErrorCount(), objectType);
+			GC_CheckError error(objectIndirectBase, objectIndirect, _cycle, _currentCheck, result, nextErrorCount(), objectType);
 			_reporter->report(&error);
 		}
 	} else if (J9MODRON_GCCHK_RC_OK != result) {
-		GC_CheckError error(objectIndirectBase, objectIndirect, _cycle, _currentCheck, result, _cycle->nextErrorCount(), objectType);
+		GC_CheckError error(objectIndirectBase, objectIndirect, _cycle, _currentCheck, result, nextErrorCount(), objectType);
 		_reporter->report(&error);
 	}
 	return J9MODRON_SLOT_ITERATOR_OK;
@@ -1128,7 +1143,7 @@ GC_CheckEngine::checkSlotStack(J9JavaVM *javaVM, J9Object **objectIndirect, J9VM
 		result = checkStackObject(javaVM, objectPtr);
 	}
 	if (J9MODRON_GCCHK_RC_OK != result) {
-		GC_CheckError error(vmThread, objectIndirect, stackLocation, _cycle, _currentCheck, result, _cycle->nextErrorCount());
+		GC_CheckError error(vmThread, objectIndirect, stackLocation, _cycle, _currentCheck, result, nextErrorCount());
 		_reporter->report(&error);
 
 		return J9MODRON_SLOT_ITERATOR_RECOVERABLE_ERROR;
@@ -1154,7 +1169,7 @@ GC_CheckEngine::checkSlotPool(J9JavaVM *javaVM, J9Object **objectIndirect, void
 	J9Object *objectPtr = *objectIndirect;
 	UDATA result = checkObjectIndirect(javaVM, objectPtr);
 	if (J9MODRON_GCCHK_RC_OK != result) {
-		GC_CheckError error(objectIndirectBase, objectIndirect, _cycle, _currentCheck, result, _cycle->nextErrorCount(), check_type_other);
+		GC_CheckError error(objectIndirectBase, objectIndirect, _cycle, _currentCheck, result, nextErrorCount(), check_type_other);
 		_reporter->report(&error);
 	}
 	return J9MODRON_SLOT_ITERATOR_OK;
@@ -1183,7 +1198,7 @@ GC_CheckEngine::checkSlotRememberedSet(J9JavaVM *javaVM, J9Object **objectIndire
 	
 	UDATA result = checkObjectIndirect(javaVM, objectPtr);
 	if (J9MODRON_GCCHK_RC_OK != result) {
-		GC_CheckError error(puddle, objectIndirect, _cycle, _currentCheck, result, _cycle->nextErrorCount());
+		GC_CheckError error(puddle, objectIndirect, _cycle, _currentCheck, result, nextErrorCount());
 		_reporter->report(&error);
 		return J9MODRON_SLOT_ITERATOR_OK;
 	}
@@ -1193,7 +1208,7 @@ GC_CheckEngine::checkSlotRememberedSet(J9JavaVM *javaVM, J9Object **objectIndire
 		J9MM_IterateRegionDescriptor objectRegion;
 		if (!findRegionForPointer(javaVM, objectPtr, &objectRegion)) {
 			/* shouldn't happen, since checkObjectIndirect() already verified this object */
-			GC_CheckError error(puddle, objectIndirect, _cycle, _currentCheck, J9MODRON_GCCHK_RC_NOT_FOUND, _cycle->nextErrorCount());
+			GC_CheckError error(puddle, objectIndirect, _cycle, _currentCheck, J9MODRON_GCCHK_RC_NOT_FOUND, nextErrorCount());
 			_reporter->report(&error);
 			return J9MODRON_SLOT_ITERATOR_OK;
 		}
@@ -1202,14 +1217,14 @@ GC_CheckEngine::checkSlotRememberedSet(J9JavaVM *javaVM, J9Object **objectIndire
 		UDATA regionType = ((MM_HeapRegionDescriptor*)objectRegion.id)->getTypeFlags();
 
 		if (regionType & MEMORY_TYPE_NEW) {
-			GC_CheckError error(puddle, objectIndirect, _cycle, _currentCheck, J9MODRON_GCCHK_RC_REMEMBERED_SET_WRONG_SEGMENT, _cycle->nextErrorCount());
+			GC_CheckError error(puddle, objectIndirect, _cycle, _currentCheck, J9MODRON_GCCHK_RC_REMEMBERED_SET_WRONG_SEGMENT, nextErrorCount());
 			_reporter->report(&error);
 			return J9MODRON_SLOT_ITERATOR_OK;
 		}
 
 		/* content of Remembered Set should be Old and Remembered */
 		if ( !(extensions->isOld(objectPtr) && extensions->objectModel.isRemembered(objectPtr))) {
-			GC_CheckError error(puddle, objectIndirect, _cycle, _currentCheck, J9MODRON_GCCHK_RC_REMEMBERED_SET_FLAGS, _cycle->nextErrorCount());
+			GC_CheckError error(puddle, objectIndirect, _cycle, _currentCheck, J9MODRON_GCCHK_RC_REMEMBERED_SET_FLAGS, nextErrorCount());
 			_reporter->report(&error);
 			_reporter->reportObjectHeader(&error, objectPtr, NULL);
 			return J9MODRON_SLOT_ITERATOR_OK;
@@ -1234,7 +1249,7 @@ GC_CheckEngine::checkSlotUnfinalizedList(J9JavaVM *javaVM, J9Object **objectIndi
 
 	UDATA result = checkObjectIndirect(javaVM, objectPtr);
 	if (J9MODRON_GCCHK_RC_OK != result) {
-		GC_CheckError error(currentList, objectIndirect, _cycle, _currentCheck, result, _cycle->nextErrorCount());
+		GC_CheckError error(currentList, objectIndirect, _cycle, _currentCheck, result, nextErrorCount());
 		_reporter->report(&error);
 		return J9MODRON_SLOT_ITERATOR_OK;
 	}
@@ -1252,12 +1267,12 @@ GC_CheckEngine::checkSlotOwnableSynchronizerList(J9JavaVM *javaVM, J9Object **ob
 
 	UDATA result = checkObjectIndirect(javaVM, objectPtr);
 	if (J9MODRON_GCCHK_RC_OK != result) {
-		GC_CheckError error(currentList, objectIndirect, _cycle, _currentCheck, result, _cycle->nextErrorCount());
+		GC_CheckError error(currentList, objectIndirect, _cycle, _currentCheck, result, nextErrorCount());
 		_reporter->report(&error);
 	} else {
 		J9Class *instanceClass = J9GC_J9OBJECT_CLAZZ_VM(objectPtr, javaVM);
 		if (0 == (J9CLASS_FLAGS(instanceClass) & J9AccClassOwnableSynchronizer)) {
-			GC_CheckError error(currentList, objectIndirect, _cycle, _currentCheck, J9MODRON_GCCHK_RC_INVALID_FLAGS, _cycle->nextErrorCount());
+			GC_CheckError error(currentList, objectIndirect, _cycle, _currentCheck, J9MODRON_GCCHK_RC_INVALID_FLAGS, nextErrorCount());
 			_reporter->report(&error);
 		}
 		J9VMThread* currentThread = javaVM->internalVMFunctions->currentVMThread(javaVM);
@@ -1267,7 +1282,7 @@ GC_CheckEngine::checkSlotOwnableSynchronizerList(J9JavaVM *javaVM, J9Object **ob
 		J9Class* castClass = javaVM->internalVMFunctions->internalFindClassUTF8(currentThread, (U_8*) aosClassName, strlen(aosClassName), classLoader, J9_FINDCLASS_FLAG_EXISTING_ONLY);
 		if (NULL != castClass) {
 			if (0 == instanceOfOrCheckCast(instanceClass, castClass)) {
-				GC_CheckError error(currentList, objectIndirect, _cycle, _currentCheck, J9MODRON_GCCHK_RC_OWNABLE_SYNCHRONIZER_INVALID_CLASS, _cycle->nextErrorCount());
+				GC_CheckError error(currentList, objectIndirect, _cycle, _currentCheck, J9MODRON_GCCHK_RC_OWNABLE_SYNCHRONIZER_INVALID_CLASS, nextErrorCount());
 				_reporter->report(&error);
 			}
 		}
@@ -1290,7 +1305,7 @@ GC_CheckEngine::checkSlotFinalizableList(J9JavaVM *javaVM, J9Object **objectIndi
 
 	UDATA result = checkObjectIndirect(javaVM, objectPtr);
 	if (J9MODRON_GCCHK_RC_OK != result) {
-		GC_CheckError error(listManager, objectIndirect, _cycle, _currentCheck, result, _cycle->nextErrorCount());
+		GC_CheckError error(listManager, objectIndirect, _cycle, _currentCheck, result, nextErrorCount());
 		_reporter->report(&error);
 		return J9MODRON_SLOT_ITERATOR_OK;
 	}
@@ -1346,6 +1361,31 @@ GC_CheckEngine::startNewCheck(GC_Check *check)
 	clearPreviousObjects();
 }
 
+/**
+ * Prepare this engine to check part of the object heap on behalf of engine, which is running the
+ * current check. Unlike @ref startCheckCycle this doesn't trigger the heap walk hooks, which engine
+ * has already done. Errors are reported to this engine's reporter and numbered independently,
+ * see @ref nextErrorCount.
+ *
+ * @param engine The engine running the check cycle
+ */
+void
+GC_CheckEngine::startWorkerCheck(GC_CheckEngine *engine)
+{
+	_isWorker = true;
+	_workerErrorCount = 0;
+	_cycle = engine->_cycle;
+	_currentCheck = engine->_currentCheck;
+#if defined(J9VM_GC_MODRON_SCAVENGER)
+	_scavengerBackout = engine->_scavengerBackout;
+	_rsOverflowState = engine->_rsOverflowState;
+#endif /* J9VM_GC_MODRON_SCAVENGER */
+	clearPreviousObjects();
+	clearRegionDescription(&_regionDesc);
+	clearCheckedCache();
+	clearCountsForOwnableSynchronizerObjects();
+}
+
 /**
  * Ensure the GC internal scope pointers refer to objects within the scope.
  *
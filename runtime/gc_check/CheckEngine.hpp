@@ -76,6 +76,8 @@ private:
 	#define UNINITIALIZED_SIZE_FOR_OWNABLESYNCHRONIER ((UDATA)-1)
 	UDATA	_ownableSynchronizerObjectCountOnList; /**< the count of ownableSynchronizerObjects on the ownableSynchronizerLists, =UNINITIALIZED_SIZE_FOR_OWNABLESYNCHRONIER indicates that the count has not been calculated */
 	UDATA	_ownableSynchronizerObjectCountOnHeap; /**< the count of ownableSynchronizerObjects on the heap, =UNINITIALIZED_SIZE_FOR_OWNABLESYNCHRONIER indicates that the count has not been calculated */
+	bool _isWorker; /**< true if this engine checks part of the heap on behalf of another engine (see @ref startWorkerCheck) */
+	UDATA _workerErrorCount; /**< Number of errors found by a worker engine, numbered again when its reports are merged */
 	
 protected:
 
@@ -123,6 +125,7 @@ protected:
 
 public:
 	MMINLINE J9JavaVM *getJavaVM() { return _javaVM; };
+	MMINLINE GC_CheckCycle *getCheckCycle() { return _cycle; };
 
 	void clearPreviousObjects();
 	void pushPreviousObject(J9Object *objectPtr);
@@ -132,6 +135,17 @@ public:
 	bool verifyOwnableSynchronizerObjectCounts();
 	MMINLINE void initializeOwnableSynchronizerCountOnList() { _ownableSynchronizerObjectCountOnList = 0; };
 	MMINLINE void initializeOwnableSynchronizerCountOnHeap() { _ownableSynchronizerObjectCountOnHeap = 0; };
+	MMINLINE UDATA getOwnableSynchronizerCountOnHeap() { return _ownableSynchronizerObjectCountOnHeap; };
+	MMINLINE void addOwnableSynchronizerCountOnHeap(UDATA count) { _ownableSynchronizerObjectCountOnHeap += count; };
+
+	/**
+	 * Number the next error found. A worker engine numbers its own errors, since the cycle
+	 * numbers them in heap order when the reports of all the workers are merged.
+	 */
+	MMINLINE UDATA nextErrorCount() { return _isWorker ? ++_workerErrorCount : _cycle->nextErrorCount(); };
+	MMINLINE GC_CheckReporter *getReporter() { return _reporter; };
+
+	static bool isHoleSizeValid(J9MM_IterateObjectDescriptor *objectDesc, J9MM_IterateRegionDescriptor *regionDesc);
 
 	UDATA checkObjectHeap(J9JavaVM *javaVM, J9MM_IterateObjectDescriptor *objectDesc, J9MM_IterateRegionDescriptor *regionDesc);
 	UDATA checkSlotObjectHeap(J9JavaVM *javaVM, J9Object *objectPtr, fj9object_t *objectIndirect, J9MM_IterateRegionDescriptor *regionDesc, J9Object *objectIndirectBase);
@@ -161,6 +175,7 @@ public:
 	void startCheckCycle(J9JavaVM *javaVM, GC_CheckCycle *checkCycle);
 	void endCheckCycle(J9JavaVM *javaVM);
 	void startNewCheck(GC_Check *check);	
+	void startWorkerCheck(GC_CheckEngine *engine);
 	bool isStackDumpAlwaysDisplayed();
 	void copyRegionDescription(J9MM_IterateRegionDescriptor* from, J9MM_IterateRegionDescriptor* to);
 	void clearRegionDescription(J9MM_IterateRegionDescriptor* toClear);
@@ -184,6 +199,8 @@ public:
 		, _lastHeapObject3()
 		, _ownableSynchronizerObjectCountOnList(UNINITIALIZED_SIZE_FOR_OWNABLESYNCHRONIER)
 		, _ownableSynchronizerObjectCountOnHeap(UNINITIALIZED_SIZE_FOR_OWNABLESYNCHRONIER)
+		, _isWorker(false)
+		, _workerErrorCount(0)
 #if defined(J9VM_GC_MODRON_SCAVENGER)	
 		, _scavengerBackout(false)
 		, _rsOverflowState(false)
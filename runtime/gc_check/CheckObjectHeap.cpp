@@ -20,13 +20,56 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include <string.h>
+
+#include "CheckCycle.hpp"
 #include "CheckEngine.hpp"
 #include "CheckObjectHeap.hpp"
+#include "CheckReporterBuffered.hpp"
+#include "EnvironmentBase.hpp"
+#include "HeapRegionDescriptor.hpp"
 #include "MemorySubSpace.hpp"
 #include "ModronTypes.hpp"
+#include "ObjectHeapBufferedIterator.hpp"
+#include "ObjectModel.hpp"
+#include "ParallelDispatcher.hpp"
+#include "ParallelTask.hpp"
 #include "ScanFormatter.hpp"
 #include "HeapIteratorAPI.h"
 
+/**
+ * A sample unit selected for a parallel check.
+ */
+typedef struct ObjectHeapCheckUnit {
+	J9MM_IterateRegionDescriptor regionDesc; /* Input - the region containing the unit */
+	void *base; /* Input - the first object or hole of the unit */
+	void *top; /* Input - the end of the unit */
+	J9Object *previousObjects[3]; /* Input - the objects walked before base, oldest first (NULL if none), reported as context for heap walk errors */
+	bool aborted; /* Output - true if a heap walk error stopped the check of the unit */
+	UDATA ownableSynchronizerCount; /* Output - number of ownable synchronizers found in the unit */
+} ObjectHeapCheckUnit;
+
+/**
+ * The sample units selected for a parallel check, collected by a serial walk of the heap.
+ */
+typedef struct ObjectHeapCheckUnitList {
+	MM_Forge *forge;
+	ObjectHeapCheckUnit *units; /* the units, in heap order */
+	UDATA count; /* number of units collected */
+	UDATA capacity; /* number of units the units array can hold */
+	bool unitOpen; /* true if the end of the last unit has not been found yet */
+	bool failed; /* true if the units array could not be grown */
+	J9Object *previousObjects[3]; /* the last objects walked in checked units, oldest first */
+} ObjectHeapCheckUnitList;
+
+/**
+ * The context of a worker thread of a parallel check.
+ */
+typedef struct ObjectHeapCheckWorker {
+	GC_CheckEngine *engine; /* the engine checking units on behalf of the engine running the cycle */
+	GC_CheckReporterBuffered *reporter; /* the reporter of engine, recording errors until they are merged */
+} ObjectHeapCheckWorker;
+
 /**
  * Private struct used as the user data for the iterator callbacks. The regionDesc will get set
  * by the region iterator callback.
@@ -34,7 +77,13 @@
 typedef struct ObjectIteratorCallbackUserData {
 	GC_CheckEngine* engine; /* Input */
 	J9PortLibrary* portLibrary; /* Input */
+	UDATA samplePercent; /* Input - percentage of sample units to check */
+	ObjectHeapCheckUnitList *unitList; /* Input - if not NULL, the units to check are collected here for a parallel check instead of being checked */
+	U_32 sampleSeed; /* Input/Output - state of the unit sampling generator */
+	bool unitSkipped; /* Output - true if any sample unit was not checked */
 	J9MM_IterateRegionDescriptor* regionDesc; /* Temp - used internally by iterator functions */
+	UDATA unitTop; /* Temp - an object at or above this address starts a new sample unit */
+	bool unitSampled; /* Temp - true if the current sample unit is checked */
 } ObjectIteratorCallbackUserData;
 
 /**
@@ -44,6 +93,61 @@ static jvmtiIterationControl check_heapIteratorCallback(J9JavaVM* vm, J9MM_Itera
 static jvmtiIterationControl check_spaceIteratorCallback(J9JavaVM* vm, J9MM_IterateSpaceDescriptor* spaceDesc, void* userData);
 static jvmtiIterationControl check_regionIteratorCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDesc, void* userData);
 static jvmtiIterationControl check_objectIteratorCallback(J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectDesc, void* userData);
+static jvmtiIterationControl check_unitIteratorCallback(J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectDesc, void* userData);
+
+static bool startSampleUnit(ObjectIteratorCallbackUserData* userData, J9MM_IterateObjectDescriptor* objectDesc);
+static bool openUnit(ObjectHeapCheckUnitList *unitList, GC_CheckEngine *engine, J9MM_IterateRegionDescriptor *regionDesc, void *base, bool hasPreviousObjects);
+static void closeUnit(ObjectHeapCheckUnitList *unitList, void *top);
+static void checkUnit(J9JavaVM *javaVM, MM_GCExtensions *extensions, ObjectHeapCheckWorker *worker, ObjectHeapCheckUnit *unit, UDATA index);
+
+/**
+ * Check the sample units collected by GC_CheckObjectHeap::checkParallel() on the GC worker threads.
+ */
+class GC_CheckObjectHeapTask : public MM_ParallelTask
+{
+	/* Data Members */
+private:
+	GC_CheckEngine *_engine; /**< The engine running the check cycle */
+	ObjectHeapCheckWorker *_workers; /**< The context of each worker thread, indexed by worker ID */
+	ObjectHeapCheckUnit *_units; /**< The units to check */
+	UDATA _unitCount; /**< The number of units to check */
+	UDATA _vmState; /**< The VM state of the thread running the check cycle */
+protected:
+public:
+
+	/* Member Functions */
+private:
+protected:
+public:
+	virtual UDATA getVMStateID(void) { return _vmState; }
+	virtual void run(MM_EnvironmentBase *env);
+
+	GC_CheckObjectHeapTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, GC_CheckEngine *engine, ObjectHeapCheckWorker *workers, ObjectHeapCheckUnit *units, UDATA unitCount)
+		: MM_ParallelTask(env, dispatcher)
+		, _engine(engine)
+		, _workers(workers)
+		, _units(units)
+		, _unitCount(unitCount)
+		, _vmState(env->getOmrVMThread()->vmState)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+void
+GC_CheckObjectHeapTask::run(MM_EnvironmentBase *env)
+{
+	J9JavaVM *javaVM = _engine->getJavaVM();
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env);
+	ObjectHeapCheckWorker *worker = &_workers[env->getWorkerID()];
+
+	worker->engine->startWorkerCheck(_engine);
+	for (UDATA index = 0; index < _unitCount; index++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			checkUnit(javaVM, extensions, worker, &_units[index], index);
+		}
+	}
+}
 
 GC_Check *
 GC_CheckObjectHeap::newInstance(J9JavaVM *javaVM, GC_CheckEngine *engine)
@@ -66,20 +170,189 @@ GC_CheckObjectHeap::kill()
 
 void
 GC_CheckObjectHeap::check()
+{
+	if (!shouldCheckInParallel() || !checkParallel()) {
+		checkSerial();
+	}
+}
+
+void
+GC_CheckObjectHeap::print()
+{
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+	j9tty_printf(PORTLIB, "Printing of the object heap is supported through -Xtgc:terse\n");
+}
+
+/**
+ * The GC worker threads can only be used when the check is run in-process by the thread
+ * running a GC, outside of any parallel task. Checks run from the debugger, on manual
+ * invocations and in the middle of a scavenge walk the heap serially.
+ *
+ * @return true if the heap should be checked by the GC worker threads
+ */
+bool
+GC_CheckObjectHeap::shouldCheckInParallel()
+{
+	GC_CheckCycle *cycle = _engine->getCheckCycle();
+	MM_ParallelDispatcher *dispatcher = _extensions->dispatcher;
+
+	switch (cycle->getInvoker()) {
+	case invocation_global_start:
+	case invocation_global_end:
+	case invocation_local_start:
+	case invocation_local_end:
+		break;
+	default:
+		return false;
+	}
+
+	if ((0 != (cycle->getMiscFlags() & J9MODRON_GCCHK_MISC_MIDSCAVENGE)) || _extensions->isMetronomeGC()) {
+		return false;
+	}
+
+	if ((NULL == dispatcher) || (dispatcher->threadCountMaximum() < 2)) {
+		return false;
+	}
+
+	J9VMThread *vmThread = _javaVM->internalVMFunctions->currentVMThread(_javaVM);
+	return (NULL != vmThread) && (NULL == MM_EnvironmentBase::getEnvironment(vmThread->omrVMThread)->_currentTask);
+}
+
+/**
+ * Walk the heap on the current thread, checking the objects of the sampled units as they are found.
+ */
+void
+GC_CheckObjectHeap::checkSerial()
 {
 	/* Check by using the HeapIteratorAPI */
 	ObjectIteratorCallbackUserData userData;
 	userData.engine = _engine;
 	userData.portLibrary = _portLibrary;
+	userData.samplePercent = _engine->getCheckCycle()->getSamplePercent();
+	userData.unitList = NULL;
+	userData.sampleSeed = _sampleSeed;
+	userData.unitSkipped = false;
 	userData.regionDesc = NULL;
+	userData.unitTop = 0;
+	userData.unitSampled = true;
 	_javaVM->memoryManagerFunctions->j9mm_iterate_heaps(_javaVM, _portLibrary, 0, check_heapIteratorCallback, &userData);
+	_sampleSeed = userData.sampleSeed;
+
+	if (userData.unitSkipped) {
+		/* ownable synchronizers found by a partial walk can't be compared against the complete lists */
+		_engine->clearCountsForOwnableSynchronizerObjects();
+	}
 }
 
-void
-GC_CheckObjectHeap::print()
+/**
+ * Collect the sampled units with a walk of the heap which only visits object headers, check them
+ * on the GC worker threads, and merge the errors found in heap order. The errors are reported and
+ * numbered exactly as a serial walk would: each unit is walked by a worker engine which starts with
+ * the previous objects the serial walk would have, and since a serial walk stops checking a region
+ * at its first heap walk error, whatever was found past such an error in the same region is dropped.
+ *
+ * @return false if the workers could not be allocated, in which case nothing was checked
+ */
+bool
+GC_CheckObjectHeap::checkParallel()
 {
-	PORT_ACCESS_FROM_PORT(_portLibrary);
-	j9tty_printf(PORTLIB, "Printing of the object heap is supported through -Xtgc:terse\n");
+	MM_ParallelDispatcher *dispatcher = _extensions->dispatcher;
+	MM_Forge *forge = _extensions->getForge();
+	UDATA workerCount = dispatcher->threadCountMaximum();
+	bool result = false;
+
+	ObjectHeapCheckWorker *workers = (ObjectHeapCheckWorker *)forge->allocate(workerCount * sizeof(ObjectHeapCheckWorker), MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+	if (NULL == workers) {
+		return false;
+	}
+	memset(workers, 0, workerCount * sizeof(ObjectHeapCheckWorker));
+
+	bool workersAllocated = true;
+	for (UDATA i = 0; i < workerCount; i++) {
+		GC_CheckReporterBuffered *reporter = GC_CheckReporterBuffered::newInstance(_javaVM);
+		if (NULL == reporter) {
+			workersAllocated = false;
+			break;
+		}
+		/* the engine owns its reporter from now on */
+		GC_CheckEngine *engine = GC_CheckEngine::newInstance(_javaVM, reporter);
+		if (NULL == engine) {
+			reporter->kill();
+			workersAllocated = false;
+			break;
+		}
+		workers[i].engine = engine;
+		workers[i].reporter = reporter;
+	}
+
+	if (workersAllocated) {
+		ObjectHeapCheckUnitList unitList;
+		memset(&unitList, 0, sizeof(unitList));
+		unitList.forge = forge;
+
+		ObjectIteratorCallbackUserData userData;
+		userData.engine = _engine;
+		userData.portLibrary = _portLibrary;
+		userData.samplePercent = _engine->getCheckCycle()->getSamplePercent();
+		userData.unitList = &unitList;
+		userData.sampleSeed = _sampleSeed;
+		userData.unitSkipped = false;
+		userData.regionDesc = NULL;
+		userData.unitTop = 0;
+		userData.unitSampled = true;
+		_javaVM->memoryManagerFunctions->j9mm_iterate_heaps(_javaVM, _portLibrary, 0, check_heapIteratorCallback, &userData);
+
+		if (!unitList.failed) {
+			J9VMThread *vmThread = _javaVM->internalVMFunctions->currentVMThread(_javaVM);
+			MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(vmThread->omrVMThread);
+			GC_CheckObjectHeapTask checkTask(env, dispatcher, _engine, workers, unitList.units, unitList.count);
+			dispatcher->run(env, &checkTask);
+
+			GC_CheckReporter *reporter = _engine->getReporter();
+			GC_CheckCycle *cycle = _engine->getCheckCycle();
+			UDATA abortedRegion = 0;
+			for (UDATA index = 0; index < unitList.count; index++) {
+				ObjectHeapCheckUnit *unit = &unitList.units[index];
+				bool discard = (abortedRegion == unit->regionDesc.id);
+				for (UDATA i = 0; i < workerCount; i++) {
+					workers[i].reporter->replayUnit(index, discard ? NULL : reporter, cycle);
+				}
+				if (!discard) {
+					_engine->addOwnableSynchronizerCountOnHeap(unit->ownableSynchronizerCount);
+					if (unit->aborted) {
+						abortedRegion = unit->regionDesc.id;
+					}
+				}
+			}
+
+			for (UDATA i = 0; i < workerCount; i++) {
+				if (workers[i].reporter->hasOverflowed()) {
+					reporter->reportMessage("  <gc check: some errors found by the parallel heap walk could not be recorded>\n");
+					break;
+				}
+			}
+
+			_sampleSeed = userData.sampleSeed;
+			if (userData.unitSkipped) {
+				/* ownable synchronizers found by a partial walk can't be compared against the complete lists */
+				_engine->clearCountsForOwnableSynchronizerObjects();
+			}
+			result = true;
+		}
+
+		if (NULL != unitList.units) {
+			forge->free(unitList.units);
+		}
+	}
+
+	for (UDATA i = 0; i < workerCount; i++) {
+		if (NULL != workers[i].engine) {
+			workers[i].engine->kill();
+		}
+	}
+	forge->free(workers);
+
+	return result;
 }
 
 static jvmtiIterationControl
@@ -102,8 +375,16 @@ static jvmtiIterationControl
 check_regionIteratorCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDesc, void* userData)
 {
 	ObjectIteratorCallbackUserData* castUserData = (ObjectIteratorCallbackUserData*)userData;
+	ObjectHeapCheckUnitList *unitList = castUserData->unitList;
 	castUserData->regionDesc = regionDesc;
-	vm->memoryManagerFunctions->j9mm_iterate_region_objects(vm, castUserData->portLibrary, regionDesc, j9mm_iterator_flag_include_holes, check_objectIteratorCallback, castUserData);
+	/* the first object of each region starts a new sample unit */
+	castUserData->unitTop = 0;
+	if (NULL == unitList) {
+		vm->memoryManagerFunctions->j9mm_iterate_region_objects(vm, castUserData->portLibrary, regionDesc, j9mm_iterator_flag_include_holes, check_objectIteratorCallback, castUserData);
+	} else if (!unitList->failed) {
+		vm->memoryManagerFunctions->j9mm_iterate_region_objects(vm, castUserData->portLibrary, regionDesc, j9mm_iterator_flag_include_holes, check_unitIteratorCallback, castUserData);
+		closeUnit(unitList, (void *)((UDATA)regionDesc->regionStart + regionDesc->regionSize));
+	}
 	return JVMTI_ITERATION_CONTINUE;
 }
 
@@ -111,10 +392,184 @@ static jvmtiIterationControl
 check_objectIteratorCallback(J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectDesc, void* userData)
 {
 	ObjectIteratorCallbackUserData* castUserData = (ObjectIteratorCallbackUserData*)userData;
-	if (castUserData->engine->checkObjectHeap(vm, objectDesc, castUserData->regionDesc) != J9MODRON_SLOT_ITERATOR_OK) {
+	if (startSampleUnit(castUserData, objectDesc) && !castUserData->unitSampled) {
+		/* the previous objects are reported as context for heap walk errors, so don't carry them across a gap */
+		castUserData->engine->clearPreviousObjects();
+	}
+
+	if (castUserData->unitSampled) {
+		if (castUserData->engine->checkObjectHeap(vm, objectDesc, castUserData->regionDesc) != J9MODRON_SLOT_ITERATOR_OK) {
+			return JVMTI_ITERATION_ABORT;
+		}
+		castUserData->engine->pushPreviousObject(objectDesc->object);
+	} else if (!objectDesc->isObject) {
+		/* holes are checked even in skipped units, since the walk can't advance past a malformed one */
+		if (castUserData->engine->checkObjectHeap(vm, objectDesc, castUserData->regionDesc) != J9MODRON_SLOT_ITERATOR_OK) {
+			return JVMTI_ITERATION_ABORT;
+		}
+	}
+	return JVMTI_ITERATION_CONTINUE;
+}
+
+/**
+ * Collect the sampled units of a region for a parallel check. The units are chosen exactly as
+ * check_objectIteratorCallback() chooses them, and the previous objects of the serial walk are
+ * tracked so that each unit can report them.
+ */
+static jvmtiIterationControl
+check_unitIteratorCallback(J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectDesc, void* userData)
+{
+	ObjectIteratorCallbackUserData* castUserData = (ObjectIteratorCallbackUserData*)userData;
+	ObjectHeapCheckUnitList *unitList = castUserData->unitList;
+
+	if (startSampleUnit(castUserData, objectDesc)) {
+		closeUnit(unitList, objectDesc->object);
+		if (castUserData->unitSampled) {
+			if (!openUnit(unitList, castUserData->engine, castUserData->regionDesc, objectDesc->object, true)) {
+				return JVMTI_ITERATION_ABORT;
+			}
+		} else {
+			memset(unitList->previousObjects, 0, sizeof(unitList->previousObjects));
+		}
+	}
+
+	if (!objectDesc->isObject && !GC_CheckEngine::isHoleSizeValid(objectDesc, castUserData->regionDesc)) {
+		/* the walk can't advance past this hole: the worker checking the unit reaches it and reports it */
+		if (!castUserData->unitSampled) {
+			/* as in a serial walk, the hole itself is checked even though its unit is skipped */
+			openUnit(unitList, castUserData->engine, castUserData->regionDesc, objectDesc->object, false);
+		}
 		return JVMTI_ITERATION_ABORT;
 	}
-	
-	castUserData->engine->pushPreviousObject(objectDesc->object);
+
+	if (castUserData->unitSampled) {
+		unitList->previousObjects[0] = unitList->previousObjects[1];
+		unitList->previousObjects[1] = unitList->previousObjects[2];
+		unitList->previousObjects[2] = objectDesc->object;
+	}
 	return JVMTI_ITERATION_CONTINUE;
 }
+
+/**
+ * Determine whether an object starts a new sample unit and, if it does, whether the unit is checked.
+ *
+ * @return true if objectDesc starts a new sample unit
+ */
+static bool
+startSampleUnit(ObjectIteratorCallbackUserData* userData, J9MM_IterateObjectDescriptor* objectDesc)
+{
+	if ((UDATA)objectDesc->object < userData->unitTop) {
+		return false;
+	}
+
+	userData->unitTop = (UDATA)objectDesc->object + GC_CheckObjectHeap::SAMPLE_UNIT_SIZE;
+	userData->unitSampled = true;
+	if (userData->samplePercent < 100) {
+		/* linear congruential generator: cheap, and deterministic for a given sequence of cycles */
+		userData->sampleSeed = (userData->sampleSeed * 1103515245) + 12345;
+		if (((userData->sampleSeed >> 16) % 100) >= userData->samplePercent) {
+			userData->unitSampled = false;
+			userData->unitSkipped = true;
+		}
+	}
+	return true;
+}
+
+/**
+ * Append a unit starting at base to the list. Its end is set by the next call to closeUnit().
+ *
+ * @param hasPreviousObjects false if the unit is checked without previous objects
+ * @return false if the list could not be grown
+ */
+static bool
+openUnit(ObjectHeapCheckUnitList *unitList, GC_CheckEngine *engine, J9MM_IterateRegionDescriptor *regionDesc, void *base, bool hasPreviousObjects)
+{
+	if (unitList->count == unitList->capacity) {
+		UDATA newCapacity = (0 == unitList->capacity) ? 64 : (unitList->capacity * 2);
+		ObjectHeapCheckUnit *newUnits = (ObjectHeapCheckUnit *)unitList->forge->allocate(newCapacity * sizeof(ObjectHeapCheckUnit), MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+		if (NULL == newUnits) {
+			unitList->failed = true;
+			return false;
+		}
+		if (NULL != unitList->units) {
+			memcpy(newUnits, unitList->units, unitList->count * sizeof(ObjectHeapCheckUnit));
+			unitList->forge->free(unitList->units);
+		}
+		unitList->units = newUnits;
+		unitList->capacity = newCapacity;
+	}
+
+	ObjectHeapCheckUnit *unit = &unitList->units[unitList->count];
+	engine->copyRegionDescription(regionDesc, &unit->regionDesc);
+	unit->base = base;
+	unit->top = NULL;
+	if (hasPreviousObjects) {
+		memcpy(unit->previousObjects, unitList->previousObjects, sizeof(unit->previousObjects));
+	} else {
+		memset(unit->previousObjects, 0, sizeof(unit->previousObjects));
+	}
+	unit->aborted = false;
+	unit->ownableSynchronizerCount = 0;
+	unitList->count += 1;
+	unitList->unitOpen = true;
+	return true;
+}
+
+/**
+ * Set the end of the last unit of the list, if it is not set yet.
+ */
+static void
+closeUnit(ObjectHeapCheckUnitList *unitList, void *top)
+{
+	if (unitList->unitOpen) {
+		unitList->units[unitList->count - 1].top = top;
+		unitList->unitOpen = false;
+	}
+}
+
+/**
+ * Check the objects of a unit on a GC worker thread. Objects and holes are described exactly as
+ * j9mm_iterate_region_objects() describes them when holes are included.
+ */
+static void
+checkUnit(J9JavaVM *javaVM, MM_GCExtensions *extensions, ObjectHeapCheckWorker *worker, ObjectHeapCheckUnit *unit, UDATA index)
+{
+	GC_CheckEngine *engine = worker->engine;
+
+	worker->reporter->setCurrentUnit(index);
+	engine->clearPreviousObjects();
+	for (UDATA i = 0; i < 3; i++) {
+		if (NULL != unit->previousObjects[i]) {
+			engine->pushPreviousObject(unit->previousObjects[i]);
+		}
+	}
+	engine->initializeOwnableSynchronizerCountOnHeap();
+
+	/* walk one object at a time, so that a malformed hole is checked before the walk tries to step over it */
+	MM_HeapRegionDescriptor *region = (MM_HeapRegionDescriptor *)unit->regionDesc.id;
+	GC_ObjectHeapBufferedIterator objectHeapIterator(extensions, region, unit->base, unit->top, true, 1);
+	J9Object *object = NULL;
+	while (NULL != (object = objectHeapIterator.nextObject())) {
+		J9MM_IterateObjectDescriptor objectDesc;
+		if (extensions->objectModel.isDeadObject(object)) {
+			objectDesc.id = (UDATA)object;
+			objectDesc.object = object;
+			objectDesc.size = extensions->objectModel.getSizeInBytesDeadObject(object);
+			objectDesc.isObject = FALSE;
+		} else {
+			javaVM->memoryManagerFunctions->j9mm_initialize_object_descriptor(javaVM, &objectDesc, object);
+			if (0 != (J9CLASS_FLAGS(J9GC_J9OBJECT_CLAZZ_VM(object, javaVM)) & J9AccClassDying)) {
+				/* this object is not marked as a hole, but its class has been partially unloaded so it's treated like a hole here */
+				objectDesc.isObject = FALSE;
+			}
+		}
+
+		if (J9MODRON_SLOT_ITERATOR_OK != engine->checkObjectHeap(javaVM, &objectDesc, &unit->regionDesc)) {
+			unit->aborted = true;
+			break;
+		}
+		engine->pushPreviousObject(object);
+	}
+
+	unit->ownableSynchronizerCount = engine->getOwnableSynchronizerCountOnHeap();
+}
@@ -34,14 +34,29 @@
 #include "Check.hpp"
 
 /**
- * 
+ * Check the objects of the heap.
+ *
+ * The heap is divided into sample units of about SAMPLE_UNIT_SIZE bytes, each starting at an object
+ * or hole, and samplepercent=X checks only X% of these units in each cycle. When invoked in-process
+ * by a GC, the units are checked in parallel by the GC worker threads, and the errors they find are
+ * reported in heap order once all the units have been checked. Otherwise, and when the resources for
+ * the workers can't be allocated, the heap is walked serially.
  */
 class GC_CheckObjectHeap : public GC_Check
 {
+public:
+	enum { SAMPLE_UNIT_SIZE = 256 * 1024 }; /**< Minimum size of a sample unit; a unit ends at the first object at least this far from its start, or at the end of its region */
+
 private:
+	U_32 _sampleSeed; /**< State of the generator choosing which sample units to check, carried across cycles so that each cycle checks a different subset */
+
 	virtual void check(); /**< run the check */
 	virtual void print(); /**< dump the check structure to tty */
 
+	bool shouldCheckInParallel();
+	bool checkParallel();
+	void checkSerial();
+
 public:
 	static GC_Check *newInstance(J9JavaVM *javaVM, GC_CheckEngine *engine);
 	virtual void kill();
@@ -50,6 +65,7 @@ public:
 
 	GC_CheckObjectHeap(J9JavaVM *javaVM, GC_CheckEngine *engine) :
 		GC_Check(javaVM, engine)
+		, _sampleSeed(1)
 	{}
 };
 
@@ -44,3 +44,10 @@ GC_CheckReporter::reportGenericType(GC_CheckError *error, GC_CheckElement refere
 			break;
 	}	
 }
+
+void
+GC_CheckReporter::reportMessage(const char *message)
+{
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+	j9tty_printf(PORTLIB, "%s", message);
+}
@@ -91,6 +91,11 @@ public:
 	 */
 	virtual void reportClass(GC_CheckError *error, J9Class *clazz, const char *prefix) = 0;
 
+	/**
+	 * Report a diagnostic message which is not attached to an error.
+	 */
+	virtual void reportMessage(const char *message);
+
 	/**
 	 * Report the fact that a fatal error has occurred.
 	 */
@@ -0,0 +1,187 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Check
+ */
+
+#include <string.h>
+
+#include "CheckReporterBuffered.hpp"
+
+#include "CheckCycle.hpp"
+#include "GCExtensions.hpp"
+
+/**
+ * Create a new instance of the buffered reporter.
+ */
+GC_CheckReporterBuffered *
+GC_CheckReporterBuffered::newInstance(J9JavaVM *javaVM)
+{
+	MM_Forge *forge = MM_GCExtensions::getExtensions(javaVM)->getForge();
+
+	GC_CheckReporterBuffered *reporter = (GC_CheckReporterBuffered *)forge->allocate(sizeof(GC_CheckReporterBuffered), MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+	if (NULL != reporter) {
+		reporter = new(reporter) GC_CheckReporterBuffered(javaVM);
+	}
+	return reporter;
+}
+
+/**
+ * Destroy the instance of the reporter, along with any reports which were not replayed.
+ */
+void
+GC_CheckReporterBuffered::kill()
+{
+	MM_Forge *forge = MM_GCExtensions::getExtensions(_javaVM)->getForge();
+	if (NULL != _reports) {
+		forge->free(_reports);
+	}
+	forge->free(this);
+}
+
+/**
+ * Append a report to the buffer, growing it as required.
+ */
+void
+GC_CheckReporterBuffered::record(GC_CheckBufferedReport::ReportType type, GC_CheckError *error, void *pointer, const char *prefix)
+{
+	if (_reportCount == _reportCapacity) {
+		MM_Forge *forge = MM_GCExtensions::getExtensions(_javaVM)->getForge();
+		UDATA newCapacity = (0 == _reportCapacity) ? 16 : (_reportCapacity * 2);
+		GC_CheckBufferedReport *newReports = (GC_CheckBufferedReport *)forge->allocate(newCapacity * sizeof(GC_CheckBufferedReport), MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+		if (NULL == newReports) {
+			_overflow = true;
+			return;
+		}
+		for (UDATA i = 0; i < _reportCount; i++) {
+			new(&newReports[i]) GC_CheckBufferedReport(_reports[i]);
+		}
+		if (NULL != _reports) {
+			forge->free(_reports);
+		}
+		_reports = newReports;
+		_reportCapacity = newCapacity;
+	}
+
+	GC_CheckBufferedReport *buffered = new(&_reports[_reportCount]) GC_CheckBufferedReport(type, _currentUnit, error);
+	buffered->_pointer = pointer;
+	buffered->_prefix = prefix;
+	_reportCount += 1;
+}
+
+void
+GC_CheckReporterBuffered::report(GC_CheckError *error)
+{
+	record(GC_CheckBufferedReport::report_error, error, NULL, NULL);
+}
+
+void
+GC_CheckReporterBuffered::reportObjectHeader(GC_CheckError *error, J9Object *objectPtr, const char *prefix)
+{
+	record(GC_CheckBufferedReport::report_object_header, error, objectPtr, prefix);
+}
+
+void
+GC_CheckReporterBuffered::reportClass(GC_CheckError *error, J9Class *clazz, const char *prefix)
+{
+	record(GC_CheckBufferedReport::report_class, error, clazz, prefix);
+}
+
+void
+GC_CheckReporterBuffered::reportFatalError(GC_CheckError *error)
+{
+	record(GC_CheckBufferedReport::report_fatal_error, error, NULL, NULL);
+}
+
+void
+GC_CheckReporterBuffered::reportHeapWalkError(GC_CheckError *error, GC_CheckElement previousObjectPtr1, GC_CheckElement previousObjectPtr2, GC_CheckElement previousObjectPtr3)
+{
+	UDATA count = _reportCount;
+	record(GC_CheckBufferedReport::report_heap_walk_error, error, NULL, NULL);
+	if (count != _reportCount) {
+		GC_CheckBufferedReport *buffered = &_reports[count];
+		buffered->_previousObject1 = previousObjectPtr1;
+		buffered->_previousObject2 = previousObjectPtr2;
+		buffered->_previousObject3 = previousObjectPtr3;
+	}
+}
+
+void
+GC_CheckReporterBuffered::reportMessage(const char *message)
+{
+	GC_CheckError blank((void *)NULL, (GC_CheckCycle *)NULL, (GC_Check *)NULL, J9MODRON_GCCHK_RC_OK, 0, check_type_other);
+	UDATA count = _reportCount;
+	record(GC_CheckBufferedReport::report_message, &blank, NULL, NULL);
+	if (count != _reportCount) {
+		GC_CheckBufferedReport *buffered = &_reports[count];
+		strncpy(buffered->_message, message, sizeof(buffered->_message) - 1);
+		buffered->_message[sizeof(buffered->_message) - 1] = '\0';
+	}
+}
+
+void
+GC_CheckReporterBuffered::replayUnit(UDATA unit, GC_CheckReporter *reporter, GC_CheckCycle *cycle)
+{
+	while ((_replayCursor < _reportCount) && (_reports[_replayCursor]._unit <= unit)) {
+		GC_CheckBufferedReport *buffered = &_reports[_replayCursor];
+		GC_CheckError *error = &buffered->_error;
+		_replayCursor += 1;
+
+		if ((NULL == reporter) || (buffered->_unit != unit)) {
+			continue;
+		}
+
+		if (GC_CheckBufferedReport::report_message != buffered->_type) {
+			/* all the reports about one error carry the same number */
+			if (error->_errorNumber != _lastRecordedErrorNumber) {
+				_lastRecordedErrorNumber = error->_errorNumber;
+				_lastReplayedErrorNumber = cycle->nextErrorCount();
+			}
+			error->_errorNumber = _lastReplayedErrorNumber;
+		}
+
+		switch (buffered->_type) {
+		case GC_CheckBufferedReport::report_error:
+			reporter->report(error);
+			break;
+		case GC_CheckBufferedReport::report_object_header:
+			reporter->reportObjectHeader(error, (J9Object *)buffered->_pointer, buffered->_prefix);
+			break;
+		case GC_CheckBufferedReport::report_class:
+			reporter->reportClass(error, (J9Class *)buffered->_pointer, buffered->_prefix);
+			break;
+		case GC_CheckBufferedReport::report_fatal_error:
+			reporter->reportFatalError(error);
+			break;
+		case GC_CheckBufferedReport::report_heap_walk_error:
+			reporter->reportHeapWalkError(error, buffered->_previousObject1, buffered->_previousObject2, buffered->_previousObject3);
+			break;
+		case GC_CheckBufferedReport::report_message:
+			reporter->reportMessage(buffered->_message);
+			break;
+		default:
+			break;
+		}
+	}
+}
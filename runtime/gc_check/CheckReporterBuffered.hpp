@@ -0,0 +1,142 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Check
+ */
+
+#if !defined(CHECKREPORTERBUFFERED_HPP_)
+#define CHECKREPORTERBUFFERED_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+
+#include "CheckError.hpp"
+#include "CheckReporter.hpp"
+
+/**
+ * A report recorded by GC_CheckReporterBuffered, to be replayed to another reporter.
+ */
+class GC_CheckBufferedReport
+{
+public:
+	typedef enum {
+		report_error = 0,
+		report_object_header,
+		report_class,
+		report_fatal_error,
+		report_heap_walk_error,
+		report_message
+	} ReportType;
+
+	enum { MESSAGE_SIZE = 128 }; /**< The size of the buffer holding the text of a report_message */
+
+	ReportType _type; /**< Which reporter function was called */
+	UDATA _unit; /**< The unit of work which was being checked when the report was made */
+	GC_CheckError _error; /**< Copy of the error being reported (blank for a report_message) */
+	void *_pointer; /**< The object of a report_object_header, or the class of a report_class */
+	const char *_prefix; /**< The prefix of a report_object_header or report_class */
+	GC_CheckElement _previousObject1; /**< The previous objects of a report_heap_walk_error */
+	GC_CheckElement _previousObject2;
+	GC_CheckElement _previousObject3;
+	char _message[MESSAGE_SIZE]; /**< The text of a report_message */
+
+	GC_CheckBufferedReport(ReportType type, UDATA unit, GC_CheckError *error)
+		: _type(type)
+		, _unit(unit)
+		, _error(*error)
+		, _pointer(NULL)
+		, _prefix(NULL)
+		, _previousObject1()
+		, _previousObject2()
+		, _previousObject3()
+	{
+		_message[0] = '\0';
+	}
+};
+
+/**
+ * Reporter used by the worker engines of a parallel object heap check.
+ *
+ * Instead of printing, every report is recorded along with the unit of work being checked, so that
+ * the reports of all the workers can be replayed to the reporter of the cycle in heap order once
+ * the walk is complete. Errors are numbered by the worker engine which found them, and numbered
+ * again in the check cycle as they are replayed.
+ */
+class GC_CheckReporterBuffered : public GC_CheckReporter
+{
+private:
+	GC_CheckBufferedReport *_reports; /**< Reports in the order they were made */
+	UDATA _reportCount; /**< Number of reports recorded */
+	UDATA _reportCapacity; /**< Number of reports _reports can hold */
+	UDATA _replayCursor; /**< Index of the next report to replay */
+	UDATA _currentUnit; /**< The unit of work attached to new reports */
+	UDATA _lastRecordedErrorNumber; /**< Number given by the worker engine to the last error replayed */
+	UDATA _lastReplayedErrorNumber; /**< Number given by the check cycle to the last error replayed */
+	bool _overflow; /**< Set if a report could not be recorded for lack of memory */
+
+	void record(GC_CheckBufferedReport::ReportType type, GC_CheckError *error, void *pointer, const char *prefix);
+
+public:
+	static GC_CheckReporterBuffered *newInstance(J9JavaVM *javaVM);
+	virtual void kill();
+
+	virtual void report(GC_CheckError *error);
+	virtual void reportObjectHeader(GC_CheckError *error, J9Object *objectPtr, const char *prefix);
+	virtual void reportClass(GC_CheckError *error, J9Class *clazz, const char *prefix);
+	virtual void reportFatalError(GC_CheckError *error);
+	virtual void reportHeapWalkError(GC_CheckError *error, GC_CheckElement previousObjectPtr1, GC_CheckElement previousObjectPtr2, GC_CheckElement previousObjectPtr3);
+	virtual void reportMessage(const char *message);
+
+	/**
+	 * Set the unit of work attached to the reports made from now on. Units must be checked in increasing order.
+	 */
+	void setCurrentUnit(UDATA unit) { _currentUnit = unit; }
+
+	/**
+	 * Replay the reports made while checking the given unit to another reporter. Units must be replayed in increasing order.
+	 * @param unit The unit whose reports to replay
+	 * @param reporter The reporter to replay the reports to, or NULL to discard them
+	 * @param cycle The cycle numbering the replayed errors
+	 */
+	void replayUnit(UDATA unit, GC_CheckReporter *reporter, GC_CheckCycle *cycle);
+
+	/**
+	 * @return true if some reports were lost for lack of memory
+	 */
+	bool hasOverflowed() { return _overflow; }
+
+	GC_CheckReporterBuffered(J9JavaVM *javaVM)
+		: GC_CheckReporter(javaVM)
+		, _reports(NULL)
+		, _reportCount(0)
+		, _reportCapacity(0)
+		, _replayCursor(0)
+		, _currentUnit(0)
+		, _lastRecordedErrorNumber(0)
+		, _lastReplayedErrorNumber(0)
+		, _overflow(false)
+	{}
+};
+
+#endif /* CHECKREPORTERBUFFERED_HPP_ */
@@ -40,6 +40,7 @@
 #include "HeapRegionManager.hpp"
 #include "ObjectAccessBarrier.hpp"
 #include "ObjectAllocationInterface.hpp"
+#include "StringDeduplicator.hpp"
 #include "StringTable.hpp"
 
 #include "OwnableSynchronizerObjectList.hpp"
@@ -147,6 +148,11 @@ public:
 			extensions->stringTable->kill(env);
 			extensions->stringTable = NULL;
 		}
+
+		if (NULL != extensions->stringDeduplicator) {
+			extensions->stringDeduplicator->kill(env);
+			extensions->stringDeduplicator = NULL;
+		}
 	}
 
 	OMR_SizeClasses *getSegregatedSizeClasses(MM_EnvironmentBase* env)
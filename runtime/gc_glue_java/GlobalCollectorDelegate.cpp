@@ -58,6 +58,7 @@
 #include "ReferenceObjectList.hpp"
 #include "ScavengerJavaStats.hpp"
 #include "StandardAccessBarrier.hpp"
+#include "StringDeduplicator.hpp"
 #include "VMThreadListIterator.hpp"
 
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
@@ -242,6 +243,11 @@ MM_GlobalCollectorDelegate::mainThreadGarbageCollectFinished(MM_EnvironmentBase
 void
 MM_GlobalCollectorDelegate::postMarkProcessing(MM_EnvironmentBase *env)
 {
+	if (NULL != _extensions->stringDeduplicator) {
+		/* canonical String values may be moved by compaction from here on */
+		_extensions->stringDeduplicator->reset(env);
+	}
+
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 	if (_extensions->runtimeCheckDynamicClassUnloading != 0) {
 		PORT_ACCESS_FROM_ENVIRONMENT(env);
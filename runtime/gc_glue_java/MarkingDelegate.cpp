@@ -181,6 +181,10 @@ MM_MarkingDelegate::mainSetupForGC(MM_EnvironmentBase *env)
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 
 	_collectStringConstantsEnabled = _extensions->collectStringConstants;
+
+	if (NULL != _extensions->stringDeduplicator) {
+		_deduplicatedStringClass = J9VMJAVALANGSTRING_OR_NULL((J9JavaVM *)env->getLanguageVM());
+	}
 }
 
 void
@@ -35,6 +35,7 @@
 #include "ModronTypes.hpp"
 #include "ReferenceObjectScanner.hpp"
 #include "PointerArrayObjectScanner.hpp"
+#include "StringDeduplicator.hpp"
 
 class GC_ObjectScanner;
 class MM_EnvironmentBase;
@@ -52,6 +53,7 @@ private:
 	bool _collectStringConstantsEnabled;
 	bool _shouldScanUnfinalizedObjects;
 	bool _shouldScanOwnableSynchronizerObjects;
+	J9Class *_deduplicatedStringClass;	/**< java.lang.String while String deduplication is enabled, NULL otherwise */
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 	MM_MarkMap *_markMap;							/**< This is set when dynamic class loading is enabled, NULL otherwise */
 	volatile bool _anotherClassMarkPass;			/**< Used in completeClassMark for another scanning request*/
@@ -81,6 +83,7 @@ public:
 		, _collectStringConstantsEnabled(false)
 		, _shouldScanUnfinalizedObjects(false)
 		, _shouldScanOwnableSynchronizerObjects(false)
+		, _deduplicatedStringClass(NULL)
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 		, _markMap(NULL)
 		, _anotherClassMarkPass(false)
@@ -120,6 +123,11 @@ public:
 		/* object class must have proper eye catcher */
 		Assert_MM_true((UDATA)0x99669966 == clazz->eyecatcher);
 
+		if (clazz == _deduplicatedStringClass) {
+			/* repoint the value before the scanner reads the slot */
+			_extensions->stringDeduplicator->deduplicate(env, objectPtr);
+		}
+
 		GC_ObjectScanner *objectScanner = NULL;
 		switch(_extensions->objectModel.getScanType(objectPtr)) {
 		case GC_ObjectModel::SCAN_MIXED_OBJECT_LINKED:
@@ -102,24 +102,6 @@ private:
 	 */
 	bool private_shouldPercolateGarbageCollect_classUnloading(MM_EnvironmentBase *envBase);
 
-	/**
-	 * Sort all hot fields for all classes.
-	 * Used when scavenger dynamicBreadthFirstScanOrdering is enabled
-	 */
-	void private_SortAllHotFieldData();
-
-	/**
-	 * Reset all hot fields for all classes.
-	 * Used when scavenger dynamicBreadthFirstScanOrdering is enabled and hotFieldResettingEnabled is true
-	 */
-	void private_ResetAllHotFieldData();
-	
-	/**
-	 * Sort all hot fields for a single class.
-	 * Used when scavenger dynamicBreadthFirstScanOrdering is enabled
-	 */
-	void private_SortClassHotFieldList(J9ClassHotFieldsInfo* hotFieldClassInfo);
-
 	/**
 	 * Decide if GC percolation should occur due to active JNI critical
 	 * regions.  Active regions require that objects do not move, which
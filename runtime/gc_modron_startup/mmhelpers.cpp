@@ -151,17 +151,25 @@ j9gc_software_read_barrier_enabled(J9JavaVM *javaVM)
 }
 
 /**
- * Query if hot reference field is reqired for scavenger dynamicBreadthFirstScanOrdering
- *  @return true if scavenger dynamicBreadthFirstScanOrdering is enabled, 0 otherwise 
+ * Query if hot reference field is reqired for scavenger dynamicBreadthFirstScanOrdering or balanced hot field copying
+ *  @return true if scavenger dynamicBreadthFirstScanOrdering or balanced hot field copying is enabled, 0 otherwise 
  */
 BOOLEAN
 j9gc_hot_reference_field_required(J9JavaVM *javaVM)
 {
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(javaVM);
+	BOOLEAN required = FALSE;
 #if defined(J9VM_GC_MODRON_SCAVENGER)
-	return MM_GCExtensions::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST == MM_GCExtensions::getExtensions(javaVM)->scavengerScanOrdering;
-#else /* J9VM_GC_MODRON_SCAVENGER */
-	return FALSE;
+	if (MM_GCExtensions::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST == extensions->scavengerScanOrdering) {
+		required = TRUE;
+	}
 #endif /* J9VM_GC_MODRON_SCAVENGER */
+#if defined(J9VM_GC_VLHGC)
+	if (extensions->isVLHGC() && extensions->tarokEnableHotFieldCopying) {
+		required = TRUE;
+	}
+#endif /* J9VM_GC_VLHGC */
+	return required;
 }
 
 /**
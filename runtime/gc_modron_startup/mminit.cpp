@@ -101,6 +101,7 @@
 #include "RememberedSetSATB.hpp"
 #endif /* J9VM_GC_REALTIME */
 #include "Scavenger.hpp"
+#include "StringDeduplicator.hpp"
 #include "StringTable.hpp"
 #include "Validator.hpp"
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
@@ -478,6 +479,21 @@ j9gc_initialize_heap(J9JavaVM *vm, IDATA *memoryParameterTable, UDATA heapBytesR
 		goto error_no_memory;
 	}
 
+	/* A String is constructed by allocating its value array and then filling it in, so only Strings
+	 * which have survived a collection (tenured, or in an aged region) can be deduplicated safely.
+	 * Without a nursery or regions there is no such age, so the option is ignored.
+	 */
+	if (extensions->stringDeduplication && !extensions->scavengerEnabled && !extensions->isVLHGC()) {
+		extensions->stringDeduplication = false;
+	}
+
+	if (extensions->stringDeduplication) {
+		extensions->stringDeduplicator = MM_StringDeduplicator::newInstance(&env, extensions->stringDeduplicationTableSize);
+		if (NULL == extensions->stringDeduplicator) {
+			goto error_no_memory;
+		}
+	}
+
 	/* Initialize statistic locks */
 	if (omrthread_monitor_init_with_name(&extensions->gcStatsMutex, 0, "MM_GCExtensions::gcStats")) {
 		loadInfo->fatalErrorStr = (char *)j9nls_lookup_message(J9NLS_DO_NOT_PRINT_MESSAGE_TAG | J9NLS_DO_NOT_APPEND_NEWLINE, J9NLS_GC_FAILED_TO_INITIALIZE_MUTEX, "Failed to initialize mutex for GC statistics.");
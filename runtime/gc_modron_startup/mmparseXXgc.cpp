@@ -434,6 +434,13 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			}
 			continue;
 		}
+		if (try_scan(&scan_start, "tarokTargetMaxPauseTime=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->tarokTargetMaxPauseTimeMillis, "tarokTargetMaxPauseTime=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
 		if (try_scan(&scan_start, "tarokPGCtoGMP=")) {
 			if(!scan_udata_helper(vm, &scan_start, &extensions->tarokPGCtoGMPNumerator, "tarokPGCtoGMP=")) {
 				returnValue = JNI_EINVAL;
@@ -551,6 +558,14 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			extensions->tarokEnableLeafFirstCopying = false;
 			continue;
 		}
+		if (try_scan(&scan_start, "tarokEnableHotFieldCopying")) {
+			extensions->tarokEnableHotFieldCopying = true;
+			continue;
+		}
+		if (try_scan(&scan_start, "tarokDisableHotFieldCopying")) {
+			extensions->tarokEnableHotFieldCopying = false;
+			continue;
+		}
 		if (try_scan(&scan_start, "tarokEnableStableRegionDetection")) {
 			extensions->tarokEnableStableRegionDetection = true;
 			continue;
@@ -1416,6 +1431,43 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			continue;
 		}
 
+		if (try_scan(&scan_start, "stringDeduplicationTableSize=")) {
+			if(!scan_udata_helper(vm, &scan_start, &(extensions->stringDeduplicationTableSize), "stringDeduplicationTableSize=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if (0 == extensions->stringDeduplicationTableSize) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_VALUE_MUST_BE_ABOVE, "stringDeduplicationTableSize=", (UDATA)0);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		if (try_scan(&scan_start, "stringDeduplicationRegionAge=")) {
+			if(!scan_udata_helper(vm, &scan_start, &(extensions->stringDeduplicationRegionAge), "stringDeduplicationRegionAge=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			/* Strings in eden may still be filling in their value */
+			if (0 == extensions->stringDeduplicationRegionAge) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_VALUE_MUST_BE_ABOVE, "stringDeduplicationRegionAge=", (UDATA)0);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		if (try_scan(&scan_start, "stringDeduplication")) {
+			extensions->stringDeduplication = true;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "noStringDeduplication")) {
+			extensions->stringDeduplication = false;
+			continue;
+		}
+
 		if (try_scan(&scan_start, "objectListFragmentCount=")) {
 			if(!scan_udata_helper(vm, &scan_start, &(extensions->objectListFragmentCount), "objectListFragmentCount=")) {
 				returnValue = JNI_EINVAL;
@@ -70,6 +70,7 @@
 #include "HeapRegionDescriptorVLHGC.hpp"
 #include "HeapRegionIteratorVLHGC.hpp"
 #include "HeapRegionManager.hpp"
+#include "HotFieldUtil.hpp"
 #include "InterRegionRememberedSet.hpp"
 #include "MarkMap.hpp"
 #include "MemorySpace.hpp"
@@ -1450,6 +1451,11 @@ MM_CopyForwardScheme::mainSetupForCopyForward(MM_EnvironmentVLHGC *env)
 	
 	/* Record whether finalizable processing is required in this copy-forward collection */
 	_shouldScanFinalizableObjects = _extensions->finalizeListManager->isFinalizableObjectProcessingRequired();
+
+	/* Pick up hot fields reported by the JIT since the last copy-forward */
+	if (_extensions->tarokEnableHotFieldCopying) {
+		MM_HotFieldUtil::sortAllHotFieldData(_javaVM, _extensions->globalVLHGCStats.gcCount);
+	}
 }
 
 /**
@@ -2031,6 +2037,9 @@ MM_CopyForwardScheme::copy(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *
 					copyLeafChildren(env, reservingContext, destinationObjectPtr);
 				}
 #endif /* J9VM_GC_LEAF_BITS */
+				if (_extensions->tarokEnableHotFieldCopying && (env->_hotFieldCopyDepthCount < _extensions->depthCopyMax)) {
+					copyHotFieldChildren(env, reservingContext, destinationObjectPtr);
+				}
 			}
 			/* return value for updating the slot */
 			result = destinationObjectPtr;
@@ -2067,6 +2076,31 @@ MM_CopyForwardScheme::copyLeafChildren(MM_EnvironmentVLHGC* env, MM_AllocationCo
 }
 #endif /* J9VM_GC_LEAF_BITS */
 
+void
+MM_CopyForwardScheme::copyHotFieldChildren(MM_EnvironmentVLHGC* env, MM_AllocationContextTarok *reservingContext, J9Object* objectPtr)
+{
+	J9Class *clazz = J9GC_J9OBJECT_CLAZZ(objectPtr, env);
+	J9ClassHotFieldsInfo *hotFieldsInfo = clazz->hotFieldsInfo;
+	/* only plain mixed objects: a hot referent of a Reference object must not be kept alive by copying it here */
+	if ((NULL != hotFieldsInfo) && (GC_ObjectModel::SCAN_MIXED_OBJECT == _extensions->objectModel.getScanType(clazz))) {
+		/* hot field offsets are expressed in reference slots from the start of the object (header included) */
+		UDATA const referenceSize = env->compressObjectReferences() ? sizeof(U_32) : sizeof(UDATA);
+		UDATA objectSize = _extensions->mixedObjectModel.getSizeInBytesWithHeader(objectPtr);
+		uint8_t hotFieldOffsets[] = { hotFieldsInfo->hotFieldOffset1, hotFieldsInfo->hotFieldOffset2, hotFieldsInfo->hotFieldOffset3 };
+
+		env->_hotFieldCopyDepthCount += 1;
+		for (UDATA i = 0; i < (sizeof(hotFieldOffsets) / sizeof(hotFieldOffsets[0])); i++) {
+			UDATA slotOffset = (UDATA)hotFieldOffsets[i] * referenceSize;
+			if ((U_8_MAX != hotFieldOffsets[i]) && ((slotOffset + referenceSize) <= objectSize)) {
+				GC_SlotObject slotObject(_javaVM->omrVM, (fomrobject_t *)((U_8 *)objectPtr + slotOffset));
+				/* Copy/Forward the slot reference and perform any inter-region remember work that is required */
+				copyAndForward(env, reservingContext, objectPtr, &slotObject);
+			}
+		}
+		env->_hotFieldCopyDepthCount -= 1;
+	}
+}
+
 /**
  * Updates leaf pointers that point to an address located within the indexable object.  For example,
  * when the array layout is either inline continuous or hybrid, there will be leaf pointers that point
@@ -2602,14 +2636,20 @@ MM_CopyForwardScheme::isAnyScanWorkAvailable(MM_EnvironmentVLHGC *env)
 }
 
 MM_CopyScanCacheVLHGC *
-MM_CopyForwardScheme::getSurvivorCacheForScan(MM_EnvironmentVLHGC *env)
+MM_CopyForwardScheme::getSurvivorCacheForScan(MM_EnvironmentVLHGC *env, UDATA numaNode)
 {
 	MM_CopyScanCacheVLHGC *cache = NULL;
 
 	for(UDATA index = 0; index < _compactGroupMaxCount; index++) {
 		cache = env->_copyForwardCompactGroups[index]._copyCache;
 		if((NULL != cache) && cache->isScanWorkAvailable()) {
-			return cache;
+			if (UDATA_MAX == numaNode) {
+				return cache;
+			}
+			UDATA cacheNode = _regionManager->tableDescriptorForAddress(cache->cacheBase)->getNumaNode();
+			if ((numaNode == cacheNode) || (COMMON_CONTEXT_INDEX == cacheNode)) {
+				return cache;
+			}
 		}
 	}
 
@@ -2623,8 +2663,13 @@ MM_CopyForwardScheme::getNextWorkUnit(MM_EnvironmentVLHGC *env, UDATA preferredN
 	ScanReason ret = SCAN_REASON_NONE;
 
 	MM_CopyScanCacheVLHGC *cache = NULL;
+	/* With physical NUMA, scanning a survivor cache on another node means remote reads of every object in it and
+	 * remote writes for every child copied next to it, so prefer our own node's work before touching our remote caches.
+	 */
+	bool const preferLocalNode = _extensions->_numaManager.isPhysicalNUMASupported();
+
 	/* Preference is to use survivor copy cache */
-	if(NULL != (cache = getSurvivorCacheForScan(env))) {
+	if(NULL != (cache = getSurvivorCacheForScan(env, preferLocalNode ? preferredNumaNode : UDATA_MAX))) {
 		env->_scanCache = cache;
 		ret = SCAN_REASON_COPYSCANCACHE;
 		return ret;
@@ -2639,6 +2684,20 @@ MM_CopyForwardScheme::getNextWorkUnit(MM_EnvironmentVLHGC *env, UDATA preferredN
 		return ret;
 	}
 
+	if (preferLocalNode) {
+		/* shared work on our node before our own survivor caches on remote nodes */
+		ret = getNextWorkUnitOnNode(env, preferredNumaNode);
+		if (SCAN_REASON_NONE != ret) {
+			return ret;
+		}
+		/* remote survivor caches are private to this thread until they fill up, so they must be scanned before stealing or waiting */
+		if(NULL != (cache = getSurvivorCacheForScan(env, UDATA_MAX))) {
+			env->_scanCache = cache;
+			ret = SCAN_REASON_COPYSCANCACHE;
+			return ret;
+		}
+	}
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	env->_copyForwardStats._acquireScanListCount += 1;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
@@ -594,9 +594,10 @@ private:
 	/**
 	 * Return the next available survivor (destination) copy scan cache that has work available for scanning.
 	 * @param env GC thread.
+	 * @param numaNode Only return caches whose memory is on this NUMA node (or the common node), or UDATA_MAX to accept any cache
 	 * @return a copy scan cache to be scanned, or NULL if none are available.
 	 */
-	MM_CopyScanCacheVLHGC *getSurvivorCacheForScan(MM_EnvironmentVLHGC *env);
+	MM_CopyScanCacheVLHGC *getSurvivorCacheForScan(MM_EnvironmentVLHGC *env, UDATA numaNode);
 
 	/**
 	 * Tries to find next scan work from both scanCache and workPackets
@@ -956,6 +957,17 @@ private:
 	void copyLeafChildren(MM_EnvironmentVLHGC* env, MM_AllocationContextTarok *reservingContext, J9Object* objectPtr);
 #endif /* J9VM_GC_LEAF_BITS */
 
+	/**
+	 * Copy the children of the specified object referenced by its class's hot fields, so that they land
+	 * in the same copy cache right after their parent.  Each copied child has its own hot fields copied
+	 * in turn (depth-first), up to depthCopyMax levels.  Only the hot fields reported by the JIT are used;
+	 * classes without such reports are copied in the normal scan order.
+	 * @param env[in] the current thread
+	 * @param reservingContext[in] The context to which we would prefer to copy any objects discovered in this method
+	 * @param objectPtr[in] the (already copied) object whose hot children should be copied
+	 */
+	void copyHotFieldChildren(MM_EnvironmentVLHGC* env, MM_AllocationContextTarok *reservingContext, J9Object* objectPtr);
+
 	/**
 	 * Calculate estimation for allocation age based on compact group and set it to the merged region
 	 * @param[in] env The current thread
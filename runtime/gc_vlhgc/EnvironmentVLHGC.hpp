@@ -74,6 +74,7 @@ public:
 	IDATA _rsclBufferControlBlockCount;	/**< count of buffers in BufferControlBlock thread local pool list */
 	MM_RememberedSetCardBucket *_rememberedSetCardBucketPool; /**< GC thread local pool of RS Card Buckets for each Region (its Card List) */
 	MM_RememberedSetCardList *_lastOverflowedRsclWithReleasedBuffers; /**< in global list of overflowed RSCL, this is the last RSCL this thread visited */
+	UDATA _hotFieldCopyDepthCount; /**< depth of the current chain of hot field copies during copy-forward, bounded by depthCopyMax */
 
 	MM_CopyForwardStats _copyForwardStats;  /**< GC thread local statistics structure for copy forward collections */
 
@@ -77,6 +77,7 @@
 #include "RootScanner.hpp"
 #include "SegmentIterator.hpp"
 #include "StackSlotValidator.hpp"
+#include "StringDeduplicator.hpp"
 #include "SublistIterator.hpp"
 #include "SublistPool.hpp"
 #include "SublistPuddle.hpp"
@@ -354,12 +355,20 @@ MM_GlobalMarkingScheme::mainSetupForGC(MM_EnvironmentVLHGC *env)
 	static_cast<MM_CycleStateVLHGC*>(env->_cycleState)->_vlhgcIncrementStats._workPacketStats.clear();
 
 	_interRegionRememberedSet->prepareOverflowedRegionsForRebuilding(env);
+
+	if (NULL != _extensions->stringDeduplicator) {
+		_deduplicatedStringClass = J9VMJAVALANGSTRING_OR_NULL(_javaVM);
+	}
 }
 
 void
 MM_GlobalMarkingScheme::mainCleanupAfterGC(MM_EnvironmentVLHGC *env)
 {
 	_interRegionRememberedSet->setRegionsAsRebuildingComplete(env);
+
+	if (NULL != _extensions->stringDeduplicator) {
+		_extensions->stringDeduplicator->reset(env);
+	}
 }
 
 void
@@ -498,6 +507,16 @@ MM_GlobalMarkingScheme::scanMixedObject(MM_EnvironmentVLHGC *env, J9Object *obje
 
 	markObjectClass(env, objectPtr);
 
+	if (J9GC_J9OBJECT_CLAZZ(objectPtr, env) == _deduplicatedStringClass) {
+		/* Only Strings which have survived a few partial collections are deduplicated. Repointing the
+		 * value happens before the slot is scanned below, which remembers the new inter-region reference.
+		 */
+		MM_HeapRegionDescriptorVLHGC *region = (MM_HeapRegionDescriptorVLHGC *)_heapRegionManager->tableDescriptorForAddress(objectPtr);
+		if (region->getLogicalAge() >= _extensions->stringDeduplicationRegionAge) {
+			_extensions->stringDeduplicator->deduplicate(env, objectPtr);
+		}
+	}
+
 	/* Object slots */
 	volatile fj9object_t *scanPtr = _extensions->mixedObjectModel.getHeadlessObject(objectPtr);
 	UDATA objectSize = _extensions->mixedObjectModel.getSizeInBytesWithHeader(objectPtr);
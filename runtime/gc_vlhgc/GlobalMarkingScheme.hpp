@@ -203,6 +203,7 @@ private:
 	MM_InterRegionRememberedSet *_interRegionRememberedSet;	/**< A cached pointer to the  inter-region reference tracking  */
 	const bool _collectStringConstantsEnabled;
 	const UDATA _regionSize;	/**< Cached copy of the region size used for short-circuiting region matching checks with the XOR-and-compare */
+	J9Class *_deduplicatedStringClass;	/**< java.lang.String while String deduplication is enabled, NULL otherwise */
 
 	/**
 	 * Codes used to indicate why an object is being scanned
@@ -521,6 +522,7 @@ public:
 		, _interRegionRememberedSet(NULL)
 		, _collectStringConstantsEnabled(_extensions->collectStringConstants)
 		, _regionSize(_extensions->regionSize)
+		, _deduplicatedStringClass(NULL)
 	{
 		_typeId = __FUNCTION__;
 	}
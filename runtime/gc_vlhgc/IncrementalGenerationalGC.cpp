@@ -70,6 +70,7 @@
 #include "ParallelDispatcher.hpp"
 #include "ParallelTask.hpp"
 #include "ReferenceChainWalker.hpp"
+#include "StringDeduplicator.hpp"
 #include "VLHGCAccessBarrier.hpp"
 #include "WorkPacketsIterator.hpp"
 #include "WorkPacketsVLHGC.hpp"
@@ -919,6 +920,11 @@ MM_IncrementalGenerationalGC::runPartialGarbageCollect(MM_EnvironmentVLHGC *env,
 	/* Perform any main-specific setup */
 	_extensions->globalVLHGCStats.gcCount += 1;
 
+	if (NULL != _extensions->stringDeduplicator) {
+		/* canonical String values found by an in-progress global mark may be copied by this collection */
+		_extensions->stringDeduplicator->reset(env);
+	}
+
 	/*
 	 * Core collection work.
 	 */
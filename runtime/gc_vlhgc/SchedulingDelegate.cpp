@@ -58,6 +58,7 @@
 const double measureScanRateHistoricWeightForGMP = 0.50;
 const double measureScanRateHistoricWeightForPGC = 0.95;
 const double partialGCTimeHistoricWeight = 0.80;
+#define PAUSE_TIME_TARGET_MINIMUM_SAMPLES 3
 const double incrementalScanTimePerGMPHistoricWeight = 0.50;
 const double bytesScannedConcurrentlyPerGMPHistoricWeight = 0.50;
 
@@ -86,6 +87,7 @@ MM_SchedulingDelegate::MM_SchedulingDelegate (MM_EnvironmentVLHGC *env, MM_HeapR
 	, _averageCopyForwardBytesDiscarded(0.0)
 	, _averageSurvivorSetRegionCount(0.0)
 	, _averageCopyForwardRate(1.0)
+	, _copyForwardCompletedCount(0)
 	, _averageMacroDefragmentationWork(0.0)
 	, _currentMacroDefragmentationWork(0)
 	, _didGMPCompleteSinceLastReclaim(false)
@@ -892,6 +894,7 @@ MM_SchedulingDelegate::copyForwardCompleted(MM_EnvironmentVLHGC *env)
 	
 	_averageSurvivorSetRegionCount = (_averageSurvivorSetRegionCount * historicWeight) + ((double)survivorSetRegionCount * (1.0 - historicWeight));
 	_averageCopyForwardRate = (_averageCopyForwardRate * historicWeight) + (copyForwardRate * (1.0 - historicWeight));
+	_copyForwardCompletedCount += 1;
 
 	Trc_MM_SchedulingDelegate_copyForwardCompleted_efficiency(
 		env->getLanguageVMThread(),
@@ -995,6 +998,7 @@ MM_SchedulingDelegate::calculateEdenSize(MM_EnvironmentVLHGC *env)
 	} else if (desiredEdenCount < edenMinimumCount) {
 		desiredEdenCount = edenMinimumCount;
 	}
+	desiredEdenCount = applyPauseTimeTarget(env, desiredEdenCount, edenMinimumCount);
 	Trc_MM_SchedulingDelegate_calculateEdenSize_dynamic(env->getLanguageVMThread(), desiredEdenCount, _edenSurvivalRateCopyForward, _nonEdenSurvivalCountCopyForward, freeRegions, edenMinimumCount, edenMaximumCount);
 	if (desiredEdenCount <= freeRegions) {
 		_edenRegionCount = desiredEdenCount;
@@ -1008,6 +1012,32 @@ MM_SchedulingDelegate::calculateEdenSize(MM_EnvironmentVLHGC *env)
 	Trc_MM_SchedulingDelegate_calculateEdenSize_Exit(env->getLanguageVMThread(), (_edenRegionCount * regionSize));
 }
 
+UDATA
+MM_SchedulingDelegate::applyPauseTimeTarget(MM_EnvironmentVLHGC *env, UDATA desiredEdenCount, UDATA edenMinimumCount)
+{
+	UDATA edenCount = desiredEdenCount;
+	UDATA targetPauseMillis = _extensions->tarokTargetMaxPauseTimeMillis;
+
+	/* the initial copy-forward rate is a placeholder, so wait until it has been blended with a few real measurements */
+	if ((0 != targetPauseMillis) && (_copyForwardCompletedCount >= PAUSE_TIME_TARGET_MINIMUM_SAMPLES) && (_edenSurvivalRateCopyForward > 0.0)) {
+		UDATA regionSize = _regionManager->getRegionSize();
+		/* bytes we can expect to copy within the target pause (_averageCopyForwardRate is in bytes per microsecond) */
+		double copyBudgetBytes = _averageCopyForwardRate * (double)targetPauseMillis * 1000.0;
+		/* survivors from non-Eden regions in the collection set compete for the same budget */
+		copyBudgetBytes -= (double)_nonEdenSurvivalCountCopyForward * (double)regionSize;
+		if (copyBudgetBytes < 0.0) {
+			copyBudgetBytes = 0.0;
+		}
+		double edenBudgetBytes = copyBudgetBytes / _edenSurvivalRateCopyForward;
+		double edenBudgetRegions = edenBudgetBytes / (double)regionSize;
+		if (edenBudgetRegions < (double)edenCount) {
+			edenCount = OMR_MAX((UDATA)edenBudgetRegions, edenMinimumCount);
+		}
+	}
+
+	return edenCount;
+}
+
 UDATA
 MM_SchedulingDelegate::currentGlobalMarkIncrementTimeMillis(MM_EnvironmentVLHGC *env) const
 {
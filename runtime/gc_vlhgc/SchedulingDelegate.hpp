@@ -64,6 +64,7 @@ private:
 	double _averageCopyForwardBytesDiscarded; /**< Weighted average of bytes discarded (lost) by the copy-forward scheme */
 	double _averageSurvivorSetRegionCount; /**< Weighted average of survivor regions */
 	double _averageCopyForwardRate; /**< Weighted average of (bytesCopied / timeSpentInCopyForward).  Disregards time spent related RSCL clearing. Measured in bytes/microseconds */
+	UDATA _copyForwardCompletedCount; /**< Number of copy-forward PGCs completed so far, used to decide when _averageCopyForwardRate is trustworthy */
 	double _averageMacroDefragmentationWork; /**< Average work to be done to mitigate influx of fragmented regions into the oldest age */
 	UDATA _currentMacroDefragmentationWork;	 /**< As we age out regions and find macro defrag work, we sum it up */
 	bool _didGMPCompleteSinceLastReclaim; /**< true if a GMP completed since the last reclaim cycle */
@@ -201,6 +202,16 @@ private:
 	 */
 	void calculateEdenSize(MM_EnvironmentVLHGC *env);
 
+	/**
+	 * Shrink a desired Eden size so that the copy-forward of its expected survivors, at the measured
+	 * copy-forward rate, fits within GCExtensions->tarokTargetMaxPauseTimeMillis.
+	 * @param env[in] the main GC thread
+	 * @param desiredEdenCount[in] the Eden size, in regions, chosen without regard to pause time
+	 * @param edenMinimumCount[in] the smallest Eden size, in regions, which may be returned
+	 * @return the Eden size in regions, no larger than desiredEdenCount
+	 */
+	UDATA applyPauseTimeTarget(MM_EnvironmentVLHGC *env, UDATA desiredEdenCount, UDATA edenMinimumCount);
+
 	/**
 	 * Calculate the new Global Mark increment time given the most recent Partial GC time.
 	 * Attempt to keep the GMP times in line with the times in PGC.  Keep track of a weighted
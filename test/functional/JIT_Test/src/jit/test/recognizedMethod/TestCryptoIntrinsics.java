@@ -0,0 +1,402 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+package jit.test.recognizedMethod;
+
+import java.lang.reflect.Method;
+import java.nio.ByteBuffer;
+import java.util.Arrays;
+import java.util.Base64;
+import java.util.Random;
+import java.util.zip.Checksum;
+
+import javax.crypto.Cipher;
+import javax.crypto.spec.GCMParameterSpec;
+import javax.crypto.spec.SecretKeySpec;
+
+import org.testng.AssertJUnit;
+import org.testng.annotations.Test;
+
+/**
+ * Checks the CRC32C, Base64 encoding, AES block and GHASH intrinsics against plain Java
+ * implementations of the same algorithms. Each check runs long enough for the JDK
+ * methods that the JIT replaces to be compiled. The references are checked against
+ * published test vectors first.
+ */
+public class TestCryptoIntrinsics {
+	private static final int ITERATIONS = 200;
+
+	/* Lengths around the 8 and 16 byte steps of the intrinsics and their tails */
+	private static final int[] LENGTHS = { 0, 1, 2, 3, 7, 8, 9, 12, 15, 16, 17, 24, 31, 32, 33, 47, 48, 49, 63, 64, 65, 255, 1024, 3001 };
+
+	private static byte[] hex(String s) {
+		byte[] bytes = new byte[s.length() / 2];
+		for (int i = 0; i < bytes.length; i++) {
+			bytes[i] = (byte)Integer.parseInt(s.substring(2 * i, 2 * i + 2), 16);
+		}
+		return bytes;
+	}
+
+	private static byte[] randomBytes(Random random, int length) {
+		byte[] bytes = new byte[length];
+		random.nextBytes(bytes);
+		return bytes;
+	}
+
+	/* CRC32C */
+
+	private static int referenceCRC32C(int crc, byte[] bytes, int offset, int length) {
+		crc = ~crc;
+		for (int i = offset; i < offset + length; i++) {
+			crc ^= bytes[i] & 0xff;
+			for (int k = 0; k < 8; k++) {
+				crc = (crc >>> 1) ^ (((crc & 1) != 0) ? 0x82f63b78 : 0);
+			}
+		}
+		return ~crc;
+	}
+
+	@Test(groups = {"level.sanity"}, invocationCount=2)
+	public void testCRC32C() throws Exception {
+		AssertJUnit.assertEquals(0xe3069283, referenceCRC32C(0, "123456789".getBytes("US-ASCII"), 0, 9));
+
+		Class<?> crc32cClass;
+		try {
+			crc32cClass = Class.forName("java.util.zip.CRC32C");
+		} catch (ClassNotFoundException e) {
+			/* CRC32C is only available from Java 9 */
+			return;
+		}
+		Method updateBuffer = crc32cClass.getMethod("update", ByteBuffer.class);
+
+		Random random = new Random(14);
+		for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+			for (int length : LENGTHS) {
+				for (int offset = 0; offset < 4; offset++) {
+					byte[] bytes = randomBytes(random, offset + length);
+					int expected = referenceCRC32C(0, bytes, offset, length);
+
+					Checksum crc = (Checksum)crc32cClass.newInstance();
+					crc.update(bytes, offset, length);
+					AssertJUnit.assertEquals("CRC32C of " + length + " bytes at offset " + offset, expected, (int)crc.getValue());
+
+					/* Continue from an intermediate value */
+					int split = length / 3;
+					crc.reset();
+					crc.update(bytes, offset, split);
+					crc.update(bytes, offset + split, length - split);
+					AssertJUnit.assertEquals("CRC32C of " + length + " bytes in two parts", expected, (int)crc.getValue());
+
+					if (iteration % 20 == 0) {
+						ByteBuffer direct = ByteBuffer.allocateDirect(length);
+						direct.put(bytes, offset, length);
+						direct.flip();
+						crc.reset();
+						updateBuffer.invoke(crc, direct);
+						AssertJUnit.assertEquals("CRC32C of a direct buffer of " + length + " bytes", expected, (int)crc.getValue());
+					}
+				}
+			}
+		}
+	}
+
+	/* Base64 */
+
+	private static byte[] referenceBase64(byte[] src, boolean isURL) {
+		String alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789" + (isURL ? "-_" : "+/");
+		byte[] dst = new byte[4 * ((src.length + 2) / 3)];
+		int d = 0;
+		for (int s = 0; s < src.length; s += 3) {
+			int n = Math.min(3, src.length - s);
+			int bits = (src[s] & 0xff) << 16;
+			if (n > 1) {
+				bits |= (src[s + 1] & 0xff) << 8;
+			}
+			if (n > 2) {
+				bits |= src[s + 2] & 0xff;
+			}
+			dst[d++] = (byte)alphabet.charAt((bits >>> 18) & 0x3f);
+			dst[d++] = (byte)alphabet.charAt((bits >>> 12) & 0x3f);
+			dst[d++] = (n > 1) ? (byte)alphabet.charAt((bits >>> 6) & 0x3f) : (byte)'=';
+			dst[d++] = (n > 2) ? (byte)alphabet.charAt(bits & 0x3f) : (byte)'=';
+		}
+		return dst;
+	}
+
+	@Test(groups = {"level.sanity"}, invocationCount=2)
+	public void testBase64Encode() throws Exception {
+		AssertJUnit.assertTrue(Arrays.equals("Zm9vYmFy".getBytes("US-ASCII"), referenceBase64("foobar".getBytes("US-ASCII"), false)));
+
+		Base64.Encoder encoder = Base64.getEncoder();
+		Base64.Encoder urlEncoder = Base64.getUrlEncoder();
+		Random random = new Random(14);
+		for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+			for (int length : LENGTHS) {
+				byte[] src = randomBytes(random, length);
+				AssertJUnit.assertTrue("Base64 of " + length + " bytes", Arrays.equals(referenceBase64(src, false), encoder.encode(src)));
+				AssertJUnit.assertTrue("URL Base64 of " + length + " bytes", Arrays.equals(referenceBase64(src, true), urlEncoder.encode(src)));
+			}
+		}
+	}
+
+	/* AES */
+
+	private static final int[] SBOX = new int[256];
+
+	private static int rotl8(int x, int shift) {
+		return ((x << shift) | (x >>> (8 - shift))) & 0xff;
+	}
+
+	private static int xtime(int b) {
+		return ((b << 1) ^ (((b & 0x80) != 0) ? 0x1b : 0)) & 0xff;
+	}
+
+	static {
+		/* p walks GF(2^8)* by multiplying by 3 and q by dividing by 3, so q is the inverse of p */
+		int p = 1;
+		int q = 1;
+		do {
+			p = (p ^ (p << 1) ^ (((p & 0x80) != 0) ? 0x1b : 0)) & 0xff;
+			q ^= q << 1;
+			q ^= q << 2;
+			q ^= q << 4;
+			q &= 0xff;
+			if ((q & 0x80) != 0) {
+				q ^= 0x09;
+			}
+			SBOX[p] = (q ^ rotl8(q, 1) ^ rotl8(q, 2) ^ rotl8(q, 3) ^ rotl8(q, 4) ^ 0x63) & 0xff;
+		} while (p != 1);
+		SBOX[0] = 0x63;
+	}
+
+	/* The round keys as bytes, 16 per round */
+	private static int[] referenceAESKeyExpansion(byte[] key) {
+		int nk = key.length / 4;
+		int nr = nk + 6;
+		int[] w = new int[16 * (nr + 1)];
+		for (int i = 0; i < key.length; i++) {
+			w[i] = key[i] & 0xff;
+		}
+		int rcon = 1;
+		int[] t = new int[4];
+		for (int i = nk; i < 4 * (nr + 1); i++) {
+			for (int j = 0; j < 4; j++) {
+				t[j] = w[4 * (i - 1) + j];
+			}
+			if ((i % nk) == 0) {
+				int t0 = t[0];
+				t[0] = SBOX[t[1]] ^ rcon;
+				t[1] = SBOX[t[2]];
+				t[2] = SBOX[t[3]];
+				t[3] = SBOX[t0];
+				rcon = xtime(rcon);
+			} else if ((nk > 6) && ((i % nk) == 4)) {
+				for (int j = 0; j < 4; j++) {
+					t[j] = SBOX[t[j]];
+				}
+			}
+			for (int j = 0; j < 4; j++) {
+				w[4 * i + j] = w[4 * (i - nk) + j] ^ t[j];
+			}
+		}
+		return w;
+	}
+
+	private static void referenceAESEncryptBlock(int[] w, byte[] in, int inOffset, byte[] out, int outOffset) {
+		int nr = w.length / 16 - 1;
+		int[] s = new int[16];
+		int[] t = new int[16];
+		for (int i = 0; i < 16; i++) {
+			s[i] = (in[inOffset + i] & 0xff) ^ w[i];
+		}
+		for (int r = 1; r <= nr; r++) {
+			/* SubBytes and ShiftRows */
+			for (int i = 0; i < 16; i++) {
+				t[i] = SBOX[s[(i + 4 * (i % 4)) % 16]];
+			}
+			if (r != nr) {
+				/* MixColumns */
+				for (int c = 0; c < 16; c += 4) {
+					int x = t[c] ^ t[c + 1] ^ t[c + 2] ^ t[c + 3];
+					for (int j = 0; j < 4; j++) {
+						s[c + j] = t[c + j] ^ x ^ xtime(t[c + j] ^ t[c + ((j + 1) % 4)]);
+					}
+				}
+			} else {
+				System.arraycopy(t, 0, s, 0, 16);
+			}
+			for (int i = 0; i < 16; i++) {
+				s[i] ^= w[16 * r + i];
+			}
+		}
+		for (int i = 0; i < 16; i++) {
+			out[outOffset + i] = (byte)s[i];
+		}
+	}
+
+	private static byte[] referenceAESEncrypt(byte[] key, byte[] in) {
+		int[] w = referenceAESKeyExpansion(key);
+		byte[] out = new byte[in.length];
+		for (int i = 0; i < in.length; i += 16) {
+			referenceAESEncryptBlock(w, in, i, out, i);
+		}
+		return out;
+	}
+
+	@Test(groups = {"level.sanity"}, invocationCount=2)
+	public void testAESEncryptDecryptBlock() throws Exception {
+		/* FIPS-197 appendix C */
+		byte[] plain = hex("00112233445566778899aabbccddeeff");
+		AssertJUnit.assertTrue(Arrays.equals(hex("69c4e0d86a7b0430d8cdb78070b4c55a"), referenceAESEncrypt(hex("000102030405060708090a0b0c0d0e0f"), plain)));
+		AssertJUnit.assertTrue(Arrays.equals(hex("dda97ca4864cdfe06eaf70a0ec0d7191"), referenceAESEncrypt(hex("000102030405060708090a0b0c0d0e0f1011121314151617"), plain)));
+		AssertJUnit.assertTrue(Arrays.equals(hex("8ea2b7ca516745bfeafc49904b496089"), referenceAESEncrypt(hex("000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f"), plain)));
+
+		Cipher cipher = Cipher.getInstance("AES/ECB/NoPadding");
+		Random random = new Random(14);
+		for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+			for (int keyLength = 16; keyLength <= 32; keyLength += 8) {
+				SecretKeySpec key = new SecretKeySpec(randomBytes(random, keyLength), "AES");
+				byte[] in = randomBytes(random, 16 * (1 + random.nextInt(64)));
+
+				cipher.init(Cipher.ENCRYPT_MODE, key);
+				byte[] encrypted = cipher.doFinal(in);
+				AssertJUnit.assertTrue("AES-" + (8 * keyLength) + " encryption of " + in.length + " bytes",
+						Arrays.equals(referenceAESEncrypt(key.getEncoded(), in), encrypted));
+
+				cipher.init(Cipher.DECRYPT_MODE, key);
+				AssertJUnit.assertTrue("AES-" + (8 * keyLength) + " decryption of " + in.length + " bytes",
+						Arrays.equals(in, cipher.doFinal(encrypted)));
+			}
+		}
+	}
+
+	/* GHASH */
+
+	/* Multiplies two elements of GF(2^128) in the bit order of GCM, each given as two longs, high half first */
+	private static void referenceGFMultiply(long[] x, long[] y) {
+		long zh = 0;
+		long zl = 0;
+		long vh = y[0];
+		long vl = y[1];
+		for (int i = 0; i < 128; i++) {
+			long bit = (i < 64) ? (x[0] >>> (63 - i)) : (x[1] >>> (127 - i));
+			if ((bit & 1) != 0) {
+				zh ^= vh;
+				zl ^= vl;
+			}
+			boolean lsb = (vl & 1) != 0;
+			vl = (vl >>> 1) | (vh << 63);
+			vh >>>= 1;
+			if (lsb) {
+				vh ^= 0xe100000000000000L;
+			}
+		}
+		x[0] = zh;
+		x[1] = zl;
+	}
+
+	private static long getLong(byte[] bytes, int offset) {
+		long value = 0;
+		for (int i = 0; i < 8; i++) {
+			value = (value << 8) | (((offset + i) < bytes.length) ? (bytes[offset + i] & 0xff) : 0);
+		}
+		return value;
+	}
+
+	/* Absorbs bytes into the GHASH state, padding the last block with zeros */
+	private static void referenceGHASH(long[] state, long[] subkey, byte[] bytes) {
+		for (int i = 0; i < bytes.length; i += 16) {
+			state[0] ^= getLong(bytes, i);
+			state[1] ^= getLong(bytes, i + 8);
+			referenceGFMultiply(state, subkey);
+		}
+	}
+
+	/* AES-GCM with a 96 bit IV and a 128 bit tag; returns the ciphertext followed by the tag */
+	private static byte[] referenceGCMEncrypt(byte[] key, byte[] iv, byte[] aad, byte[] plain) {
+		int[] w = referenceAESKeyExpansion(key);
+		byte[] block = new byte[16];
+		referenceAESEncryptBlock(w, new byte[16], 0, block, 0);
+		long[] subkey = { getLong(block, 0), getLong(block, 8) };
+
+		byte[] counter = new byte[16];
+		System.arraycopy(iv, 0, counter, 0, 12);
+		counter[15] = 1;
+		byte[] tagMask = new byte[16];
+		referenceAESEncryptBlock(w, counter, 0, tagMask, 0);
+
+		byte[] out = new byte[plain.length + 16];
+		for (int i = 0; i < plain.length; i += 16) {
+			for (int k = 15; (k >= 12) && (++counter[k] == 0); k--) {
+			}
+			referenceAESEncryptBlock(w, counter, 0, block, 0);
+			for (int j = 0; (j < 16) && ((i + j) < plain.length); j++) {
+				out[i + j] = (byte)(plain[i + j] ^ block[j]);
+			}
+		}
+
+		long[] state = new long[2];
+		referenceGHASH(state, subkey, aad);
+		referenceGHASH(state, subkey, Arrays.copyOf(out, plain.length));
+		state[0] ^= 8L * aad.length;
+		state[1] ^= 8L * plain.length;
+		referenceGFMultiply(state, subkey);
+		for (int i = 0; i < 16; i++) {
+			long half = state[i / 8];
+			out[plain.length + i] = (byte)((half >>> (56 - 8 * (i % 8))) ^ tagMask[i]);
+		}
+		return out;
+	}
+
+	@Test(groups = {"level.sanity"}, invocationCount=2)
+	public void testGHASHProcessBlocks() throws Exception {
+		/* Test case 4 of the GCM specification */
+		AssertJUnit.assertTrue(Arrays.equals(
+				hex("42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e21d514b25466931c7d8f6a5aac84aa051ba30b396a0aac973d58e091"
+						+ "5bc94fbc3221a5db94fae95ae7121a47"),
+				referenceGCMEncrypt(hex("feffe9928665731c6d6a8f9467308308"), hex("cafebabefacedbaddecaf888"),
+						hex("feedfacedeadbeeffeedfacedeadbeefabaddad2"),
+						hex("d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a721c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657ba637b39"))));
+
+		Cipher cipher = Cipher.getInstance("AES/GCM/NoPadding");
+		Random random = new Random(14);
+		for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+			for (int length : LENGTHS) {
+				SecretKeySpec key = new SecretKeySpec(randomBytes(random, 16), "AES");
+				/* A fresh IV each time, since an IV cannot be reused with the same key */
+				byte[] iv = randomBytes(random, 12);
+				byte[] aad = randomBytes(random, random.nextInt(40));
+				byte[] plain = randomBytes(random, length);
+
+				cipher.init(Cipher.ENCRYPT_MODE, key, new GCMParameterSpec(128, iv));
+				cipher.updateAAD(aad);
+				byte[] encrypted = cipher.doFinal(plain);
+				AssertJUnit.assertTrue("AES-GCM encryption of " + length + " bytes with " + aad.length + " bytes of AAD",
+						Arrays.equals(referenceGCMEncrypt(key.getEncoded(), iv, aad, plain), encrypted));
+
+				cipher.init(Cipher.DECRYPT_MODE, key, new GCMParameterSpec(128, iv));
+				cipher.updateAAD(aad);
+				AssertJUnit.assertTrue("AES-GCM decryption of " + length + " bytes", Arrays.equals(plain, cipher.doFinal(encrypted)));
+			}
+		}
+	}
+}
@@ -0,0 +1,197 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+package jit.test.recognizedMethod;
+
+import java.nio.charset.Charset;
+import java.util.Random;
+
+import org.testng.AssertJUnit;
+import org.testng.annotations.Test;
+
+/**
+ * Checks String.indexOf(String), compareTo and regionMatches on Latin1 and UTF16 strings,
+ * and the byte decoding that uses StringCoding.hasNegatives, against plain Java loops.
+ * The lengths cover the 16 byte blocks of the intrinsics and the tails around them.
+ */
+public class TestStringIntrinsics {
+	private static final int ITERATIONS = 100;
+
+	private static final int[] LENGTHS = { 0, 1, 2, 7, 8, 9, 15, 16, 17, 31, 32, 33, 47, 48, 49, 64, 100 };
+
+	/* Few distinct chars, so that partial matches are frequent */
+	private static final String LATIN1_CHARS = "ab\u00e9\u00ff";
+	private static final String UTF16_CHARS = "ab\u00e9\u0100\u4e2d\uffff";
+
+	private static String randomString(Random random, String chars, int length) {
+		char[] value = new char[length];
+		for (int i = 0; i < length; i++) {
+			value[i] = chars.charAt(random.nextInt(chars.length()));
+		}
+		return new String(value);
+	}
+
+	private static int referenceIndexOf(String source, String target, int start) {
+		for (int i = Math.max(start, 0); i <= source.length() - target.length(); i++) {
+			int j = 0;
+			while ((j < target.length()) && (source.charAt(i + j) == target.charAt(j))) {
+				j++;
+			}
+			if (j == target.length()) {
+				return i;
+			}
+		}
+		return (target.length() == 0) ? Math.min(Math.max(start, 0), source.length()) : -1;
+	}
+
+	private static int referenceCompareTo(String s1, String s2) {
+		int end = Math.min(s1.length(), s2.length());
+		for (int i = 0; i < end; i++) {
+			if (s1.charAt(i) != s2.charAt(i)) {
+				return s1.charAt(i) - s2.charAt(i);
+			}
+		}
+		return s1.length() - s2.length();
+	}
+
+	private static boolean referenceRegionMatches(String s1, int s1Start, String s2, int s2Start, int length) {
+		if ((s1Start < 0) || (s2Start < 0) || (s1Start + length > s1.length()) || (s2Start + length > s2.length())) {
+			return false;
+		}
+		for (int i = 0; i < length; i++) {
+			if (s1.charAt(s1Start + i) != s2.charAt(s2Start + i)) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	private static void checkIndexOf(String source, String target, int start) {
+		AssertJUnit.assertEquals("\"" + source + "\".indexOf(\"" + target + "\", " + start + ")",
+				referenceIndexOf(source, target, start), source.indexOf(target, start));
+	}
+
+	private void testIndexOf(String chars) {
+		Random random = new Random(15);
+		for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+			for (int length : LENGTHS) {
+				String source = randomString(random, chars, length);
+				for (int targetLength = 2; targetLength <= Math.min(length, 33); targetLength++) {
+					/* Matches at both ends and in the middle, and a pattern that may not match */
+					checkIndexOf(source, source.substring(0, targetLength), 0);
+					checkIndexOf(source, source.substring(length - targetLength), 0);
+					checkIndexOf(source, source.substring(length - targetLength), length - targetLength);
+					checkIndexOf(source, source.substring(length - targetLength), length - targetLength + 1);
+					int middle = random.nextInt(length - targetLength + 1);
+					checkIndexOf(source, source.substring(middle, middle + targetLength), random.nextInt(middle + 1));
+					checkIndexOf(source, randomString(random, chars, targetLength), 0);
+				}
+				checkIndexOf(source, randomString(random, chars, length + 1), 0);
+			}
+		}
+	}
+
+	@Test(groups = {"level.sanity"}, invocationCount=2)
+	public void testIndexOfLatin1() {
+		testIndexOf(LATIN1_CHARS);
+	}
+
+	@Test(groups = {"level.sanity"}, invocationCount=2)
+	public void testIndexOfUTF16() {
+		testIndexOf(UTF16_CHARS);
+	}
+
+	private void testCompare(String chars) {
+		Random random = new Random(15);
+		for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+			for (int length : LENGTHS) {
+				String s1 = randomString(random, chars, length);
+				String same = new String(s1.toCharArray());
+				AssertJUnit.assertEquals(0, s1.compareTo(same));
+				AssertJUnit.assertTrue(s1.regionMatches(0, same, 0, length));
+
+				/* A single difference at each position */
+				for (int i = 0; i < length; i++) {
+					char[] value = s1.toCharArray();
+					value[i] = chars.charAt((chars.indexOf(value[i]) + 1 + random.nextInt(chars.length() - 1)) % chars.length());
+					String s2 = new String(value);
+					AssertJUnit.assertEquals("\"" + s1 + "\".compareTo(\"" + s2 + "\")", referenceCompareTo(s1, s2), s1.compareTo(s2));
+					AssertJUnit.assertEquals("\"" + s2 + "\".compareTo(\"" + s1 + "\")", referenceCompareTo(s2, s1), s2.compareTo(s1));
+					AssertJUnit.assertEquals(referenceRegionMatches(s1, 0, s2, 0, i), s1.regionMatches(0, s2, 0, i));
+					AssertJUnit.assertFalse(s1.regionMatches(0, s2, 0, i + 1));
+				}
+
+				/* Prefixes, and ranges at different offsets */
+				String longer = s1 + randomString(random, chars, 1 + random.nextInt(17));
+				AssertJUnit.assertEquals(referenceCompareTo(s1, longer), s1.compareTo(longer));
+				AssertJUnit.assertEquals(referenceCompareTo(longer, s1), longer.compareTo(s1));
+				for (int start = 0; start <= length; start++) {
+					String s2 = randomString(random, chars, random.nextInt(3)) + s1.substring(start) + randomString(random, chars, 3);
+					int s2Start = s2.length() - 3 - (length - start);
+					int regionLength = length - start + random.nextInt(5) - 2;
+					AssertJUnit.assertEquals("\"" + s1 + "\".regionMatches(" + start + ", \"" + s2 + "\", " + s2Start + ", " + regionLength + ")",
+							referenceRegionMatches(s1, start, s2, s2Start, regionLength), s1.regionMatches(start, s2, s2Start, regionLength));
+				}
+			}
+		}
+	}
+
+	@Test(groups = {"level.sanity"}, invocationCount=2)
+	public void testCompareLatin1() {
+		testCompare(LATIN1_CHARS);
+	}
+
+	@Test(groups = {"level.sanity"}, invocationCount=2)
+	public void testCompareUTF16() {
+		testCompare(UTF16_CHARS);
+	}
+
+	@Test(groups = {"level.sanity"}, invocationCount=2)
+	public void testHasNegatives() {
+		Charset ascii = Charset.forName("US-ASCII");
+		Charset utf8 = Charset.forName("UTF-8");
+		Random random = new Random(15);
+		for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+			for (int length : LENGTHS) {
+				byte[] bytes = new byte[length + 2];
+				for (int i = 0; i < bytes.length; i++) {
+					bytes[i] = (byte)(0x20 + random.nextInt(0x5f));
+				}
+				String expected = new String(bytes, 1, length, ascii);
+				AssertJUnit.assertEquals(expected, new String(bytes, 1, length, utf8));
+
+				/* A negative byte at each position, and just outside the range */
+				for (int i = 0; i < bytes.length; i++) {
+					byte saved = bytes[i];
+					bytes[i] = (byte)0x80;
+					char[] value = expected.toCharArray();
+					if ((i >= 1) && (i <= length)) {
+						value[i - 1] = '\ufffd';
+					}
+					AssertJUnit.assertEquals("US-ASCII with a negative byte at " + i + " of " + length, new String(value), new String(bytes, 1, length, ascii));
+					AssertJUnit.assertEquals("UTF-8 with a negative byte at " + i + " of " + length, new String(value), new String(bytes, 1, length, utf8));
+					bytes[i] = saved;
+				}
+			}
+		}
+	}
+}
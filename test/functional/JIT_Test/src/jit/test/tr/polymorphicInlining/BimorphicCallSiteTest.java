@@ -0,0 +1,148 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package jit.test.tr.polymorphicInlining;
+
+import org.testng.annotations.Test;
+import org.testng.AssertJUnit;
+
+/**
+ * Hot compilations inline each profiled receiver type of a bimorphic or trimorphic call site
+ * behind its own guard, with the original virtual or interface call as the fallthrough.
+ * The call sites below are profiled with two receiver types and then called with those types,
+ * a single type, and types that were not profiled, which must take the fallthrough call.
+ */
+@Test(groups = { "level.sanity","component.jit" })
+public class BimorphicCallSiteTest {
+	interface Shape {
+		int area();
+	}
+
+	static abstract class Polygon implements Shape {
+		abstract int sides();
+	}
+
+	static final class Square extends Polygon {
+		private final int side;
+		Square(int side) { this.side = side; }
+		public int area() { return side * side; }
+		int sides() { return 4; }
+	}
+
+	static final class Rectangle extends Polygon {
+		private final int width;
+		private final int height;
+		Rectangle(int width, int height) { this.width = width; this.height = height; }
+		public int area() { return width * height; }
+		int sides() { return 4; }
+	}
+
+	static final class Triangle extends Polygon {
+		private final int base;
+		private final int height;
+		Triangle(int base, int height) { this.base = base; this.height = height; }
+		public int area() { return base * height / 2; }
+		int sides() { return 3; }
+	}
+
+	static final class Hexagon extends Polygon {
+		private final int side;
+		Hexagon(int side) { this.side = side; }
+		public int area() { return 3 * side * side; }
+		int sides() { return 6; }
+	}
+
+	/* Interface call site */
+	private static int bimorphicCallSiteInterface(Shape[] shapes) {
+		int sum = 0;
+		for (int i = 0; i < shapes.length; i++)
+			sum += shapes[i].area();
+		return sum;
+	}
+
+	/* Virtual call site */
+	private static int bimorphicCallSiteVirtual(Polygon[] polygons) {
+		int sum = 0;
+		for (int i = 0; i < polygons.length; i++)
+			sum += polygons[i].sides();
+		return sum;
+	}
+
+	private static Polygon[] shapes(int count, int kinds) {
+		Polygon[] polygons = new Polygon[count];
+		for (int i = 0; i < count; i++) {
+			switch (i % kinds) {
+				case 0: polygons[i] = new Square(i % 7); break;
+				case 1: polygons[i] = new Rectangle(i % 5, i % 11); break;
+				case 2: polygons[i] = new Triangle(i % 13, i % 3); break;
+				default: polygons[i] = new Hexagon(i % 17); break;
+			}
+		}
+		return polygons;
+	}
+
+	private static int expectedArea(Polygon[] polygons) {
+		int sum = 0;
+		for (Polygon polygon : polygons) {
+			if (polygon instanceof Square)
+				sum += ((Square)polygon).side * ((Square)polygon).side;
+			else if (polygon instanceof Rectangle)
+				sum += ((Rectangle)polygon).width * ((Rectangle)polygon).height;
+			else if (polygon instanceof Triangle)
+				sum += ((Triangle)polygon).base * ((Triangle)polygon).height / 2;
+			else
+				sum += 3 * ((Hexagon)polygon).side * ((Hexagon)polygon).side;
+		}
+		return sum;
+	}
+
+	private static int expectedSides(Polygon[] polygons) {
+		int sum = 0;
+		for (Polygon polygon : polygons)
+			sum += (polygon instanceof Triangle) ? 3 : (polygon instanceof Hexagon) ? 6 : 4;
+		return sum;
+	}
+
+	private static void check(Polygon[] polygons) {
+		AssertJUnit.assertEquals("Wrong sum of areas", expectedArea(polygons), bimorphicCallSiteInterface(polygons));
+		AssertJUnit.assertEquals("Wrong sum of sides", expectedSides(polygons), bimorphicCallSiteVirtual(polygons));
+	}
+
+	@Test
+	public void testBimorphicCallSite() {
+		/* Profile both call sites with two receiver types until they are compiled */
+		Polygon[] twoTypes = shapes(1000, 2);
+		for (int i = 0; i < 2000; i++)
+			check(twoTypes);
+
+		check(shapes(1000, 1));
+		check(shapes(1, 2));
+		check(new Polygon[0]);
+
+		/* Receiver types that were not profiled take the fallthrough call */
+		check(shapes(1000, 3));
+		check(shapes(1000, 4));
+		Polygon[] unprofiled = { new Triangle(4, 6), new Hexagon(2) };
+		check(unprofiled);
+
+		check(twoTypes);
+	}
+}
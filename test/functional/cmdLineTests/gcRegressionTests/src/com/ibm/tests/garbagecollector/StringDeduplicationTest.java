@@ -0,0 +1,150 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package com.ibm.tests.garbagecollector;
+
+import java.nio.charset.StandardCharsets;
+
+/**
+ * Keeps many Strings with equal contents alive across global collections while other threads
+ * keep constructing new Strings, and checks that no String ever changes its contents.  Run with
+ * -Xgc:stringDeduplication; a String deduplicated while its value is still being filled in shows
+ * up as a String whose contents are wrong.
+ */
+public class StringDeduplicationTest
+{
+	private static final int RETAINED_STRINGS = 20000;
+	private static final int DISTINCT_CONTENTS = 64;
+	private static final int CONSTRUCTING_THREADS = 4;
+	private static final int GLOBAL_COLLECTIONS = 20;
+
+	private static volatile boolean _running = true;
+	private static volatile String _failure = null;
+
+	private static char[] contents(int seed, int length)
+	{
+		char[] chars = new char[length];
+		for (int i = 0; i < length; i++) {
+			/* mix compressible and non-compressible contents */
+			chars[i] = (char)(((0 == (seed % 3)) ? 0x100 : 'a') + ((seed + i) % 26));
+		}
+		return chars;
+	}
+
+	private static boolean hasContents(String string, char[] expected)
+	{
+		if (string.length() != expected.length) {
+			return false;
+		}
+		for (int i = 0; i < expected.length; i++) {
+			if (string.charAt(i) != expected[i]) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	private static void fail(String message)
+	{
+		if (null == _failure) {
+			_failure = message;
+		}
+	}
+
+	private static class Constructor extends Thread
+	{
+		private final int _id;
+
+		Constructor(int id)
+		{
+			_id = id;
+		}
+
+		public void run()
+		{
+			int iteration = 0;
+			String[] recent = new String[256];
+			char[][] recentContents = new char[recent.length][];
+			while (_running) {
+				int seed = (_id + iteration) % DISTINCT_CONTENTS;
+				char[] chars = contents(seed, 16 + (seed % 200));
+				String string = null;
+				switch (iteration % 3) {
+				case 0:
+					string = new String(chars);
+					break;
+				case 1:
+					string = new String(new String(chars).getBytes(StandardCharsets.UTF_8), StandardCharsets.UTF_8);
+					break;
+				default:
+					string = new StringBuilder().append(chars).toString();
+					break;
+				}
+				if (!hasContents(string, chars)) {
+					fail("new String has wrong contents: " + string);
+				}
+				int slot = iteration % recent.length;
+				if ((null != recent[slot]) && !hasContents(recent[slot], recentContents[slot])) {
+					fail("String changed after construction: " + recent[slot]);
+				}
+				recent[slot] = string;
+				recentContents[slot] = chars;
+				iteration += 1;
+			}
+		}
+	}
+
+	public static void main(String[] args) throws InterruptedException
+	{
+		String[] retained = new String[RETAINED_STRINGS];
+		for (int i = 0; i < RETAINED_STRINGS; i++) {
+			int seed = i % DISTINCT_CONTENTS;
+			retained[i] = new String(contents(seed, 16 + (seed % 200)));
+		}
+
+		Constructor[] threads = new Constructor[CONSTRUCTING_THREADS];
+		for (int i = 0; i < threads.length; i++) {
+			threads[i] = new Constructor(i);
+			threads[i].start();
+		}
+		for (int i = 0; i < GLOBAL_COLLECTIONS; i++) {
+			System.gc();
+			Thread.sleep(50);
+		}
+		_running = false;
+		for (int i = 0; i < threads.length; i++) {
+			threads[i].join();
+		}
+
+		for (int i = 0; i < RETAINED_STRINGS; i++) {
+			int seed = i % DISTINCT_CONTENTS;
+			if (!hasContents(retained[i], contents(seed, 16 + (seed % 200)))) {
+				fail("retained String " + i + " has wrong contents: " + retained[i]);
+			}
+		}
+
+		if (null == _failure) {
+			System.out.println("PASS");
+		} else {
+			System.out.println("FAIL: " + _failure);
+		}
+	}
+}
@@ -0,0 +1,87 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+import jdk.incubator.vector.IntVector;
+import jdk.incubator.vector.VectorSpecies;
+
+/**
+ * Runs Vector API loops long enough for them to be compiled. The first loop only
+ * uses 128-bit vectors, so every VectorSupport call in it can be expanded. The
+ * second uses 256-bit vectors, which are not expanded and have to be inlined.
+ */
+public class VectorAPIExpansionTest {
+	static final VectorSpecies<Integer> SPECIES = IntVector.SPECIES_128;
+	static final VectorSpecies<Integer> SPECIES_256 = IntVector.SPECIES_256;
+	static final int LENGTH = 1003;
+	static final int ITERATIONS = 20000;
+
+	static void addArrays(int[] a, int[] b, int[] c) {
+		int i = 0;
+		for (; i < SPECIES.loopBound(a.length); i += SPECIES.length()) {
+			IntVector va = IntVector.fromArray(SPECIES, a, i);
+			IntVector vb = IntVector.fromArray(SPECIES, b, i);
+			va.add(vb).intoArray(c, i);
+		}
+		for (; i < a.length; i++) {
+			c[i] = a[i] + b[i];
+		}
+	}
+
+	static void addArrays256(int[] a, int[] b, int[] c) {
+		int i = 0;
+		for (; i < SPECIES_256.loopBound(a.length); i += SPECIES_256.length()) {
+			IntVector va = IntVector.fromArray(SPECIES_256, a, i);
+			IntVector vb = IntVector.fromArray(SPECIES_256, b, i);
+			va.add(vb).intoArray(c, i);
+		}
+		for (; i < a.length; i++) {
+			c[i] = a[i] + b[i];
+		}
+	}
+
+	static void check(String name, int[] a, int[] b, int[] c, int n) {
+		for (int i = 0; i < LENGTH; i++) {
+			if (c[i] != a[i] + b[i]) {
+				System.out.println("VectorAPIExpansionTest FAILED: " + name + " c[" + i + "] = " + c[i] + ", expected " + (a[i] + b[i]) + " in iteration " + n);
+				System.exit(1);
+			}
+		}
+	}
+
+	public static void main(String[] args) {
+		int[] a = new int[LENGTH];
+		int[] b = new int[LENGTH];
+		int[] c = new int[LENGTH];
+		for (int i = 0; i < LENGTH; i++) {
+			a[i] = i * 31;
+			b[i] = Integer.MAX_VALUE - i;
+		}
+
+		for (int n = 0; n < ITERATIONS; n++) {
+			addArrays(a, b, c);
+			check("addArrays", a, b, c, n);
+			addArrays256(a, b, c);
+			check("addArrays256", a, b, c, n);
+		}
+		System.out.println("VectorAPIExpansionTest PASSED");
+	}
+}